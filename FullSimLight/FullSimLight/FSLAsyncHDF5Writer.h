@@ -0,0 +1,351 @@
+/*
+  Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+*/
+#ifndef FSLAsyncHDF5Writer_h
+#define FSLAsyncHDF5Writer_h
+
+#include "H5Cpp.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @class FSLAsyncHDF5Writer
+ *
+ * @brief Writes the output of the user action plugins to an HDF5 file from
+ *        a dedicated I/O thread, so that the worker threads do not serialize
+ *        on the file.
+ *
+ *        The workers hand over blocks of records (e.g. the hits of an event)
+ *        through a lock-free multiple-producer single-consumer queue; the I/O
+ *        thread buffers them and appends them to a chunked, extendible dataset
+ *        per stream. Each block gets an entry in the index table of its stream,
+ *        the dataset "<name>Index", of IndexEntry records: the event number,
+ *        a user key (e.g. the track number, -1 if unused), and the range of the
+ *        records of the block in the dataset "<name>". The blocks are stored
+ *        in the order they are received, which is not the event order.
+ *
+ *        The HDF5 library is only used by the I/O thread, except in the
+ *        constructor, AddStream() and after Flush() has returned, when the
+ *        caller owns the file until the next Push().
+ */
+class FSLAsyncHDF5Writer
+{
+public:
+
+  /// An entry of the index table of a stream
+  struct IndexEntry
+  {
+    int64_t  event;
+    int64_t  key;
+    uint64_t offset;
+    uint64_t count;
+  };
+
+  /// The HDF5 type of the index entries
+  static H5::CompType IndexType()
+  {
+    H5::CompType type(sizeof(IndexEntry));
+    type.insertMember("event",  HOFFSET(IndexEntry, event),  H5::PredType::NATIVE_INT64);
+    type.insertMember("key",    HOFFSET(IndexEntry, key),    H5::PredType::NATIVE_INT64);
+    type.insertMember("offset", HOFFSET(IndexEntry, offset), H5::PredType::NATIVE_UINT64);
+    type.insertMember("count",  HOFFSET(IndexEntry, count),  H5::PredType::NATIVE_UINT64);
+    return type;
+  }
+
+  /// Starts the I/O thread; the records are written in chunks of 'chunkSize' records
+  FSLAsyncHDF5Writer(H5::H5File* file, hsize_t chunkSize = 8192)
+    : fFile(file), fChunkSize(chunkSize), fIndexType(IndexType())
+  {
+    fHead.store(&fStub);
+    fTail = &fStub;
+    fThread = std::thread(&FSLAsyncHDF5Writer::Run, this);
+  }
+
+  /// Writes the pending blocks and stops the I/O thread
+  ~FSLAsyncHDF5Writer()
+  {
+    Node stop(Node::kStop);
+    Post(&stop);
+    fThread.join();
+  }
+
+  FSLAsyncHDF5Writer(const FSLAsyncHDF5Writer&) = delete;
+  FSLAsyncHDF5Writer& operator=(const FSLAsyncHDF5Writer&) = delete;
+
+  /// Creates the datasets "<name>" and "<name>Index" of a stream of records
+  /// of HDF5 type 'type'. To be called before the blocks are pushed.
+  unsigned int AddStream(const std::string& name, const H5::DataType& type)
+  {
+    auto stream = std::make_unique<Stream>();
+    stream->type = type;
+    stream->recordSize = type.getSize();
+    stream->data = CreateDataSet(name, type);
+    stream->index = CreateDataSet(name + "Index", fIndexType);
+    fStreams.push_back(std::move(stream));
+    return fStreams.size() - 1;
+  }
+
+  /// Hands over the records of a block, to be appended to 'stream'; thread safe
+  template <class T>
+  void Push(unsigned int stream, int64_t event, int64_t key, std::vector<T>&& records)
+  {
+    if (stream >= fStreams.size() || sizeof(T) != fStreams[stream]->recordSize)
+    {
+      throw std::invalid_argument("FSLAsyncHDF5Writer::Push(): wrong stream or record type");
+    }
+    auto* block = new TypedBlock<T>(std::move(records));
+    block->stream = stream;
+    block->event = event;
+    block->key = key;
+    Post(block);
+  }
+
+  /// Waits until all the blocks pushed so far have been written,
+  /// and flushes the file. Rethrows the errors of the I/O thread.
+  void Flush()
+  {
+    Node flush(Node::kFlush);
+    Post(&flush);
+    std::unique_lock<std::mutex> lock(fDoneMutex);
+    fDoneCondition.wait(lock, [&flush]() { return flush.done; });
+    if (fError)
+    {
+      std::exception_ptr error = fError;
+      fError = nullptr;
+      fFailed.store(false, std::memory_order_relaxed);
+      std::rethrow_exception(error);
+    }
+  }
+
+private:
+
+  struct Node
+  {
+    enum Kind { kStub, kBlock, kFlush, kStop };
+    explicit Node(Kind k) : kind(k) {}
+    virtual ~Node() = default;
+    std::atomic<Node*> next{nullptr};
+    Kind kind;
+    bool done = false;
+  };
+
+  struct Block : Node
+  {
+    Block() : Node(kBlock) {}
+    virtual const void* Data() const = 0;
+    virtual size_t Size() const = 0;
+    unsigned int stream = 0;
+    int64_t event = 0;
+    int64_t key = 0;
+  };
+
+  template <class T>
+  struct TypedBlock : Block
+  {
+    explicit TypedBlock(std::vector<T>&& r) : records(std::move(r)) {}
+    const void* Data() const override { return records.data(); }
+    size_t Size() const override { return records.size(); }
+    std::vector<T> records;
+  };
+
+  /// State of a stream, only used by the I/O thread once created
+  struct Stream
+  {
+    H5::DataSet data, index;
+    H5::DataType type;
+    size_t recordSize = 0;
+    /// number of records in the stream, the pending ones included
+    uint64_t size = 0;
+    uint64_t written = 0;
+    uint64_t indexWritten = 0;
+    std::vector<char> pending;
+    std::vector<IndexEntry> pendingIndex;
+  };
+
+  H5::DataSet CreateDataSet(const std::string& name, const H5::DataType& type)
+  {
+    hsize_t dims = 0, maxDims = H5S_UNLIMITED;
+    H5::DataSpace space(1, &dims, &maxDims);
+    H5::DSetCreatPropList properties;
+    properties.setChunk(1, &fChunkSize);
+    return fFile->createDataSet(name, type, space, properties);
+  }
+
+  static void Append(H5::DataSet& dataset, const H5::DataType& type,
+                     const void* data, uint64_t offset, uint64_t count)
+  {
+    if (count == 0) return;
+    hsize_t size = offset + count;
+    dataset.extend(&size);
+    H5::DataSpace fileSpace = dataset.getSpace();
+    hsize_t start = offset, length = count;
+    fileSpace.selectHyperslab(H5S_SELECT_SET, &length, &start);
+    H5::DataSpace memSpace(1, &length);
+    dataset.write(data, type, memSpace, fileSpace);
+  }
+
+  /// Lock-free enqueue (multiple producers), and wake the I/O thread if idle.
+  /// The exchange of the head and the load of fIdle are sequentially
+  /// consistent, as the store of fIdle and the load of the head in Run():
+  /// either the I/O thread sees the node, or the producer sees it idle and
+  /// notifies it under the mutex, which cannot happen before it waits.
+  void Post(Node* node)
+  {
+    node->next.store(nullptr, std::memory_order_relaxed);
+    Node* previous = fHead.exchange(node, std::memory_order_seq_cst);
+    previous->next.store(node, std::memory_order_release);
+    if (fIdle.load(std::memory_order_seq_cst))
+    {
+      std::lock_guard<std::mutex> lock(fWakeMutex);
+      fWakeCondition.notify_one();
+    }
+  }
+
+  /// Dequeue, only called by the I/O thread; nullptr if the queue is empty
+  /// or a producer is in the middle of Post()
+  Node* Pop()
+  {
+    Node* tail = fTail;
+    Node* next = tail->next.load(std::memory_order_acquire);
+    if (tail == &fStub)
+    {
+      if (!next) return nullptr;
+      fTail = next;
+      tail = next;
+      next = next->next.load(std::memory_order_acquire);
+    }
+    if (next)
+    {
+      fTail = next;
+      return tail;
+    }
+    if (tail != fHead.load(std::memory_order_acquire)) return nullptr;
+    Post(&fStub);
+    next = tail->next.load(std::memory_order_acquire);
+    if (next)
+    {
+      fTail = next;
+      return tail;
+    }
+    return nullptr;
+  }
+
+  void Write(Block& block)
+  {
+    Stream& stream = *fStreams[block.stream];
+    const size_t bytes = block.Size()*stream.recordSize;
+    stream.pendingIndex.push_back(IndexEntry{block.event, block.key, stream.size, block.Size()});
+    stream.size += block.Size();
+    if (stream.pending.empty() && block.Size() >= fChunkSize)
+    {
+      // large blocks are written without the copy
+      Append(stream.data, stream.type, block.Data(), stream.written, block.Size());
+      stream.written = stream.size;
+    }
+    else if (bytes > 0)
+    {
+      const size_t previous = stream.pending.size();
+      stream.pending.resize(previous + bytes);
+      std::memcpy(stream.pending.data() + previous, block.Data(), bytes);
+      if (stream.size - stream.written >= fChunkSize) WritePending(stream);
+    }
+    if (stream.pendingIndex.size() >= fChunkSize) WritePending(stream);
+  }
+
+  void WritePending(Stream& stream)
+  {
+    Append(stream.data, stream.type, stream.pending.data(), stream.written, stream.size - stream.written);
+    stream.written = stream.size;
+    stream.pending.clear();
+    Append(stream.index, fIndexType, stream.pendingIndex.data(), stream.indexWritten, stream.pendingIndex.size());
+    stream.indexWritten += stream.pendingIndex.size();
+    stream.pendingIndex.clear();
+  }
+
+  /// The I/O thread
+  void Run()
+  {
+    for (;;)
+    {
+      Node* node = Pop();
+      if (!node)
+      {
+        // sleep until a node is posted; a node being linked by a producer
+        // is seen as well, and it is popped once linked
+        std::unique_lock<std::mutex> lock(fWakeMutex);
+        fIdle.store(true, std::memory_order_seq_cst);
+        fWakeCondition.wait(lock, [this]() { return fHead.load(std::memory_order_seq_cst) != fTail; });
+        fIdle.store(false, std::memory_order_relaxed);
+        continue;
+      }
+      if (node->kind == Node::kBlock)
+      {
+        std::unique_ptr<Block> block(static_cast<Block*>(node));
+        // the blocks are dropped after an error, until Flush() reports it
+        if (fFailed.load(std::memory_order_relaxed)) continue;
+        try
+        {
+          Write(*block);
+        }
+        catch (...)
+        {
+          std::lock_guard<std::mutex> lock(fDoneMutex);
+          fError = std::current_exception();
+          fFailed.store(true, std::memory_order_relaxed);
+        }
+        continue;
+      }
+      try
+      {
+        for (auto& stream : fStreams) WritePending(*stream);
+        fFile->flush(H5F_SCOPE_LOCAL);
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> lock(fDoneMutex);
+        if (!fError) fError = std::current_exception();
+        fFailed.store(true, std::memory_order_relaxed);
+      }
+      const bool stop = (node->kind == Node::kStop);
+      {
+        std::lock_guard<std::mutex> lock(fDoneMutex);
+        node->done = true;
+      }
+      fDoneCondition.notify_all();
+      if (stop) return;
+    }
+  }
+
+  H5::H5File* fFile;
+  hsize_t fChunkSize;
+  H5::CompType fIndexType;
+  std::vector<std::unique_ptr<Stream>> fStreams;
+
+  // the queue: producers exchange the head, the I/O thread owns the tail
+  Node fStub{Node::kStub};
+  std::atomic<Node*> fHead{nullptr};
+  Node* fTail = nullptr;
+
+  std::atomic<bool> fIdle{false};
+  std::mutex fWakeMutex;
+  std::condition_variable fWakeCondition;
+
+  std::mutex fDoneMutex;
+  std::condition_variable fDoneCondition;
+  std::exception_ptr fError;     // guarded by fDoneMutex
+  std::atomic<bool> fFailed{false};  // fError is set, read without the lock
+
+  std::thread fThread;
+};
+
+#endif // FSLAsyncHDF5Writer_h
@@ -0,0 +1,106 @@
+//
+// Throughput of the hits output: one dataset per event, written by the
+// worker threads under a mutex, versus the FSLAsyncHDF5Writer stage.
+//
+// Usage: benchHitsWriter [threads] [events] [hits per event]
+//
+#include "H5Cpp.h"
+#include "FullSimLight/FSLAsyncHDF5Writer.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct Hit{
+  float x;
+  float y;
+  float z;
+  unsigned int  id;
+};
+
+H5::CompType hitType()
+{
+  H5::CompType datatype(sizeof(Hit));
+  datatype.insertMember("X", HOFFSET(Hit,x),H5::PredType::NATIVE_FLOAT);
+  datatype.insertMember("Y", HOFFSET(Hit,y),H5::PredType::NATIVE_FLOAT);
+  datatype.insertMember("Z", HOFFSET(Hit,z),H5::PredType::NATIVE_FLOAT);
+  datatype.insertMember("ID", HOFFSET(Hit,id),H5::PredType::NATIVE_UINT);
+  return datatype;
+}
+
+// Simulate the events in 'nThreads' workers, handing the hits of each event to 'write'
+template <class Write>
+double run(unsigned int nThreads, unsigned int nEvents, unsigned int nHits, Write write)
+{
+  std::atomic<unsigned int> nextEvent{0};
+  auto worker = [&](unsigned int thread)
+  {
+    std::mt19937 generator(thread);
+    std::uniform_real_distribution<float> position(-1000., 1000.);
+    for (unsigned int event = nextEvent++; event < nEvents; event = nextEvent++)
+    {
+      std::vector<Hit> hits(nHits);
+      for (Hit& hit : hits) hit = Hit{position(generator), position(generator), position(generator), 2};
+      write(event, std::move(hits));
+    }
+  };
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> threads;
+  for (unsigned int t = 0; t < nThreads; ++t) threads.emplace_back(worker, t);
+  for (std::thread& thread : threads) thread.join();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv)
+{
+  const unsigned int nThreads = argc > 1 ? std::atoi(argv[1]) : 8;
+  const unsigned int nEvents  = argc > 2 ? std::atoi(argv[2]) : 20000;
+  const unsigned int nHits    = argc > 3 ? std::atoi(argv[3]) : 500;
+  const double megaBytes = double(nEvents)*nHits*sizeof(Hit)/(1024.*1024.);
+  H5::CompType datatype = hitType();
+
+  // one dataset per event, written under a global mutex
+  double syncTime = 0;
+  {
+    H5::H5File file("benchHitsWriter_sync.h5", H5F_ACC_TRUNC);
+    std::mutex mutex;
+    syncTime = run(nThreads, nEvents, nHits, [&](unsigned int event, std::vector<Hit>&& hits)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      hsize_t numberOfHits = hits.size();
+      H5::DataSpace dataspace(1,&numberOfHits,nullptr);
+      H5::DataSet dataset = file.createDataSet("EVENT-"+std::to_string(event), datatype, dataspace);
+      dataset.write(hits.data(), datatype);
+    });
+    file.close();
+  }
+
+  // chunked, extendible dataset with an event index, written by the I/O thread
+  double asyncTime = 0;
+  {
+    H5::H5File file("benchHitsWriter_async.h5", H5F_ACC_TRUNC);
+    FSLAsyncHDF5Writer writer(&file);
+    const unsigned int stream = writer.AddStream("hits", datatype);
+    asyncTime = run(nThreads, nEvents, nHits, [&](unsigned int event, std::vector<Hit>&& hits)
+    {
+      writer.Push(stream, event, -1, std::move(hits));
+    });
+    const auto start = std::chrono::steady_clock::now();
+    writer.Flush();
+    asyncTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  std::cout << nThreads << " threads, " << nEvents << " events of " << nHits << " hits ("
+            << megaBytes << " MB)" << std::endl;
+  std::cout << "  one dataset per event : " << syncTime  << " s, " << nEvents/syncTime  << " events/s, "
+            << megaBytes/syncTime  << " MB/s" << std::endl;
+  std::cout << "  asynchronous writer   : " << asyncTime << " s, " << nEvents/asyncTime << " events/s, "
+            << megaBytes/asyncTime << " MB/s" << std::endl;
+  return 0;
+}
@@ -3,6 +3,7 @@
 //
 #include "H5Cpp.h"
 #include "FullSimLight/FSLUserActionPlugin.h"
+#include "FullSimLight/FSLAsyncHDF5Writer.h"
 #include "G4UserSteppingAction.hh"
 #include "G4UserEventAction.hh"
 #include "G4UserRunAction.hh"
@@ -14,6 +15,7 @@
 #include <G4Event.hh>
 #include <G4String.hh>
 #include <map>
+#include <memory>
 #include <mutex>
 
 //----------------------------------------------------------------------//
@@ -101,11 +103,8 @@ public:
      //Set Stepping Action
      void SetSteppingAction(GenerateHitsStep* stepact){step = stepact;}
      
-     //Set file
-     void assignfile(H5::H5File &filename){file = &filename;}
-     
-     //Set DataType
-     void assignDataType(H5::CompType &data_type){datatype = &data_type;}
+     //Set the writer of the hits file, and the stream of the hits
+     void assignWriter(FSLAsyncHDF5Writer* hitsWriter, unsigned int hitsStream){writer = hitsWriter; stream = hitsStream;}
      
      
 
@@ -113,9 +112,8 @@ public:
      
      GenerateHitsStep* step;
      unsigned int event_ID;
-     std::vector<Hit> hits;
-     H5::H5File* file;
-     H5::CompType* datatype;
+     FSLAsyncHDF5Writer* writer;
+     unsigned int stream;
      std::mutex mutex;
      
      
@@ -131,13 +129,10 @@ GenerateHitsEvent::~GenerateHitsEvent(){}
 void GenerateHitsEvent::EndOfEventAction(const G4Event* evt)
 {
     event_ID = evt->GetEventID();
-    hits = step->hits;
+    // The hits are appended to the "hits" dataset by the I/O thread of the
+    // writer, with their range recorded in "hitsIndex"
     mutex.lock();
-    hsize_t numberOfHits= hits.size();
-    H5::DataSpace dataspace(1,&numberOfHits,nullptr);
-    const std::string datasetName="EVENT-"+std::to_string(event_ID);
-    H5::DataSet dataset=file->createDataSet(datasetName, *datatype, dataspace);
-    dataset.write(hits.data(),*datatype);
+    writer->Push(stream, event_ID, -1, std::move(step->hits));
     step->clearhits();
     mutex.unlock();
 }
@@ -175,6 +170,8 @@ public:
      static H5::CompType datatype;
      static std::string path;
      static H5::H5File file;
+     static std::unique_ptr<FSLAsyncHDF5Writer> writer;
+     static unsigned int stream;
      
 
  };
@@ -182,6 +179,8 @@ public:
 std::string GenerateHitsRun::path = "hits.h5";
 H5::H5File GenerateHitsRun::file = H5::H5File(path, H5F_ACC_TRUNC);
 H5::CompType GenerateHitsRun::datatype = sizeof(Hit);
+std::unique_ptr<FSLAsyncHDF5Writer> GenerateHitsRun::writer;
+unsigned int GenerateHitsRun::stream = 0;
 
 GenerateHitsRun::GenerateHitsRun(){}
 GenerateHitsRun::~GenerateHitsRun(){}
@@ -189,7 +188,7 @@ GenerateHitsRun::~GenerateHitsRun(){}
 
 void GenerateHitsRun::BeginOfRunAction(const G4Run*)
 {
-    if(IsMaster())
+    if(IsMaster() && !writer)
    {
         
         
@@ -198,10 +197,11 @@ void GenerateHitsRun::BeginOfRunAction(const G4Run*)
         datatype.insertMember("Z", HOFFSET(Hit,z),H5::PredType::NATIVE_FLOAT);
         datatype.insertMember("ID", HOFFSET(Hit,id),H5::PredType::NATIVE_UINT);
 
+        writer = std::make_unique<FSLAsyncHDF5Writer>(&file);
+        stream = writer->AddStream("hits", datatype);
     }
     
-    event->assignfile(file);
-    event->assignDataType(datatype);
+    event->assignWriter(writer.get(), stream);
     
 }
 
@@ -209,6 +209,7 @@ void GenerateHitsRun::EndOfRunAction(const G4Run*)
 {
     if(IsMaster())
     {
+        writer->Flush();
         std::cout << "Hits file written at: " << path << std::endl;
     }
     
@@ -3,16 +3,7 @@
 
 #include "G4UserEventAction.hh"
 #include "G4UnitsTable.hh"
-
-#include <vector>
-#include <map>
-
-struct stepData
-{
-    float x;
-    float y;
-    float z;
-};
+#include "TrksStepArena.h"
 
 class TrksEventAction: public G4UserEventAction
 {
@@ -24,8 +15,8 @@ public:
     void BeginOfEventAction(const G4Event*);
     void EndOfEventAction(const G4Event*);
 
-    static G4ThreadLocal std::map<int, int> gPDGs;
-    static G4ThreadLocal std::map<int, std::vector<stepData>> trksInfoMap;
+    // the tracks of the current event of the thread
+    static G4ThreadLocal TrksStepArena stepArena;
 
 
 };
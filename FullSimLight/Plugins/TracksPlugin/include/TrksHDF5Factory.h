@@ -2,19 +2,27 @@
 #define __TrksHDF5Factory_hh__
 
 #include "H5Cpp.h"
-
-#include <mutex> 
+#include "FullSimLight/FSLAsyncHDF5Writer.h"
 
 class TrksHDF5Factory
 {
 public:
 
-    static std::mutex gWriteFileMutex;
-
     static TrksHDF5Factory* GetInstance();
+    // Open the output file, and start its writer with the streams, each with
+    // one block per event: "PDGs" (one record per track), "steps" (the step
+    // points, by track) and "stepOffsets" (the number of tracks plus one
+    // offsets: the points of track i are [offsets[i-1], offsets[i]) of the
+    // points of the event)
     static void OpenFile(const char*);
+    // Stop the writer and close the output file
+    static void CloseFile();
 
     static H5::H5File* GetFile() {return fgFile;}
+    static FSLAsyncHDF5Writer* GetWriter() {return fgWriter;}
+    static unsigned int GetPDGStream() {return fgPDGStream;}
+    static unsigned int GetStepStream() {return fgStepStream;}
+    static unsigned int GetStepOffsetStream() {return fgStepOffsetStream;}
 
 private:
 
@@ -23,6 +31,10 @@ private:
 
     static TrksHDF5Factory* fgInstance;
     static H5::H5File *fgFile;
+    static FSLAsyncHDF5Writer* fgWriter;
+    static unsigned int fgPDGStream;
+    static unsigned int fgStepStream;
+    static unsigned int fgStepOffsetStream;
 
 };
 
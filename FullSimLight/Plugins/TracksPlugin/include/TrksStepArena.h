@@ -0,0 +1,70 @@
+#ifndef __TrksStepArena_hh__
+#define __TrksStepArena_hh__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct stepData
+{
+    float x;
+    float y;
+    float z;
+};
+
+// The step points and the PDG codes of the tracks of an event, collected by
+// a worker thread. The points are appended to a single buffer in the order
+// they are produced, as segments of consecutive points of a track (a track
+// has more than one segment if it is suspended). The buffers keep their
+// capacity from one event to the next, so that after the first events the
+// stepping does not allocate.
+//
+// At the end of the event the points are gathered by track number into a
+// compressed sparse row layout: the points of the track with ID i are
+// [offsets[i-1], offsets[i]) of the gathered points.
+class TrksStepArena
+{
+public:
+
+    // Starts a segment of the track with ID 'trackID' (from 1)
+    void BeginTrack(int trackID, int pdg);
+    // Appends a point to the track of the current segment
+    void AddStep(int trackID, const stepData& step)
+    {
+        if (fSegments.empty() || fSegments.back().track != trackID) BeginSegment(trackID);
+        fSteps.push_back(step);
+    }
+
+    // Number of tracks, the highest track ID of the event
+    std::size_t GetNTracks() const {return fPDGs.size();}
+    std::size_t GetNSteps() const {return fSteps.size();}
+    // PDG code of the track with ID i at i-1, 0 for the missing IDs
+    const std::vector<int>& GetPDGs() const {return fPDGs;}
+
+    // Gathers the points by track: 'steps' receives the points and 'offsets'
+    // the GetNTracks()+1 offsets of the tracks. Both are resized to fit.
+    void Gather(std::vector<stepData>& steps, std::vector<uint64_t>& offsets) const;
+
+    // Forgets the event, keeps the capacity of the buffers
+    void Clear();
+
+private:
+
+    struct Segment
+    {
+        int track;
+        std::size_t begin;
+    };
+
+    void BeginSegment(int trackID);
+
+    std::vector<stepData> fSteps;
+    std::vector<Segment> fSegments;
+    std::vector<int> fPDGs;
+    // scatter positions of the tracks, used by Gather()
+    mutable std::vector<uint64_t> fCursors;
+
+};
+
+
+#endif //__TrksStepArena_hh__
@@ -1,4 +1,5 @@
 #include "TrksHDF5Factory.h"
+#include "TrksEventAction.h"
 
 #include "G4UnitsTable.hh"
 
@@ -6,7 +7,10 @@
 
 TrksHDF5Factory* TrksHDF5Factory::fgInstance = nullptr;
 H5::H5File* TrksHDF5Factory::fgFile;
-std::mutex     TrksHDF5Factory::gWriteFileMutex;
+FSLAsyncHDF5Writer* TrksHDF5Factory::fgWriter = nullptr;
+unsigned int TrksHDF5Factory::fgPDGStream = 0;
+unsigned int TrksHDF5Factory::fgStepStream = 0;
+unsigned int TrksHDF5Factory::fgStepOffsetStream = 0;
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
@@ -20,12 +24,7 @@ TrksHDF5Factory::TrksHDF5Factory()
 TrksHDF5Factory::~TrksHDF5Factory()
 {
 
-    if (fgFile)
-    {
-        fgFile->close();
-        delete fgFile;
-        fgFile = nullptr;
-    }
+    CloseFile();
 
     if (fgInstance)
     {
@@ -47,5 +46,31 @@ TrksHDF5Factory* TrksHDF5Factory::GetInstance()
 void TrksHDF5Factory::OpenFile(const char* name)
 {
     fgFile = new H5::H5File( name, H5F_ACC_TRUNC );
+
+    H5::CompType stepDataType(sizeof(stepData));
+    stepDataType.insertMember("x", HOFFSET(stepData, x), H5::PredType::NATIVE_FLOAT);
+    stepDataType.insertMember("y", HOFFSET(stepData, y), H5::PredType::NATIVE_FLOAT);
+    stepDataType.insertMember("z", HOFFSET(stepData, z), H5::PredType::NATIVE_FLOAT);
+
+    fgWriter = new FSLAsyncHDF5Writer(fgFile);
+    fgPDGStream = fgWriter->AddStream("PDGs", H5::PredType::NATIVE_INT);
+    fgStepStream = fgWriter->AddStream("steps", stepDataType);
+    fgStepOffsetStream = fgWriter->AddStream("stepOffsets", H5::PredType::NATIVE_UINT64);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void TrksHDF5Factory::CloseFile()
+{
+    // the writer flushes the pending blocks before stopping
+    delete fgWriter;
+    fgWriter = nullptr;
+
+    if (fgFile)
+    {
+        fgFile->close();
+        delete fgFile;
+        fgFile = nullptr;
+    }
 }
 
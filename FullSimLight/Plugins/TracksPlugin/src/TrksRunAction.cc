@@ -73,7 +73,8 @@ void TrksRunAction::EndOfRunAction(const G4Run* /*aRun*/)
     {
 
         TrksHDF5Factory* hdf5Factory = TrksHDF5Factory::GetInstance();
-        // hdf5Factory->gWriteFileMutex.lock();
+        // wait for the events to be written
+        hdf5Factory->GetWriter()->Flush();
 
         std::vector<int> trkNumsVec;
 
@@ -89,13 +90,12 @@ void TrksRunAction::EndOfRunAction(const G4Run* /*aRun*/)
         H5::DataSet* dataSet = new H5::DataSet(file->createDataSet("eventNums",
                                             H5::PredType::NATIVE_INT, dataSpace));
         dataSet->write(trkNumsVec.data(), H5::PredType::NATIVE_INT);
-        // hdf5Factory->gWriteFileMutex.unlock();
 
         delete dataSet;
 
         G4String outputFileName = file->getFileName();
 
-        file->close();
+        hdf5Factory->CloseFile();
 
         G4cout << "The file " << outputFileName << " has been created." << G4endl;
     }
@@ -0,0 +1,65 @@
+#include "TrksStepArena.h"
+
+#include <cstring>
+
+
+void TrksStepArena::BeginTrack(int trackID, int pdg)
+{
+    if (trackID < 1) return;
+    if (static_cast<std::size_t>(trackID) > fPDGs.size()) fPDGs.resize(trackID, 0);
+    fPDGs[trackID - 1] = pdg;
+    BeginSegment(trackID);
+}
+
+
+void TrksStepArena::BeginSegment(int trackID)
+{
+    if (!fSegments.empty() && fSegments.back().begin == fSteps.size())
+    {
+        // the previous segment has no point
+        fSegments.back().track = trackID;
+    }
+    else
+    {
+        fSegments.push_back(Segment{trackID, fSteps.size()});
+    }
+    if (trackID > 0 && static_cast<std::size_t>(trackID) > fPDGs.size()) fPDGs.resize(trackID, 0);
+}
+
+
+void TrksStepArena::Gather(std::vector<stepData>& steps, std::vector<uint64_t>& offsets) const
+{
+    const std::size_t nTracks = fPDGs.size();
+    offsets.assign(nTracks + 1, 0);
+    steps.resize(fSteps.size());
+
+    // count the points per track, then scatter the segments
+    // after the prefix sum of the counts
+    for (std::size_t i = 0; i < fSegments.size(); ++i)
+    {
+        const std::size_t end = i + 1 < fSegments.size() ? fSegments[i+1].begin : fSteps.size();
+        if (fSegments[i].track > 0) offsets[fSegments[i].track] += end - fSegments[i].begin;
+    }
+    for (std::size_t i = 1; i <= nTracks; ++i) offsets[i] += offsets[i-1];
+
+    std::vector<uint64_t>& next = fCursors;
+    next.assign(offsets.begin(), offsets.end() - 1);
+    for (std::size_t i = 0; i < fSegments.size(); ++i)
+    {
+        const std::size_t end = i + 1 < fSegments.size() ? fSegments[i+1].begin : fSteps.size();
+        const int track = fSegments[i].track;
+        if (track < 1) continue;
+        const std::size_t count = end - fSegments[i].begin;
+        std::memcpy(steps.data() + next[track-1], fSteps.data() + fSegments[i].begin, count*sizeof(stepData));
+        next[track-1] += count;
+    }
+    steps.resize(offsets.back());
+}
+
+
+void TrksStepArena::Clear()
+{
+    fSteps.clear();
+    fSegments.clear();
+    fPDGs.clear();
+}
@@ -24,15 +24,8 @@ TrksSteppingAction::~TrksSteppingAction()
 void TrksSteppingAction::UserSteppingAction(const G4Step * aStep)
 {
 
-    int trkNum = aStep->GetTrack()->GetTrackID();
-
-    stepData tmpStepData;
-    tmpStepData.x = aStep->GetPostStepPoint()->GetPosition().getX();
-    tmpStepData.y = aStep->GetPostStepPoint()->GetPosition().getY();
-    tmpStepData.z = aStep->GetPostStepPoint()->GetPosition().getZ();
-
-    std::map<int, std::vector<stepData>> &trksInfoMap = TrksEventAction::trksInfoMap;
-
-    trksInfoMap[trkNum].push_back(tmpStepData);
+    const G4ThreeVector& position = aStep->GetPostStepPoint()->GetPosition();
+    TrksEventAction::stepArena.AddStep(aStep->GetTrack()->GetTrackID(),
+        stepData{float(position.getX()), float(position.getY()), float(position.getZ())});
 
 }
@@ -32,26 +32,12 @@ void TrksTrackingAction::PreUserTrackingAction(const G4Track* aTrack)
 {
     int trkNum = aTrack->GetTrackID();
 
-    std::map<int, std::vector<stepData>> &trksInfoMap = TrksEventAction::trksInfoMap;
-
-    stepData tmpStepData;
-    tmpStepData.x = aTrack->GetPosition().getX();
-    tmpStepData.y = aTrack->GetPosition().getY();
-    tmpStepData.z = aTrack->GetPosition().getZ();
-
-    if (trksInfoMap.find(trkNum) != trksInfoMap.end()) //track ID already in the map
-    {
-        std::vector<stepData> &v = trksInfoMap[trkNum];
-        v.push_back(tmpStepData);
-    }
-    else //There is no such track with given track ID
-    {   
-        std::vector<stepData> newV = {tmpStepData};
-        trksInfoMap[trkNum] = newV;
-    }
-
-    G4int particlePDG = aTrack->GetParticleDefinition()->GetPDGEncoding();
-    TrksEventAction::gPDGs[trkNum] = particlePDG;
+    // a track resumed after a suspension starts a new segment of its points
+    TrksStepArena& stepArena = TrksEventAction::stepArena;
+    stepArena.BeginTrack(trkNum, aTrack->GetParticleDefinition()->GetPDGEncoding());
+
+    const G4ThreeVector& position = aTrack->GetPosition();
+    stepArena.AddStep(trkNum, stepData{float(position.getX()), float(position.getY()), float(position.getZ())});
 
 }
 
@@ -167,6 +167,7 @@ int main(int argc, char** argv) {
     const FSLPhysListFactory *phyListFactory = FSLPhysListFactory::GetInstance();
     G4VModularPhysicsList *physList = phyListFactory->GetPhysList(parPhysListName);
     G4bool activateRegions = phyListFactory->GetActivateRegionsFlag();
+    G4bool autoWoodcockRegion = phyListFactory->GetAutoWoodcockRegionFlag();
     
     // register the final version of the physics list in the run manager
     runManager->SetUserInitialization(physList);
@@ -176,6 +177,7 @@ int main(int argc, char** argv) {
     
     if (parRunOverlapCheck) detector->SetRunOverlapCheck(true);
     if (activateRegions)    detector->SetAddRegions(true);
+    if (autoWoodcockRegion) detector->SetAutoWoodcockRegion(true);
     
     // 3. User action
     if(!isBatch && simConfig::fsl.userActions.size()>0) parIsCustomUserActions = true;
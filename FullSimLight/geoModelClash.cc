@@ -26,6 +26,8 @@ G4String rootVolumeName = "";
 G4String reportFileName = "gmclash_report.json";
 G4double tolerance = 0.0;
 G4int numberOfPoints = 1000;
+G4int numberOfThreads = 0;
+G4bool useSisterIndex = true;
 G4int numberOfVolumes = 1;
 G4int numberOfLevels = 1;
 
@@ -36,6 +38,8 @@ struct option options[] = {
     {"verbose output "                   , no_argument      , 0, 'v'},
     {"tolerance threshold value "        , required_argument, 0, 't'},
     {"numebr of random points "          , required_argument, 0, 'n'},
+    {"number of threads "                , required_argument, 0, 'j'},
+    {"check all the sister volumes "     , no_argument      , 0, 'b'},
     {"help "                             , no_argument      , 0, 'h'},
     {0, 0, 0, 0}
 };
@@ -59,6 +63,8 @@ int main(int argc, char** argv) {
     << "  Output clashes report file name  =  " << (reportFileName == "" ? "no report"  : reportFileName) << G4endl
     << "  Number of random points          =  " << numberOfPoints                                         << G4endl
     << "  Tolerance threshold value (mm)   =  " << tolerance                                              << G4endl
+    << "  Number of threads                =  " << (numberOfThreads == 0 ? "serial" : std::to_string(numberOfThreads)) << G4endl
+    << "  Sister volumes checked           =  " << (useSisterIndex ? "indexed" : "all")                   << G4endl
     << "  Verbose output                   =  " << (gmclash_verbose ? "on" : "off")                       << G4endl
     << "=============================================================="                                   << G4endl;
 
@@ -113,6 +119,8 @@ int main(int argc, char** argv) {
   clashDetector.SetResolution(numberOfPoints);
   clashDetector.SetTolerance(tolerance);
   clashDetector.SetGMClashVerbosity(gmclash_verbose);
+  clashDetector.SetNumberOfThreads(numberOfThreads);
+  clashDetector.SetUseSisterIndex(useSisterIndex);
 
   G4Timer fTimer;
   fTimer.Start();
@@ -199,6 +207,8 @@ void Help() {
          << "      -o :   [OPTIONAL] clashes report file name (default: gmclash_report.json)\n"
          << "      -t :   [OPTIONAL] tolerance threshold value in mm (default: 0)\n"
          << "      -n :   [OPTIONAL] number of random points (default: 1000)\n"
+         << "      -j :   [OPTIONAL] number of threads, the report does not depend on it (default: 0, serial check)\n"
+         << "      -b :   [OPTIONAL] check all the sister volumes, without the bounding box index; the report is the same (default: off)\n"
          << "      -v :   [OPTIONAL] verbose output (default: off)\n"
          << G4endl;
   G4cout << "\nUsage: ./gmclash [OPTIONS]\n" << G4endl;
@@ -220,7 +230,7 @@ void GetInputArguments(int argc, char** argv) {
   }
   while (true) {
     int c, optidx = 0;
-    c = getopt_long(argc, argv, "g:r:o:t:n:vh", options, &optidx);
+    c = getopt_long(argc, argv, "g:r:o:t:n:j:bvh", options, &optidx);
     if (c == -1) break;
 
     switch (c) {
@@ -244,6 +254,13 @@ void GetInputArguments(int argc, char** argv) {
       if (numberOfPoints < 100) numberOfPoints = 100;
       if (numberOfPoints > 100000) numberOfPoints = 100000;
       break;
+    case 'j':
+      numberOfThreads = atoi(optarg);
+      if (numberOfThreads < 0) numberOfThreads = 0;
+      break;
+    case 'b':
+      useSisterIndex = false;
+      break;
     case 'r':
       rootVolumeName = optarg;
       break;
@@ -41,12 +41,27 @@ public:
   void SetGMClashVerbosity(G4bool flag) { fVerbosity = flag; }
   void SetResolution(G4int resolution) { fResolution = resolution; }
   void SetTolerance(G4double tolerance) { fTolerance = tolerance; }
+  // Check the daughters of the distinct logical volumes in parallel,
+  // with the given number of threads; 0 (default) selects the serial check
+  void SetNumberOfThreads(G4int nthreads) { fNumberOfThreads = nthreads; }
+  // Select the sisters to check with the index of their bounding boxes
+  // (default), or check all of them; the report is the same either way
+  void SetUseSisterIndex(G4bool flag) { fUseSisterIndex = flag; }
   G4int NumberOfChecks() const { return fNumberOfChecks; }
   G4int NumberOfClashes() const { return jlist.size(); }
   void PrintOutReport(const G4String& reportFileName) const;
 
 private:
 
+  // Parallel version of CheckOverlapsInTree(): the checks of the daughters
+  // of each distinct logical volume are independent tasks, shared among
+  // the threads. Each check uses a random engine, and a G4QuickRand state
+  // for the surface points of the solids, seeded from the current seed
+  // and the position of the volume in the tree, and the clashes of
+  // the tasks are merged in the order of the serial check, so that the
+  // report does not depend on the number of threads.
+  void CheckOverlapsInParallel(const G4VPhysicalVolume* root);
+
   // Find the path from World volume to target volume
   void setPath(const G4VPhysicalVolume* target);
 
@@ -70,6 +85,25 @@ private:
   // Returns true if the volume is overlapping.
   bool CheckOverlaps(const G4VPhysicalVolume* volume);
 
+  // Broad phase of the checks with the sister volumes: the bounding boxes
+  // of the daughters of a mother volume, in the mother coordinate system,
+  // are indexed by a bounding volume hierarchy (BVH), which is kept until
+  // the daughters of another mother volume are checked.
+  void buildSisterIndex(const G4LogicalVolume* mother);
+
+  // Find the daughters of the indexed mother whose bounding boxes overlap
+  // the box [pmin, pmax]; the daughters are returned in increasing order
+  void findSisterCandidates(const G4ThreeVector& pmin, const G4ThreeVector& pmax,
+                            std::vector<G4int>& candidates) const;
+
+  struct BVHNode
+  {
+    G4ThreeVector pmin, pmax;
+    G4int first = 0, count = 0;      // range in fSisterOrder, for the leaves
+    G4int left = -1, right = -1;     // children, for the inner nodes
+  };
+  G4int buildSisterNode(G4int first, G4int count);
+
 private:
 
   std::vector<const G4VPhysicalVolume*> fPath;
@@ -79,6 +113,14 @@ private:
   G4int fResolution = 1000;
   G4double fTolerance = 0.;
   G4int fNumberOfChecks = 0;
+  G4int fNumberOfThreads = 0;
+  G4bool fUseSisterIndex = true;
+
+  const G4LogicalVolume* fIndexedMother = nullptr;
+  std::vector<G4ThreeVector> fSisterMin, fSisterMax;
+  std::vector<G4int> fSisterOrder;
+  std::vector<BVHNode> fSisterNodes;
+  std::vector<G4int> fSisterCandidates;
 
 }; // ClashDetector
 
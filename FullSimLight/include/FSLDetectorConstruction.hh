@@ -45,6 +45,10 @@ public:
   void SetGDMLFileName  (const G4String &gdmlfile)   { fGeometryFileName = gdmlfile;}
   void SetRunOverlapCheck(const bool runOvCheck)     { fRunOverlapCheck = runOvCheck; }
   void SetAddRegions(const bool addRegions)          { fAddRegions = addRegions; }     
+  /// Select the Woodcock tracking region from the geometry and report it
+  void SetReportWoodcockRegions(const bool report)   { fReportWoodcockRegions = report; }
+  /// Also create the selected region, for the FTFP_BERT_ATL_WDCK_AUTO physics list
+  void SetAutoWoodcockRegion(const bool autoRegion)  { fAutoWoodcockRegion = autoRegion; }
   void SetRunMassCalculator(const bool runMassCalc)  { fRunMassCalculator = runMassCalc; }
   void SetVerbosity(const int verbosity)            { fVerbosityFlag = verbosity; }
   void SetGeometryFileName(const G4String &geometryFileName) { fGeometryFileName = geometryFileName; }
@@ -103,6 +107,8 @@ private:
   G4bool   fRunOverlapCheck;
   G4bool   fRunMassCalculator;
   G4bool   fAddRegions;
+  G4bool   fReportWoodcockRegions;
+  G4bool   fAutoWoodcockRegion;
   G4int    fVerbosityFlag;
   G4bool   fDumpGDML;
   G4double fMinStep;
@@ -26,6 +26,7 @@ private:
   G4UIcmdWithADoubleAndUnit* theFieldCommand;
   G4UIcmdWithAString*        theGDMLCommand;
   G4UIcmdWithoutParameter*   theRegionCommand;
+  G4UIcmdWithoutParameter*   theWoodcockReportCommand;
 
 };
 
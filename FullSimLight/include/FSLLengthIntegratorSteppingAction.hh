@@ -17,6 +17,8 @@
 
 #include <string>
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 //G4AnalysisManager
 #include "FSLAnalysis.hh"
@@ -25,6 +27,8 @@
 //class TProfile;
 //class TProfile2D;
 class FSLRunAction;
+class G4LogicalVolume;
+class G4Material;
 
 
 namespace G4UA
@@ -61,47 +65,81 @@ namespace G4UA
       // Holder for G4 math tools
       G4Pow* m_g4pow;
 
-      // Add elements and values into the map
-      void addToDetThickMap(std::string, double, double);
+      /// The names used as keys of the thickness map and of the profiles are
+      /// interned once: on the stepping path they are only referred to by
+      /// their integer index in the key tables below.
+      G4int internKey(const std::string& name);
+
+      /// The keys of a material, resolved when the material is first met
+      struct MaterialKeys
+      {
+        G4bool resolved = false;
+        /// "M_<material>"
+        G4int material = -1;
+        /// "M_<material>", or "M_<category>" for the special materials, used for the maps
+        G4int plot = -1;
+        /// "E_<element>" and "ME_<material>_<element>", for each element of the material
+        std::vector<G4int> elements;
+        std::vector<G4int> materialElements;
+      };
+
+      /// The keys of a logical volume, resolved when the volume is first met
+      struct VolumeKeys
+      {
+        G4bool resolved = false;
+        /// "D_<detector>", the detector being the volume name up to "::"
+        G4int detector = -1;
+        /// "DM_<detector>_<material>"
+        G4int detectorMaterial = -1;
+        /// "DE_<detector>_<element>", for each element of the material
+        std::vector<G4int> detectorElements;
+      };
+
+      /// The keys of a material / logical volume, indexed by the material
+      /// index and the logical volume instance ID
+      const MaterialKeys& getMaterialKeys(const G4Material* mat);
+      const VolumeKeys& getVolumeKeys(const G4LogicalVolume* lv);
+
+      /// Add values to the thickness of a key, for the current event
+      void addToDetThick(G4int key, double thickstepRL, double thickstepIL);
 
       /// this method checks if a histo is on THsvc already and caches a local pointer to it
       /// if the histo is not present, it creates and registers it
       G4int getOrCreateProfile_g4(G4String regName, G4String histoname, G4String xtitle, int nbinsx, float xmin, float xmax,G4String ytitle, int nbinsy,float ymin, float ymax,G4String ztitle);
 
   public:
-      // TO DO: make it private again and add GetDetThickMap method
       /// Map of detector thickness measurements for current event
-      std::map<std::string, std::pair<double, double> > m_detThickMap;
+      const std::map<std::string, std::pair<double, double> >& GetDetThickMap();
+      /// Reset the detector thickness measurements, at the beginning of an event
+      void ClearDetThickMap();
+
   private:
       /// Pointer to the FSLRunAction, needed to create new Profiles
       FSLRunAction* m_run;
       GeantinoMapsConfigurator* fGeantinoMapsConfig;
 
-      
-      
-//      /// Rad-length profile hist in R-Z - ROOT
-//      TProfile2D* m_rzProfRL;
-//      /// Int-length profile hist in R-Z - ROOT
-//      TProfile2D* m_rzProfIL;
-      
-      /// Rad-length profile hist in R-Z - Geant4  -- taken from the runAction
-      //G4int m_rzProfRL_id;
-      /// Int-length profile hist in R-Z  - Geant4 -- taken from the runAction
-      //G4int m_rzProfIL_id;
-      
-//      // 2D plots of rad-length and int-length - ROOT
-//      std::map<std::string,TProfile2D*,std::less<std::string> > m_rzMapRL;
-//      std::map<std::string,TProfile2D*,std::less<std::string> > m_xyMapRL;
-//      
-//      std::map<std::string,TProfile2D*,std::less<std::string> > m_rzMapIL;
-//      std::map<std::string,TProfile2D*,std::less<std::string> > m_xyMapIL;
-      
-      // 2D plots of rad-length and int-length - Geant4
-      std::map<std::string,G4int,std::less<std::string> > m_rzMapRL_g4;
-      std::map<std::string,G4int,std::less<std::string> > m_xyMapRL_g4;
-      
-      std::map<std::string,G4int,std::less<std::string> > m_rzMapIL_g4;
-      std::map<std::string,G4int,std::less<std::string> > m_xyMapIL_g4;
+      /// The interned keys: their names and their indices
+      std::vector<std::string> m_keyNames;
+      std::unordered_map<std::string, G4int> m_keyIds;
+      G4int m_totalKey;
+
+      std::vector<MaterialKeys> m_materialKeys;
+      std::vector<VolumeKeys> m_volumeKeys;
+
+      /// Detector thickness (rad length, int length) of each key for the current
+      /// event, and the keys which have been filled
+      std::vector<std::pair<double, double> > m_detThick;
+      std::vector<char> m_detThickFilled;
+      std::vector<G4int> m_detThickKeys;
+      /// Sorted view of the thicknesses of the current event, built on request
+      std::map<std::string, std::pair<double, double> > m_detThickMap;
+
+      // 2D plots of rad-length and int-length - Geant4, indexed by key, -1 if not created yet
+      std::vector<G4int> m_rzMapRL_g4;
+      std::vector<G4int> m_xyMapRL_g4;
+
+      std::vector<G4int> m_rzMapIL_g4;
+      std::vector<G4int> m_xyMapIL_g4;
 
   }; // class FSLLengthIntegratorSteppingAction
 
@@ -19,12 +19,15 @@ public:
     static G4VModularPhysicsList *GetPhysList(const std::string physListNameOrPluginPath);
 
     static bool GetActivateRegionsFlag() {return fActivateRegionsFlag;}
+    // true if the Woodcock region is to be selected from the geometry
+    static bool GetAutoWoodcockRegionFlag() {return fAutoWoodcockRegionFlag;}
 
     static const FSLPhysListFactory* GetInstance();
 
 private:
 
     static bool fActivateRegionsFlag;
+    static bool fAutoWoodcockRegionFlag;
     
     static std::unique_ptr<FSLPhysListFactory> fgInstance;
 };
@@ -0,0 +1,128 @@
+/*
+  Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+*/
+
+#ifndef WoodcockRegionAnalyser_h
+#define WoodcockRegionAnalyser_h 1
+
+#include "G4Types.hh"
+#include "G4String.hh"
+
+#include <iosfwd>
+#include <map>
+#include <set>
+#include <vector>
+
+class G4LogicalVolume;
+class G4Material;
+class G4VPhysicalVolume;
+
+/**
+ * @file    WoodcockRegionAnalyser.hh
+ *
+ * Selection of the detector region for Woodcock tracking from the geometry.
+ *
+ * Woodcock tracking pays off in subtrees with many volume boundaries and
+ * materials of similar attenuation (e.g. sampling calorimeters): a photon then
+ * makes one step per interaction with the heaviest material of the region
+ * instead of one step per boundary and per interaction. The analyser walks the
+ * logical volume tree (as the `MassCalculator` does) and, for each subtree,
+ * estimates per unit photon path length:
+ *  - the boundary crossings, from the number of volumes N in the subtree and
+ *    its volume V, as 1/(V/N)^(1/3);
+ *  - the interactions, from the volume averaged electron density and the
+ *    Klein-Nishina cross section at a reference energy (Compton scattering
+ *    dominates the attenuation around 1 MeV);
+ *  - the Woodcock steps, from the electron density of the densest material
+ *    (the `WoodcockProcess` samples the steps in the heaviest material).
+ * The ratio of the steps of the normal and of the Woodcock tracking is the
+ * expected gain. The largest subtrees whose gain passes the threshold are
+ * proposed as root logical volumes of a Woodcock region, taking into account
+ * that all of them share the densest material of the region.
+ *
+ * `Analyse` must be invoked at the end of `FSLDetectorConstruction::Construct`,
+ * after the other detector regions are created: the subtrees which lie inside
+ * the subtree of a root logical volume of a region, or contain one, are not
+ * proposed.
+ */
+
+class WoodcockRegionAnalyser {
+
+public:
+
+  WoodcockRegionAnalyser();
+  ~WoodcockRegionAnalyser() = default;
+  WoodcockRegionAnalyser(const WoodcockRegionAnalyser&) = delete;
+  WoodcockRegionAnalyser& operator=(const WoodcockRegionAnalyser&) = delete;
+
+  // photon energy at which the attenuations are compared
+  void SetReferenceEnergy(G4double energy) { fReferenceEnergy = energy; }
+  // minimum ratio of the normal and Woodcock steps of a proposed subtree
+  void SetMinGain(G4double gain) { fMinGain = gain; }
+  // minimum ratio of the average and maximum attenuation of a proposed subtree
+  void SetMinHomogeneity(G4double homogeneity) { fMinHomogeneity = homogeneity; }
+  // minimum number of volumes of a proposed subtree
+  void SetMinVolumes(G4double nVolumes) { fMinVolumes = nVolumes; }
+
+  // Scores the subtrees of the world and selects the Woodcock root volumes
+  void Analyse(const G4VPhysicalVolume* world);
+
+  // The selected root logical volumes, empty if none passes the thresholds
+  const std::vector<G4LogicalVolume*>& GetRootLogicalVolumes() const { return fSelected; }
+
+  // Creates the region `name` with the selected root logical volumes: to be
+  // used as the Woodcock region of the `StandardEmWithWoodcock` physics.
+  // Returns false (and creates nothing) if no subtree was selected.
+  G4bool CreateRegion(const G4String& name) const;
+
+  // Prints the selected subtrees and the expected step savings
+  void PrintReport(std::ostream& out) const;
+
+  // Name of the region created in the `FTFP_BERT_ATL_WDCK_AUTO` configuration
+  static const G4String& GetAutoRegionName();
+
+private:
+
+  // properties of the subtree of a logical volume
+  struct SubtreeData {
+    G4double fVolume;          // volume of the solid
+    G4double fNumVolumes;      // number of volumes, the root included
+    G4double fElectrons;       // number of electrons
+    const G4Material* fDensest;// the densest material
+    G4bool   fInRegion;        // contains a volume of a configured region
+  };
+
+  // estimated photon steps per unit length of a subtree, with the Woodcock
+  // steps sampled in `densest`
+  struct Score {
+    G4double fNormalSteps;
+    G4double fWoodcockSteps;
+    G4double fHomogeneity;
+    G4double Gain() const { return fWoodcockSteps > 0.0 ? fNormalSteps/fWoodcockSteps : 0.0; }
+  };
+
+  const SubtreeData& GetSubtreeData(const G4LogicalVolume* lv);
+  Score ComputeScore(const SubtreeData& data, const G4Material* densest) const;
+  G4bool IsCandidate(const G4LogicalVolume* lv, const SubtreeData& data, const Score& score) const;
+  void CollectSubtree(const G4LogicalVolume* lv, std::set<const G4LogicalVolume*>& subtree) const;
+  void SelectCandidates(const G4LogicalVolume* lv, std::set<const G4LogicalVolume*>& visited);
+  const G4Material* GetRegionDensest() const;
+
+private:
+
+  G4double fReferenceEnergy;
+  G4double fMinGain;
+  G4double fMinHomogeneity;
+  G4double fMinVolumes;
+  // Klein-Nishina cross section per electron at the reference energy
+  G4double fCrossSectionPerElectron;
+
+  const G4LogicalVolume*  fWorldLV;
+  // the logical volumes in the subtrees of the root volumes of the regions
+  std::set<const G4LogicalVolume*> fRegionLVs;
+  std::map<const G4LogicalVolume*, SubtreeData> fSubtreeData;
+  std::vector<G4LogicalVolume*> fSelected;
+
+}; // WoodcockRegionAnalyser
+
+#endif // WoodcockRegionAnalyser_h 1
@@ -2,13 +2,21 @@
 #include "GeoModelKernel/GeoVolumeCursor.h"
 
 #include "G4AffineTransform.hh"
+#include "G4Exception.hh"
+#include "G4QuickRand.hh"
 #include "G4SystemOfUnits.hh"
 #include "G4UnitsTable.hh"
 #include "G4Version.hh"
 #include "G4VisExtent.hh"
+#include "Randomize.hh"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
 #include <queue>
 #include <set>
+#include <thread>
 
 namespace clashdet
 {
@@ -54,6 +62,32 @@ namespace clashdet
     p.z=j.at("z").get<double>();
     p.distance=j.at("distance[mm]").get<double>();
   }
+
+  // serializes the messages of the threads of the parallel check
+  std::mutex printMutex;
+
+  // seed of the check of a volume: the 'index'-th volume checked in 'task'
+  long volumeSeed(long seed, size_t task, size_t index)
+  {
+    // splitmix64 finalizer
+    uint64_t z = uint64_t(seed) + 0x9e3779b97f4a7c15ULL*(1 + (uint64_t(task) << 32) + index);
+    z = (z ^ (z >> 30))*0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27))*0x94d049bb133111ebULL;
+    z = z ^ (z >> 31);
+    return long(z >> 33);
+  }
+
+  // seeds G4QuickRand, the thread-local generator of the surface points
+  // of the solids, for the check of a volume
+  void seedQuickRand(long seed)
+  {
+#if G4VERSION_NUMBER>=1110
+    const uint32_t quickSeed = uint32_t(seed);
+    G4QuickRand(quickSeed != 0 ? quickSeed : 2463534242u);  // a zero seed is ignored
+#else
+    (void) seed;
+#endif
+  }
 } // namespace clashdet
 
 ClashDetector::ClashDetector(const G4VPhysicalVolume* world) : fWorld(world) {}
@@ -77,10 +111,21 @@ void ClashDetector::PrintOutReport(const G4String& reportFileName) const
 
 void ClashDetector::CheckOverlapsInTree(const G4VPhysicalVolume* root)
 {
+  if (fNumberOfThreads > 0)
+  {
+    CheckOverlapsInParallel(root);
+    return;
+  }
+
   std::queue<const G4VPhysicalVolume*> volumes;
   std::set<const G4LogicalVolume*> checked;
 
+  // the surface points are seeded per volume, as in the parallel check
+  const long seed = G4Random::getTheSeed();
+  size_t task = 0;
+
   volumes.push(((root == nullptr) ? fWorld : root));
+  clashdet::seedQuickRand(clashdet::volumeSeed(seed, task, 0));
   CheckOverlaps(volumes.front());
 
   while (!volumes.empty())
@@ -94,8 +139,10 @@ void ClashDetector::CheckOverlapsInTree(const G4VPhysicalVolume* root)
     for (G4int i=0; i<ndaughters; ++i)
     {
       const G4VPhysicalVolume* daughter = logical->GetDaughter(i);
+      clashdet::seedQuickRand(clashdet::volumeSeed(seed, task, i + 1));
       CheckOverlaps(daughter);
     }
+    ++task;
 
     // append the queue of volumes
     const G4LogicalVolume* previousLogical = nullptr;
@@ -125,6 +172,107 @@ void ClashDetector::CheckOverlapsInTree(const G4VPhysicalVolume* root)
   }
 }
 
+//////////////////////////////////////////////////////////////////////////
+//
+// Check overlaps in the tree of volumes, using several threads
+
+void ClashDetector::CheckOverlapsInParallel(const G4VPhysicalVolume* root)
+{
+  // Collect the volumes whose daughters are checked,
+  // in the same order and with the same omissions as the serial check
+  std::vector<const G4VPhysicalVolume*> mothers;
+  std::set<const G4LogicalVolume*> checked;
+  mothers.push_back((root == nullptr) ? fWorld : root);
+  for (size_t m = 0; m < mothers.size(); ++m)
+  {
+    const G4LogicalVolume* logical = mothers[m]->GetLogicalVolume();
+    G4int ndaughters = logical->GetNoDaughters();
+    const G4LogicalVolume* previousLogical = nullptr;
+    for (G4int i=0; i<ndaughters; ++i)
+    {
+      const G4VPhysicalVolume* daughter = logical->GetDaughter(i);
+      const G4LogicalVolume* daughterLogical = daughter->GetLogicalVolume();
+      if (daughterLogical->GetNoDaughters() == 0) continue;
+      G4bool found = (daughterLogical == previousLogical);
+      if (!found) found = (checked.find(daughterLogical) != checked.cend());
+      if (!found)
+      {
+        checked.emplace(daughterLogical);
+        previousLogical = daughterLogical;
+        mothers.push_back(daughter);
+      }
+      else if (fVerbosity)
+      {
+        G4cout << "************* Checking overlaps in tree of volume "
+               << daughter->GetName() << ':' << daughter->GetCopyNo()
+               << " is omitted, to avoid duplication" << G4endl;
+      }
+    }
+  }
+
+  G4int nthreads = std::min<G4int>(fNumberOfThreads, mothers.size());
+#ifndef G4MULTITHREADED
+  // the random engine is shared by all the threads in sequential Geant4 builds
+  if (nthreads > 1)
+  {
+    G4Exception("ClashDetector::CheckOverlapsInParallel()", "GeomVol1002", JustWarning,
+                "Geant4 is built without multithreading, the clashes are checked in one thread");
+  }
+  nthreads = 1;
+#endif
+
+  // Task t checks the daughters of mothers[t], the first one checks the root as well
+  const long seed = G4Random::getTheSeed();
+  std::vector<std::vector<json>> clashes(mothers.size());
+  std::vector<G4int> numberOfChecks(nthreads, 0);
+  std::atomic<size_t> nextTask{0};
+  auto worker = [&](G4int thread)
+  {
+    CLHEP::HepRandomEngine* previousEngine = G4Random::getTheEngine();
+    CLHEP::MixMaxRng engine;
+    G4Random::setTheEngine(&engine);
+
+    ClashDetector detector(fWorld);
+    detector.SetGMClashVerbosity(fVerbosity);
+    detector.SetResolution(fResolution);
+    detector.SetTolerance(fTolerance);
+    detector.SetUseSisterIndex(fUseSisterIndex);
+    for (size_t t = nextTask++; t < mothers.size(); t = nextTask++)
+    {
+      if (t == 0)
+      {
+        G4Random::setTheSeed(clashdet::volumeSeed(seed, t, 0));
+        clashdet::seedQuickRand(clashdet::volumeSeed(seed, t, 0));
+        detector.CheckOverlaps(mothers[0]);
+      }
+      const G4LogicalVolume* logical = mothers[t]->GetLogicalVolume();
+      G4int ndaughters = logical->GetNoDaughters();
+      for (G4int i=0; i<ndaughters; ++i)
+      {
+        G4Random::setTheSeed(clashdet::volumeSeed(seed, t, i + 1));
+        clashdet::seedQuickRand(clashdet::volumeSeed(seed, t, i + 1));
+        detector.CheckOverlaps(logical->GetDaughter(i));
+      }
+      clashes[t].swap(detector.jlist);
+    }
+    numberOfChecks[thread] = detector.fNumberOfChecks;
+    G4Random::setTheEngine(previousEngine);
+  };
+
+  std::vector<std::thread> threads;
+  for (G4int thread = 0; thread < nthreads; ++thread)
+  {
+    threads.emplace_back(worker, thread);
+  }
+  for (std::thread& thread : threads) thread.join();
+
+  for (const std::vector<json>& taskClashes : clashes)
+  {
+    jlist.insert(jlist.end(), taskClashes.begin(), taskClashes.end());
+  }
+  for (G4int n : numberOfChecks) fNumberOfChecks += n;
+}
+
 //////////////////////////////////////////////////////////////////////////
 //
 // Find a path from World volume to target volume
@@ -183,6 +331,7 @@ void ClashDetector::reportOverlap(G4int overlapType,
 {
   // Set clash type
   clashdet::typeOfClash clashType = clashdet::typeOfClash(overlapType);
+  std::lock_guard<std::mutex> lock(clashdet::printMutex);
 
   // Print out a message
   if (clashType == clashdet::withMother)
@@ -355,7 +504,27 @@ bool ClashDetector::CheckOverlaps(const G4VPhysicalVolume* volume)
   G4VSolid* previous = nullptr;
   G4ThreeVector pmin_local(0.,0.,0.), pmax_local(0.,0.,0.);
 
-  for (size_t k = 0; k < motherLog->GetNoDaughters(); ++k)
+  // Only the sisters whose bounding boxes overlap the bounding box
+  // of the sample points need to be checked: find them in the index
+  // of the bounding boxes, instead of looping over all the daughters
+  //
+  // The index only drops the sisters that the bounding box test below
+  // would reject, so the sisters reaching the random surface point of the
+  // encapsulation test, and the report, do not depend on it
+  //
+  if (fUseSisterIndex)
+  {
+    if (fIndexedMother != motherLog) buildSisterIndex(motherLog);
+    findSisterCandidates(G4ThreeVector(xmin, ymin, zmin), G4ThreeVector(xmax, ymax, zmax),
+                         fSisterCandidates);
+  }
+  else
+  {
+    fSisterCandidates.resize(motherLog->GetNoDaughters());
+    for (size_t k = 0; k < fSisterCandidates.size(); ++k) fSisterCandidates[k] = k;
+  }
+
+  for (G4int k : fSisterCandidates)
   {
     G4VPhysicalVolume* sister = motherLog->GetDaughter(k);
     if (sister == volume) continue;
@@ -553,3 +722,154 @@ bool ClashDetector::CheckOverlaps(const G4VPhysicalVolume* volume)
   }
   return false;
 }
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Index the bounding boxes of the daughters of the mother volume
+
+void ClashDetector::buildSisterIndex(const G4LogicalVolume* mother)
+{
+  fIndexedMother = mother;
+  const G4int ndaughters = mother->GetNoDaughters();
+  fSisterMin.resize(ndaughters);
+  fSisterMax.resize(ndaughters);
+  fSisterOrder.resize(ndaughters);
+  fSisterNodes.clear();
+
+  // The boxes are computed as in CheckOverlaps(), so that they are
+  // never smaller than the ones used there
+  const G4VSolid* previous = nullptr;
+  G4ThreeVector pmin_local(0.,0.,0.), pmax_local(0.,0.,0.);
+  for (G4int k = 0; k < ndaughters; ++k)
+  {
+    const G4VPhysicalVolume* sister = mother->GetDaughter(k);
+    const G4VSolid* sisterSolid = sister->GetLogicalVolume()->GetSolid();
+    if (previous != sisterSolid)
+    {
+#if G4VERSION_NUMBER>=1040
+      sisterSolid->BoundingLimits(pmin_local, pmax_local);
+#else
+      G4VisExtent extent = sisterSolid->GetExtent();
+      pmin_local.set(extent.GetXmin(),extent.GetYmin(),extent.GetZmin());
+      pmax_local.set(extent.GetXmax(),extent.GetYmax(),extent.GetZmax());
+#endif
+      previous = sisterSolid;
+    }
+    G4AffineTransform Tsister_mother(sister->GetRotation(), sister->GetTranslation());
+    if (!Tsister_mother.IsRotated())
+    {
+      G4ThreeVector offset = Tsister_mother.NetTranslation();
+      fSisterMin[k] = pmin_local + offset;
+      fSisterMax[k] = pmax_local + offset;
+    }
+    else
+    {
+      G4ThreeVector dmin( kInfinity,  kInfinity,  kInfinity);
+      G4ThreeVector dmax(-kInfinity, -kInfinity, -kInfinity);
+      for (G4int i = 0; i < 8; ++i)
+      {
+        G4ThreeVector corner((i & 1) ? pmax_local.x() : pmin_local.x(),
+                             (i & 2) ? pmax_local.y() : pmin_local.y(),
+                             (i & 4) ? pmax_local.z() : pmin_local.z());
+        G4ThreeVector p = Tsister_mother.TransformPoint(corner);
+        dmin.set(std::min(dmin.x(), p.x()), std::min(dmin.y(), p.y()), std::min(dmin.z(), p.z()));
+        dmax.set(std::max(dmax.x(), p.x()), std::max(dmax.y(), p.y()), std::max(dmax.z(), p.z()));
+      }
+      fSisterMin[k] = dmin;
+      fSisterMax[k] = dmax;
+    }
+    fSisterOrder[k] = k;
+  }
+  if (ndaughters > 0) buildSisterNode(0, ndaughters);
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Build the BVH node of the daughters fSisterOrder[first, first + count),
+// splitting them at the median of the longest axis
+
+G4int ClashDetector::buildSisterNode(G4int first, G4int count)
+{
+  constexpr G4int leafSize = 4;
+  const G4int index = fSisterNodes.size();
+  fSisterNodes.emplace_back();
+
+  G4ThreeVector pmin( kInfinity,  kInfinity,  kInfinity);
+  G4ThreeVector pmax(-kInfinity, -kInfinity, -kInfinity);
+  G4ThreeVector cmin( kInfinity,  kInfinity,  kInfinity);
+  G4ThreeVector cmax(-kInfinity, -kInfinity, -kInfinity);
+  for (G4int i = first; i < first + count; ++i)
+  {
+    const G4int k = fSisterOrder[i];
+    const G4ThreeVector center = 0.5*(fSisterMin[k] + fSisterMax[k]);
+    for (G4int axis = 0; axis < 3; ++axis)
+    {
+      pmin[axis] = std::min(pmin[axis], fSisterMin[k][axis]);
+      pmax[axis] = std::max(pmax[axis], fSisterMax[k][axis]);
+      cmin[axis] = std::min(cmin[axis], center[axis]);
+      cmax[axis] = std::max(cmax[axis], center[axis]);
+    }
+  }
+  fSisterNodes[index].pmin = pmin;
+  fSisterNodes[index].pmax = pmax;
+  if (count <= leafSize)
+  {
+    fSisterNodes[index].first = first;
+    fSisterNodes[index].count = count;
+    return index;
+  }
+
+  G4ThreeVector extent = cmax - cmin;
+  G4int axis = (extent.x() > extent.y()) ? 0 : 1;
+  if (extent.z() > extent[axis]) axis = 2;
+  const G4int half = count/2;
+  std::nth_element(fSisterOrder.begin() + first, fSisterOrder.begin() + first + half,
+                   fSisterOrder.begin() + first + count,
+                   [this, axis](G4int a, G4int b)
+                   {
+                     return fSisterMin[a][axis] + fSisterMax[a][axis] <
+                            fSisterMin[b][axis] + fSisterMax[b][axis];
+                   });
+  const G4int left = buildSisterNode(first, half);
+  const G4int right = buildSisterNode(first + half, count - half);
+  fSisterNodes[index].left = left;
+  fSisterNodes[index].right = right;
+  return index;
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Find the daughters whose bounding boxes overlap the box [pmin, pmax]
+
+void ClashDetector::findSisterCandidates(const G4ThreeVector& pmin,
+                                         const G4ThreeVector& pmax,
+                                         std::vector<G4int>& candidates) const
+{
+  candidates.clear();
+  if (fSisterNodes.empty()) return;
+  auto overlaps = [&pmin, &pmax](const G4ThreeVector& bmin, const G4ThreeVector& bmax)
+  {
+    return bmin.x() <= pmax.x() && bmin.y() <= pmax.y() && bmin.z() <= pmax.z() &&
+           bmax.x() >= pmin.x() && bmax.y() >= pmin.y() && bmax.z() >= pmin.z();
+  };
+  std::vector<G4int> stack = { 0 };
+  while (!stack.empty())
+  {
+    const BVHNode& node = fSisterNodes[stack.back()];
+    stack.pop_back();
+    if (!overlaps(node.pmin, node.pmax)) continue;
+    if (node.left < 0)
+    {
+      for (G4int i = node.first; i < node.first + node.count; ++i)
+      {
+        const G4int k = fSisterOrder[i];
+        if (overlaps(fSisterMin[k], fSisterMax[k])) candidates.push_back(k);
+      }
+      continue;
+    }
+    stack.push_back(node.left);
+    stack.push_back(node.right);
+  }
+  // the sisters are checked in the order of the daughters, as without the index
+  std::sort(candidates.begin(), candidates.end());
+}
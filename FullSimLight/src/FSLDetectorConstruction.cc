@@ -5,6 +5,7 @@
 #include "FSLDetectorConstruction.hh"
 #include "FSLDetectorMessenger.hh"
 #include "RegionConfigurator.hh"
+#include "WoodcockRegionAnalyser.hh"
 #include "FullSimLight/MagFieldPlugin.h"
 #include "MassCalculator.hh"
 #include "ClashDetector.hh"
@@ -101,6 +102,8 @@ FSLDetectorConstruction::FSLDetectorConstruction() : fWorld(nullptr), fDetectorM
   fRunOverlapCheck     = false;
   fRunMassCalculator   = false;
   fAddRegions          = false;
+  fReportWoodcockRegions = false;
+  fAutoWoodcockRegion  = false;
   fDumpGDML            = false;
   fReportFileName      = "gmclash_report.json";
   fMinStep             = 1.0e-2;
@@ -149,6 +152,7 @@ G4VPhysicalVolume *FSLDetectorConstruction::Construct()
 
         std::cout << "Building G4 geometry."<<std::endl;
         envelope = builder->Build(world);
+        builder->GetContext().print(std::cout);
 
         G4VPhysicalVolume* physWorld= new G4PVPlacement(0,G4ThreeVector(),envelope,envelope->GetName(),0,false,0,false);
 
@@ -214,6 +218,7 @@ G4VPhysicalVolume *FSLDetectorConstruction::Construct()
 
         std::cout << "Building G4 geometry."<<std::endl;
         envelope = builder->Build(world);
+        builder->GetContext().print(std::cout);
         G4VPhysicalVolume* physWorld= new G4PVPlacement(0,G4ThreeVector(),envelope,envelope->GetName(),0,false,0,false);
 
         fWorld = physWorld;
@@ -329,6 +334,20 @@ G4VPhysicalVolume *FSLDetectorConstruction::Construct()
         G4cout << "\n ===================  Adding detector regions is DONE!  ================== \n" << G4endl;
     }
 
+    // select the subtrees where Woodcock tracking of the photons is expected
+    // to save steps, after the configured regions which keep their volumes
+    if (fReportWoodcockRegions || fAutoWoodcockRegion)  {
+        G4cout << "\n ===================  Selecting the Woodcock tracking region ... ================== \n" << G4endl;
+        WoodcockRegionAnalyser analyser;
+        analyser.Analyse(fWorld);
+        analyser.PrintReport(G4cout);
+        if (fAutoWoodcockRegion && !analyser.CreateRegion(WoodcockRegionAnalyser::GetAutoRegionName())) {
+            G4cout << " No region " << WoodcockRegionAnalyser::GetAutoRegionName()
+                   << " created: Woodcock tracking will not be used." << G4endl;
+        }
+        G4cout << "\n ===================  Selecting the Woodcock tracking region is DONE!  ================== \n" << G4endl;
+    }
+
     if (fDumpGDML){
 
         G4cout << "\n ===================  Dump geometry in GDML format  =================== \n" << G4endl;
@@ -33,6 +33,10 @@ FSLDetectorMessenger( FSLDetectorConstruction* FSLDet )
   theRegionCommand->SetGuidance( "Try to add detector regions." );
   theRegionCommand->AvailableForStates( G4State_PreInit, G4State_Idle );
 
+  theWoodcockReportCommand = new G4UIcmdWithoutParameter( "/FSLdet/reportWoodcockRegions", this );
+  theWoodcockReportCommand->SetGuidance( "Report the subtrees where Woodcock tracking is expected to save steps." );
+  theWoodcockReportCommand->AvailableForStates( G4State_PreInit );
+
 }
 
 
@@ -40,6 +44,7 @@ FSLDetectorMessenger::~FSLDetectorMessenger() {
   delete theFieldCommand;
   delete theDetectorDir;
   delete theRegionCommand;
+  delete theWoodcockReportCommand;
 }
 
 
@@ -53,5 +58,8 @@ void FSLDetectorMessenger::SetNewValue(G4UIcommand* command, G4String newValue)
   if ( command == theRegionCommand ) {
     theDetector->SetAddRegions( true );
   }
+  if ( command == theWoodcockReportCommand ) {
+    theDetector->SetReportWoodcockRegions( true );
+  }
 
 }
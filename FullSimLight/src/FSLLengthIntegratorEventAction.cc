@@ -110,7 +110,7 @@ namespace G4UA
             
         }
         //clear the detThickMap for the event that begins
-        m_stepAct->m_detThickMap.clear();
+        m_stepAct->ClearDetThickMap();
         G4PrimaryVertex* vert = event->GetPrimaryVertex(0);
         G4PrimaryParticle* part = vert->GetPrimary();
         G4ThreeVector mom = part->GetMomentum();
@@ -139,13 +139,13 @@ namespace G4UA
         // Lazily protect this whole code from concurrent access
         std::lock_guard<std::mutex> lock(gHistSvcMutex);
         
-        //m_stepAct
-        if (m_stepAct->m_detThickMap.size()==0){
+        const std::map<std::string, std::pair<double, double> >& detThickMap = m_stepAct->GetDetThickMap();
+        if (detThickMap.size()==0){
             G4cout<<"ERROR! m_detThickMap size is zero! Exiting"<<G4endl;
             exit(-1);
         }
         // Loop over volumes
-        for (auto& it : m_stepAct->m_detThickMap) {
+        for (auto& it : detThickMap) {
             if(it.first=="Total_X0"){
                 analysisManager->FillP1(m_run->fEtaRad_id, m_etaPrimary, it.second.first, 1.);
                 analysisManager->FillP1(m_run->fEtaInt_id, m_etaPrimary, it.second.second, 1.);
@@ -155,7 +155,7 @@ namespace G4UA
         if(fGeantinoMapsConfig->GetCreateEtaPhiMaps()){
             
             // Loop over volumes
-            for (auto& it : m_stepAct->m_detThickMap) {
+            for (auto& it : detThickMap) {
                 
                 //G4cout<<" ****** Loop over volumes  ****** " <<it.first<<G4endl;
                 //      //ROOT
@@ -47,6 +47,7 @@ namespace G4UA
 
       fGeantinoMapsConfig= GeantinoMapsConfigurator::getGeantinoMapsConf();
       m_g4pow = G4Pow::GetInstance();
+      m_totalKey = internKey("Total_X0");
       
 //    //ROOT
 //    // Protect concurrent access to the non-thread-safe hist svc
@@ -126,7 +127,6 @@ namespace G4UA
         G4TouchableHistory* touchHist =
         (G4TouchableHistory*) aStep->GetPreStepPoint()->GetTouchable();
         G4LogicalVolume* lv = touchHist->GetVolume()->GetLogicalVolume();
-        std::string volName = lv->GetName();
         G4Material* mat = lv->GetMaterial();
         double radl = mat->GetRadlen();
         double intl = mat->GetNuclearInterLength();
@@ -136,17 +136,9 @@ namespace G4UA
         double thickstepRL = radl != 0 ? stepl/radl *100 : DBL_MAX;
         double thickstepIL = intl != 0 ? stepl/intl : DBL_MAX;
         
-        std::string detName;
-        auto colsPos = volName.find("::");
-        if (colsPos != std::string::npos)
-            detName = volName.substr(0, colsPos);
-        else
-            detName=volName;
-        //detName="Generic";
-        
-        std::string matName = "M_" + lv->GetMaterial()->GetName();
-        std::string detName_plus_matName = "DM_" + detName + "_" + lv->GetMaterial()->GetName();
-        std::string detName_d = "D_" + detName;
+        // all the names are resolved once per volume and per material
+        const VolumeKeys& volKeys = getVolumeKeys(lv);
+        const MaterialKeys& matKeys = getMaterialKeys(mat);
         
         double zHit = aStep->GetPreStepPoint()->GetPosition().z();
         double rHit = aStep->GetPreStepPoint()->GetPosition().perp();
@@ -154,24 +146,21 @@ namespace G4UA
 //        std::cout<<"zHit: "<<zHit<<" ::["<<fGeantinoMapsConfig->GetZmin()<<","<<fGeantinoMapsConfig->GetZmax()<<"]"<<std::endl;
 //        std::cout<<"rHit: "<<rHit<<" ::["<<fGeantinoMapsConfig->GetRmin()<<","<<fGeantinoMapsConfig->GetRmax()<<"]"<<std::endl;
         
+        const G4ElementVector* eVec = mat->GetElementVector();
         if(zHit >= fGeantinoMapsConfig->GetZmin() && zHit <= fGeantinoMapsConfig->GetZmax() && rHit >= fGeantinoMapsConfig->GetRmin() && rHit <= fGeantinoMapsConfig->GetRmax()){
-            FSLLengthIntegratorSteppingAction::addToDetThickMap(detName_d,            thickstepRL, thickstepIL);
-            FSLLengthIntegratorSteppingAction::addToDetThickMap(matName,              thickstepRL, thickstepIL);
-            FSLLengthIntegratorSteppingAction::addToDetThickMap(detName_plus_matName, thickstepRL, thickstepIL);
-            FSLLengthIntegratorSteppingAction::addToDetThickMap("Total_X0",           thickstepRL, thickstepIL);
+            addToDetThick(volKeys.detector,         thickstepRL, thickstepIL);
+            addToDetThick(matKeys.material,         thickstepRL, thickstepIL);
+            addToDetThick(volKeys.detectorMaterial, thickstepRL, thickstepIL);
+            addToDetThick(m_totalKey,               thickstepRL, thickstepIL);
             
-            const G4ElementVector* eVec = mat->GetElementVector();
             for (size_t i=0 ; i < mat->GetNumberOfElements() ; ++i)
             {
-                std::string elementName = "E_" + (*eVec)[i]->GetName();
-                std::string matName_plus_elementName = "ME_" + lv->GetMaterial()->GetName() + "_" + (*eVec)[i]->GetName();
-                std::string detName_plus_elementName = "DE_" + detName + "_" + (*eVec)[i]->GetName();
                 double el_thickstepRL = stepl * (mat->GetVecNbOfAtomsPerVolume())[i] * (*eVec)[i]->GetfRadTsai() * 100.0;
                 G4double lambda0 = 35*g/cm2;
                 double el_thickstepIL = stepl * amu/lambda0 * (mat->GetVecNbOfAtomsPerVolume())[i] * m_g4pow->Z23( G4int( (*eVec)[i]->GetN() + 0.5 ) );
-                FSLLengthIntegratorSteppingAction::addToDetThickMap(elementName,              el_thickstepRL, el_thickstepIL);
-                FSLLengthIntegratorSteppingAction::addToDetThickMap(matName_plus_elementName, el_thickstepRL, el_thickstepIL);
-                FSLLengthIntegratorSteppingAction::addToDetThickMap(detName_plus_elementName, el_thickstepRL, el_thickstepIL);
+                addToDetThick(matKeys.elements[i],         el_thickstepRL, el_thickstepIL);
+                addToDetThick(matKeys.materialElements[i], el_thickstepRL, el_thickstepIL);
+                addToDetThick(volKeys.detectorElements[i], el_thickstepRL, el_thickstepIL);
             }
             
         }
@@ -209,43 +198,18 @@ namespace G4UA
         }
         
         
-        std::vector<std::string> L;
-        L.push_back(detName_d);
+        // the maps per detector, in total, and per material (or category of material)
         //L.push_back(matName);
         //L.push_back(detName_plus_matName);
-        L.push_back("Total_X0");
-        
-        std::string specialname = "";
-        if(matName.find("Support") != std::string::npos) specialname = "CarbonFiber";
-        if(matName.find("Carbon") != std::string::npos) specialname = "CarbonFiber";
-        if(matName.find("Steel") != std::string::npos) specialname = "Steel";
-        if(matName.find("BarrelStrip") != std::string::npos) specialname = "Services";
-        if(matName.find("Brl") != std::string::npos) specialname = "Services";
-        if(matName.find("Svc") != std::string::npos) specialname = "Services";
-        if(matName.find("InnerIST") != std::string::npos) specialname = "Services";
-        if(matName.find("InnerPST") != std::string::npos) specialname = "Services";
-        if(matName.find("BarrelPixel") != std::string::npos) specialname = "Services";
-        if(matName.find("EndcapPixel") != std::string::npos) specialname = "Services";
-        if(matName.find("InnerPixel") != std::string::npos) specialname = "Services";
-        if(matName.find("OuterPixel") != std::string::npos) specialname = "Services";
-        if(matName.find("pix::Chip") != std::string::npos) specialname = "PixelChips";
-        if(matName.find("pix::Hybrid") != std::string::npos) specialname = "PixelChips";
-        if(specialname != ""){
-            L.push_back("M_"+specialname);
-        }else{
-            L.push_back(matName);
-        }
+        const G4int L[3] = { volKeys.detector, m_totalKey, matKeys.plot };
         
-        std::string plotstring = "";
       if(fGeantinoMapsConfig->GetCreateDetectorsMaps()|| fGeantinoMapsConfig->GetCreateMaterialsMaps()){
           // 1. UPDATE m_rzMapRL and m_xyMapRL per Detector and Materials
-          for (auto it : L) {
+          for (G4int key : L) {
               
               static std::mutex mutex_register;
               std::lock_guard<std::mutex> lock(mutex_register);
               
-              plotstring = it;
-              
               //G4cout<<"processing string "<<plotstring<<G4endl;
               
               //      if(!m_rzMapRL[plotstring]){
@@ -268,36 +232,35 @@ namespace G4UA
               //      m_xyMapRL[plotstring]->Fill( endPoint.x() , endPoint.y() , thickstepRL , 1. );
               //
               // Geant4
-              if(!m_rzMapRL_g4[plotstring]){
+              if(m_rzMapRL_g4[key] < 0){
                   //G4cout<<"Geant4: m_rzMapRL_g4 2DProfile for "<<plotstring<<" doesn't exist, I create it"<<G4endl;
+                  const std::string& plotstring = m_keyNames[key];
                   std::string rznameReg = "RZRadLen_"+plotstring;
                   std::string xynameReg = "XYRadLen_"+plotstring;
                   G4String rzname_g4 = "RZRadLen_"+plotstring;
                   G4String xyname_g4 = "XYRadLen_"+plotstring;
                   //          m_rzMapRL_g4[plotstring]=getOrCreateProfile_g4(rznameReg, rzname_g4, "Z [mm]", 1000,-3512.,3512.,"R [mm]",1000,0.,1200.,"%X0");
                   //          m_xyMapRL_g4[plotstring]=getOrCreateProfile_g4(xynameReg, xyname_g4, "X [mm]", 1000,-1200.,1200.,"Y [mm]",1000,-1200.,1200.,"%X0");
-                  m_rzMapRL_g4[plotstring]=getOrCreateProfile_g4(rznameReg, rzname_g4, "Z [mm]", 1000,fGeantinoMapsConfig->GetZmin(),fGeantinoMapsConfig->GetZmax(), "R [mm]",1000,fGeantinoMapsConfig->GetRmin(),fGeantinoMapsConfig->GetRmax(),"%X0");
-                  m_xyMapRL_g4[plotstring]=getOrCreateProfile_g4(xynameReg, xyname_g4, "X [mm]", 1000,fGeantinoMapsConfig->GetXmin(),fGeantinoMapsConfig->GetXmax(),"Y [mm]",1000,fGeantinoMapsConfig->GetYmin(),fGeantinoMapsConfig->GetYmax(),"%X0");
+                  m_rzMapRL_g4[key]=getOrCreateProfile_g4(rznameReg, rzname_g4, "Z [mm]", 1000,fGeantinoMapsConfig->GetZmin(),fGeantinoMapsConfig->GetZmax(), "R [mm]",1000,fGeantinoMapsConfig->GetRmin(),fGeantinoMapsConfig->GetRmax(),"%X0");
+                  m_xyMapRL_g4[key]=getOrCreateProfile_g4(xynameReg, xyname_g4, "X [mm]", 1000,fGeantinoMapsConfig->GetXmin(),fGeantinoMapsConfig->GetXmax(),"Y [mm]",1000,fGeantinoMapsConfig->GetYmin(),fGeantinoMapsConfig->GetYmax(),"%X0");
                   
               }
               //else G4cout<<"Geant4: m_rzMapRL_g4 2DProfile for "<<plotstring<<" EXIST!"<<G4endl;
               //  G4cout<<"Geant4: Filling m_rzMapRL_g4 histogram for plotstring: "<<plotstring<<"!"<<G4endl;
-              analysisManager->FillP2(m_rzMapRL_g4[plotstring],  hitPoint.z() , hitPoint.perp() , thickstepRL , 1.);
-              analysisManager->FillP2(m_rzMapRL_g4[plotstring],  endPoint.z() , endPoint.perp() , thickstepRL , 1.);
-              analysisManager->FillP2(m_xyMapRL_g4[plotstring],  hitPoint.x() , hitPoint.y()    , thickstepRL , 1.);
-              analysisManager->FillP2(m_xyMapRL_g4[plotstring],  endPoint.x() , endPoint.y()    , thickstepRL , 1.);
+              analysisManager->FillP2(m_rzMapRL_g4[key],  hitPoint.z() , hitPoint.perp() , thickstepRL , 1.);
+              analysisManager->FillP2(m_rzMapRL_g4[key],  endPoint.z() , endPoint.perp() , thickstepRL , 1.);
+              analysisManager->FillP2(m_xyMapRL_g4[key],  hitPoint.x() , hitPoint.y()    , thickstepRL , 1.);
+              analysisManager->FillP2(m_xyMapRL_g4[key],  endPoint.x() , endPoint.y()    , thickstepRL , 1.);
               // ~Geant4
               
           }
           
           // 2. UPDATE m_rzMapIL and m_xyMapIL per Detector and Materials
-          for (auto it : L) {
+          for (G4int key : L) {
               
               static std::mutex mutex_instance;
               std::lock_guard<std::mutex> lock(mutex_instance);
               
-              plotstring = it;
-              
               //      if(!m_rzMapIL[plotstring]){
               //          G4cout<<"ROOT: m_rzMapIL 2DProfile for "<<plotstring<<" doesn't exist, I create it"<<G4endl;
               //          std::string rznameReg = "RZIntLen_"+plotstring;
@@ -315,37 +278,37 @@ namespace G4UA
               //      m_xyMapIL[plotstring]->Fill( hitPoint.x() , hitPoint.y() , thickstepIL , 1. );
               //      m_xyMapIL[plotstring]->Fill( endPoint.x() , endPoint.y() , thickstepIL , 1. );
               
-              if(!m_rzMapIL_g4[plotstring])
+              if(m_rzMapIL_g4[key] < 0)
               {
                   //G4cout<<"Geant4: m_rzMapIL_g4 2DProfile for "<<plotstring<<" doesn't exist, I create it"<<G4endl;
+                  const std::string& plotstring = m_keyNames[key];
                   std::string rznameReg = "RZIntLen_"+plotstring;
                   std::string xynameReg = "XYIntLen_"+plotstring;
                   G4String rzname_g4 = "RZIntLen_"+plotstring;
                   G4String xyname_g4 = "XYIntLen_"+plotstring;
                   //m_rzMapIL_g4[plotstring]= getOrCreateProfile_g4(rznameReg, rzname_g4, "Z [mm]", 1000,-3512.,3512.,"R [mm]",1000,0.,1200.,"#lambda");
                   //m_xyMapIL_g4[plotstring]= getOrCreateProfile_g4(xynameReg, xyname_g4, "X [mm]", 1000,-1200.,1200.,"Y [mm]",1000,-1200.,1200.,"#lambda");
-                  m_rzMapIL_g4[plotstring]= getOrCreateProfile_g4(rznameReg, rzname_g4, "Z [mm]", 1000,fGeantinoMapsConfig->GetZmin(),fGeantinoMapsConfig->GetZmax(),"R [mm]",1000,fGeantinoMapsConfig->GetRmin(),fGeantinoMapsConfig->GetRmax(),"#lambda");
-                  m_xyMapIL_g4[plotstring]= getOrCreateProfile_g4(xynameReg, xyname_g4, "X [mm]", 1000,fGeantinoMapsConfig->GetXmin(),fGeantinoMapsConfig->GetXmax(),"Y [mm]",1000,fGeantinoMapsConfig->GetYmin(),fGeantinoMapsConfig->GetYmax(),"#lambda");
+                  m_rzMapIL_g4[key]= getOrCreateProfile_g4(rznameReg, rzname_g4, "Z [mm]", 1000,fGeantinoMapsConfig->GetZmin(),fGeantinoMapsConfig->GetZmax(),"R [mm]",1000,fGeantinoMapsConfig->GetRmin(),fGeantinoMapsConfig->GetRmax(),"#lambda");
+                  m_xyMapIL_g4[key]= getOrCreateProfile_g4(xynameReg, xyname_g4, "X [mm]", 1000,fGeantinoMapsConfig->GetXmin(),fGeantinoMapsConfig->GetXmax(),"Y [mm]",1000,fGeantinoMapsConfig->GetYmin(),fGeantinoMapsConfig->GetYmax(),"#lambda");
               }
               //else G4cout<<"Geant4: m_rzMapIL_g4 2DProfile for "<<plotstring<<" EXIST!"<<G4endl;
               //   G4cout<<"Geant4: Filling m_rzMapIL_g4 histogram for plotstring: "<<plotstring<<"!"<<G4endl;
-              analysisManager->FillP2(m_rzMapIL_g4[plotstring],hitPoint.z() , hitPoint.perp() , thickstepIL , 1.);
-              analysisManager->FillP2(m_rzMapIL_g4[plotstring],endPoint.z() , endPoint.perp() , thickstepIL , 1.);
-              analysisManager->FillP2(m_xyMapIL_g4[plotstring],hitPoint.x() , hitPoint.y()    , thickstepIL , 1.);
-              analysisManager->FillP2(m_xyMapIL_g4[plotstring],endPoint.x() , endPoint.y()    , thickstepIL , 1.);
+              analysisManager->FillP2(m_rzMapIL_g4[key],hitPoint.z() , hitPoint.perp() , thickstepIL , 1.);
+              analysisManager->FillP2(m_rzMapIL_g4[key],endPoint.z() , endPoint.perp() , thickstepIL , 1.);
+              analysisManager->FillP2(m_xyMapIL_g4[key],hitPoint.x() , hitPoint.y()    , thickstepIL , 1.);
+              analysisManager->FillP2(m_xyMapIL_g4[key],endPoint.x() , endPoint.y()    , thickstepIL , 1.);
               
           }
           
       }
       if(fGeantinoMapsConfig->GetCreateElementsMaps()){
           // 3. UPDATE m_rzMapRL and m_xyMapRL per ELEMENTS
-          const G4ElementVector* eVec = mat->GetElementVector();
           for (size_t i=0 ; i < mat->GetNumberOfElements() ; ++i) {
               
               static std::mutex mutex_instance;
               std::lock_guard<std::mutex> lock(mutex_instance);
               
-              std::string elementName = "E_" + (*eVec)[i]->GetName();
+              const G4int key = matKeys.elements[i];
               double el_thickstep = stepl * (mat->GetVecNbOfAtomsPerVolume())[i] * (*eVec)[i]->GetfRadTsai() * 100.0;
               
               //      if(!m_rzMapRL[elementName]){
@@ -367,8 +330,9 @@ namespace G4UA
               //      m_xyMapRL[elementName]->Fill( hitPoint.x() , hitPoint.y() , el_thickstep , 1. );
               //      m_xyMapRL[elementName]->Fill( endPoint.x() , endPoint.y() , el_thickstep , 1. );
               
-              if(!m_rzMapRL_g4[elementName]){
+              if(m_rzMapRL_g4[key] < 0){
                   //G4cout<<"Geant4: m_rzMapRL_g4 2DProfile for "<<elementName<<" doesn't exist, I create it"<<G4endl;
+                  const std::string& elementName = m_keyNames[key];
                   std::string rznameReg = "RZRadLen_"+elementName;
                   std::string xynameReg = "XYRadLen_"+elementName;
                   //
@@ -376,15 +340,15 @@ namespace G4UA
                   G4String xyname_g4 = "XYRadLen_"+elementName;
                   //         m_rzMapRL_g4[elementName]=getOrCreateProfile_g4(rznameReg, rzname_g4, "Z [mm]", 1000,-3512.,3512.,"R [mm]",1000,0.,1200.,"%X0");
                   //         m_xyMapRL_g4[elementName]=getOrCreateProfile_g4(xynameReg, xyname_g4, "X [mm]", 1000,-1200.,1200.,"Y [mm]",1000,-1200.,1200.,"%X0");
-                  m_rzMapRL_g4[elementName]=getOrCreateProfile_g4(rznameReg, rzname_g4, "Z [mm]", 1000,fGeantinoMapsConfig->GetZmin(),fGeantinoMapsConfig->GetZmax(),"R [mm]",1000,fGeantinoMapsConfig->GetRmin(),fGeantinoMapsConfig->GetRmax(),"%X0");
-                  m_xyMapRL_g4[elementName]=getOrCreateProfile_g4(xynameReg, xyname_g4, "X [mm]", 1000,fGeantinoMapsConfig->GetXmin(),fGeantinoMapsConfig->GetXmax(),"Y [mm]",1000,fGeantinoMapsConfig->GetYmin(),fGeantinoMapsConfig->GetYmax(),"%X0");
+                  m_rzMapRL_g4[key]=getOrCreateProfile_g4(rznameReg, rzname_g4, "Z [mm]", 1000,fGeantinoMapsConfig->GetZmin(),fGeantinoMapsConfig->GetZmax(),"R [mm]",1000,fGeantinoMapsConfig->GetRmin(),fGeantinoMapsConfig->GetRmax(),"%X0");
+                  m_xyMapRL_g4[key]=getOrCreateProfile_g4(xynameReg, xyname_g4, "X [mm]", 1000,fGeantinoMapsConfig->GetXmin(),fGeantinoMapsConfig->GetXmax(),"Y [mm]",1000,fGeantinoMapsConfig->GetYmin(),fGeantinoMapsConfig->GetYmax(),"%X0");
               }
               //else G4cout<<"Geant4: m_rzMapRL_g4 2DProfile for "<<elementName<<" EXIST!"<<G4endl;
               //   G4cout<<"Geant4: Filling m_rzMapRL_g4 histogram for elementName: "<<elementName<<"!"<<G4endl;
-              analysisManager->FillP2(m_rzMapRL_g4[elementName],hitPoint.z() , hitPoint.perp() , el_thickstep , 1. );
-              analysisManager->FillP2(m_rzMapRL_g4[elementName],endPoint.z() , endPoint.perp() , el_thickstep , 1. );
-              analysisManager->FillP2(m_xyMapRL_g4[elementName],hitPoint.x() , hitPoint.y()    , el_thickstep , 1. );
-              analysisManager->FillP2(m_xyMapRL_g4[elementName],endPoint.x() , endPoint.y()    , el_thickstep , 1.);
+              analysisManager->FillP2(m_rzMapRL_g4[key],hitPoint.z() , hitPoint.perp() , el_thickstep , 1. );
+              analysisManager->FillP2(m_rzMapRL_g4[key],endPoint.z() , endPoint.perp() , el_thickstep , 1. );
+              analysisManager->FillP2(m_xyMapRL_g4[key],hitPoint.x() , hitPoint.y()    , el_thickstep , 1. );
+              analysisManager->FillP2(m_xyMapRL_g4[key],endPoint.x() , endPoint.y()    , el_thickstep , 1.);
               
           }
           
@@ -394,7 +358,7 @@ namespace G4UA
               static std::mutex mutex_instance;
               std::lock_guard<std::mutex> lock(mutex_instance);
               
-              std::string elementName = "E_" + (*eVec)[i]->GetName();
+              const G4int key = matKeys.elements[i];
               G4double lambda0 = 35*g/cm2;
               //G4Pow* m_g4pow = G4Pow::GetInstance();
               double el_thickstep = stepl * amu/lambda0 * (mat->GetVecNbOfAtomsPerVolume())[i] * m_g4pow->Z23( G4int( (*eVec)[i]->GetN() + 0.5 ) );
@@ -417,30 +381,120 @@ namespace G4UA
               //      m_xyMapIL[elementName]->Fill( hitPoint.x() , hitPoint.y() , el_thickstep , 1. );
               //      m_xyMapIL[elementName]->Fill( endPoint.x() , endPoint.y() , el_thickstep , 1. );
               
-              if(!m_rzMapIL_g4[elementName]){
+              if(m_rzMapIL_g4[key] < 0){
                   //G4cout<<"Geant4: m_rzMapIL_g4 2DProfile for "<<elementName<<" doesn't exist, I create it"<<G4endl;
+                  const std::string& elementName = m_keyNames[key];
                   std::string rznameReg = "RZIntLen_"+elementName;
                   std::string xynameReg = "XYIntLen_"+elementName;
                   G4String rzname_g4 = "RZIntLen_"+elementName;
                   G4String xyname_g4 = "XYIntLen_"+elementName;
                   //         m_rzMapIL_g4[elementName]=getOrCreateProfile_g4(rznameReg, rzname_g4, "Z [mm]", 1000,-3512.,3512.,"R [mm]",1000,0.,1200.,"#lambda");
                   //         m_xyMapIL_g4[elementName]=getOrCreateProfile_g4(xynameReg, xyname_g4, "X [mm]", 1000,-1200.,1200.,"Y [mm]",1000,-1200.,1200.,"#lambda");
-                  m_rzMapIL_g4[elementName]=getOrCreateProfile_g4(rznameReg, rzname_g4, "Z [mm]", 1000,fGeantinoMapsConfig->GetZmin(),fGeantinoMapsConfig->GetZmax(),"R [mm]",1000,fGeantinoMapsConfig->GetRmin(),fGeantinoMapsConfig->GetRmax(),"#lambda");
-                  m_xyMapIL_g4[elementName]=getOrCreateProfile_g4(xynameReg, xyname_g4, "X [mm]", 1000,fGeantinoMapsConfig->GetXmin(),fGeantinoMapsConfig->GetXmax(),"Y [mm]",1000,fGeantinoMapsConfig->GetYmin(),fGeantinoMapsConfig->GetYmax(),"#lambda");
+                  m_rzMapIL_g4[key]=getOrCreateProfile_g4(rznameReg, rzname_g4, "Z [mm]", 1000,fGeantinoMapsConfig->GetZmin(),fGeantinoMapsConfig->GetZmax(),"R [mm]",1000,fGeantinoMapsConfig->GetRmin(),fGeantinoMapsConfig->GetRmax(),"#lambda");
+                  m_xyMapIL_g4[key]=getOrCreateProfile_g4(xynameReg, xyname_g4, "X [mm]", 1000,fGeantinoMapsConfig->GetXmin(),fGeantinoMapsConfig->GetXmax(),"Y [mm]",1000,fGeantinoMapsConfig->GetYmin(),fGeantinoMapsConfig->GetYmax(),"#lambda");
                   
               }
               //else G4cout<<"Geant4: m_rzMapIL_g4 2DProfile for "<<elementName<<" EXIST!"<<G4endl;
               //   G4cout<<"Geant4: Filling m_rzMapIL_g4 histogram for elementName: "<<elementName<<"!"<<G4endl;
-              analysisManager->FillP2(m_rzMapIL_g4[elementName],hitPoint.z() , hitPoint.perp() , el_thickstep , 1. );
-              analysisManager->FillP2(m_rzMapIL_g4[elementName],endPoint.z() , endPoint.perp() , el_thickstep , 1. );
-              analysisManager->FillP2(m_xyMapIL_g4[elementName],hitPoint.x() , hitPoint.y()    , el_thickstep , 1. );
-              analysisManager->FillP2(m_xyMapIL_g4[elementName],endPoint.x() , endPoint.y()    , el_thickstep , 1.);
+              analysisManager->FillP2(m_rzMapIL_g4[key],hitPoint.z() , hitPoint.perp() , el_thickstep , 1. );
+              analysisManager->FillP2(m_rzMapIL_g4[key],endPoint.z() , endPoint.perp() , el_thickstep , 1. );
+              analysisManager->FillP2(m_xyMapIL_g4[key],hitPoint.x() , hitPoint.y()    , el_thickstep , 1. );
+              analysisManager->FillP2(m_xyMapIL_g4[key],endPoint.x() , endPoint.y()    , el_thickstep , 1.);
               
           }
       }
 
   }
 
+  //---------------------------------------------------------------------------
+  // Intern the name of a key of the thickness map and of the profiles
+  //---------------------------------------------------------------------------
+  G4int FSLLengthIntegratorSteppingAction::internKey(const std::string& name)
+  {
+    auto inserted = m_keyIds.emplace(name, G4int(m_keyNames.size()));
+    if (inserted.second) {
+      m_keyNames.push_back(name);
+      m_detThick.emplace_back(0., 0.);
+      m_detThickFilled.push_back(0);
+      m_rzMapRL_g4.push_back(-1);
+      m_xyMapRL_g4.push_back(-1);
+      m_rzMapIL_g4.push_back(-1);
+      m_xyMapIL_g4.push_back(-1);
+    }
+    return inserted.first->second;
+  }
+
+  //---------------------------------------------------------------------------
+  // Resolve the keys of a material, the first time it is met
+  //---------------------------------------------------------------------------
+  const FSLLengthIntegratorSteppingAction::MaterialKeys& FSLLengthIntegratorSteppingAction::getMaterialKeys(const G4Material* mat)
+  {
+    const size_t index = mat->GetIndex();
+    if (index < m_materialKeys.size() && m_materialKeys[index].resolved) return m_materialKeys[index];
+    if (index >= m_materialKeys.size()) m_materialKeys.resize(index + 1);
+
+    MaterialKeys& keys = m_materialKeys[index];
+    const std::string matName = "M_" + mat->GetName();
+    keys.material = internKey(matName);
+
+    std::string specialname = "";
+    if(matName.find("Support") != std::string::npos) specialname = "CarbonFiber";
+    if(matName.find("Carbon") != std::string::npos) specialname = "CarbonFiber";
+    if(matName.find("Steel") != std::string::npos) specialname = "Steel";
+    if(matName.find("BarrelStrip") != std::string::npos) specialname = "Services";
+    if(matName.find("Brl") != std::string::npos) specialname = "Services";
+    if(matName.find("Svc") != std::string::npos) specialname = "Services";
+    if(matName.find("InnerIST") != std::string::npos) specialname = "Services";
+    if(matName.find("InnerPST") != std::string::npos) specialname = "Services";
+    if(matName.find("BarrelPixel") != std::string::npos) specialname = "Services";
+    if(matName.find("EndcapPixel") != std::string::npos) specialname = "Services";
+    if(matName.find("InnerPixel") != std::string::npos) specialname = "Services";
+    if(matName.find("OuterPixel") != std::string::npos) specialname = "Services";
+    if(matName.find("pix::Chip") != std::string::npos) specialname = "PixelChips";
+    if(matName.find("pix::Hybrid") != std::string::npos) specialname = "PixelChips";
+    keys.plot = (specialname != "") ? internKey("M_" + specialname) : keys.material;
+
+    const G4ElementVector* eVec = mat->GetElementVector();
+    for (size_t i=0 ; i < mat->GetNumberOfElements() ; ++i)
+    {
+      keys.elements.push_back(internKey("E_" + (*eVec)[i]->GetName()));
+      keys.materialElements.push_back(internKey("ME_" + mat->GetName() + "_" + (*eVec)[i]->GetName()));
+    }
+    keys.resolved = true;
+    return keys;
+  }
+
+  //---------------------------------------------------------------------------
+  // Resolve the keys of a logical volume, the first time it is met
+  //---------------------------------------------------------------------------
+  const FSLLengthIntegratorSteppingAction::VolumeKeys& FSLLengthIntegratorSteppingAction::getVolumeKeys(const G4LogicalVolume* lv)
+  {
+    const size_t index = lv->GetInstanceID();
+    if (index < m_volumeKeys.size() && m_volumeKeys[index].resolved) return m_volumeKeys[index];
+    if (index >= m_volumeKeys.size()) m_volumeKeys.resize(index + 1);
+
+    VolumeKeys& keys = m_volumeKeys[index];
+    const std::string volName = lv->GetName();
+    std::string detName;
+    auto colsPos = volName.find("::");
+    if (colsPos != std::string::npos)
+        detName = volName.substr(0, colsPos);
+    else
+        detName=volName;
+    //detName="Generic";
+
+    const G4Material* mat = lv->GetMaterial();
+    keys.detector = internKey("D_" + detName);
+    keys.detectorMaterial = internKey("DM_" + detName + "_" + mat->GetName());
+    const G4ElementVector* eVec = mat->GetElementVector();
+    for (size_t i=0 ; i < mat->GetNumberOfElements() ; ++i)
+    {
+      keys.detectorElements.push_back(internKey("DE_" + detName + "_" + (*eVec)[i]->GetName()));
+    }
+    keys.resolved = true;
+    return keys;
+  }
+
   /// note that this should be called from a section protected by a mutex, since it talks to the THitSvc
 //  //ROOT version
 //  TProfile2D* FSLLengthIntegratorSteppingAction::getOrCreateProfile(std::string regName, TString histoname, TString xtitle, int nbinsx, float xmin, float xmax, TString ytitle, int nbinsy,float ymin, float ymax,TString ztitle){
@@ -504,17 +558,41 @@ G4int FSLLengthIntegratorSteppingAction::getOrCreateProfile_g4(G4String regName,
     }
 
   //---------------------------------------------------------------------------
-  // Add elements and values to the map
+  // Add values to the thickness of a key
+  //---------------------------------------------------------------------------
+  void FSLLengthIntegratorSteppingAction::addToDetThick(G4int key, double thickstepRL, double thickstepIL)
+  {
+    if (!m_detThickFilled[key]) {
+      m_detThickFilled[key] = 1;
+      m_detThickKeys.push_back(key);
+    }
+    m_detThick[key].first+=thickstepRL;
+    m_detThick[key].second+=thickstepIL;
+  }
+
+  //---------------------------------------------------------------------------
+  // Build the map of the thicknesses filled in the current event
+  //---------------------------------------------------------------------------
+  const std::map<std::string, std::pair<double, double> >& FSLLengthIntegratorSteppingAction::GetDetThickMap()
+  {
+    m_detThickMap.clear();
+    for (G4int key : m_detThickKeys) {
+      m_detThickMap.emplace(m_keyNames[key], m_detThick[key]);
+    }
+    return m_detThickMap;
+  }
+
+  //---------------------------------------------------------------------------
+  // Reset the thicknesses at the beginning of an event
   //---------------------------------------------------------------------------
-  void FSLLengthIntegratorSteppingAction::addToDetThickMap(std::string name, double thickstepRL, double thickstepIL)
+  void FSLLengthIntegratorSteppingAction::ClearDetThickMap()
   {
-    auto it=m_detThickMap.find(name);
-    if(it!=m_detThickMap.end()){
-      (*it).second.first+=thickstepRL;
-      (*it).second.second+=thickstepIL;
-    } else {
-      m_detThickMap.insert(std::map<std::string,std::pair<double,double>,std::less<std::string> >::value_type( name, std::pair<double,double>( thickstepRL, thickstepIL) ) );
+    for (G4int key : m_detThickKeys) {
+      m_detThick[key] = std::pair<double, double>(0., 0.);
+      m_detThickFilled[key] = 0;
     }
+    m_detThickKeys.clear();
+    m_detThickMap.clear();
   }
 
   
@@ -9,6 +9,7 @@
 
 #include "StandardEmWithWoodcock.hh"
 #include "EmExtraPhysics.hh"
+#include "WoodcockRegionAnalyser.hh"
 
 #include "GeoModelKernel/GeoPluginLoader.h"
 #include "FullSimLight/FSLPhysicsListPlugin.h"
@@ -20,6 +21,7 @@
 std::unique_ptr<FSLPhysListFactory> FSLPhysListFactory::fgInstance;
 
 bool FSLPhysListFactory::fActivateRegionsFlag;
+bool FSLPhysListFactory::fAutoWoodcockRegionFlag;
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
@@ -35,6 +37,7 @@ FSLPhysListFactory::FSLPhysListFactory()
   if (!fgInstance) {
     fgInstance=std::unique_ptr<FSLPhysListFactory>(this);
     fActivateRegionsFlag = false;
+    fAutoWoodcockRegionFlag = false;
   }
 }
 
@@ -76,13 +79,18 @@ G4VModularPhysicsList* FSLPhysListFactory::GetPhysList(const std::string physLis
         G4PhysListFactory factory;
         if (factory.IsReferencePhysList(parPhysListName)) {
             physList = factory.GetReferencePhysList(parPhysListName);
-        } else if (parPhysListName==G4String("FTFP_BERT_ATL_WDCK")) {
+        } else if (parPhysListName==G4String("FTFP_BERT_ATL_WDCK") ||
+                   parPhysListName==G4String("FTFP_BERT_ATL_WDCK_AUTO")) {
             G4cout << "<<< Geant4 FTFP_BERT_ATL physics list with the local Woodcock settings " << G4endl;
             physList = factory.GetReferencePhysList("FTFP_BERT_ATL");
             // the local em-standard physics with Woodcock tracking for gamma
             StandardEmWithWoodcock* em0AndWDCK = new StandardEmWithWoodcock;
-            // set the region name and low energy limit for Woodcock tracking
-            em0AndWDCK->SetRegionNameForWoodcockTracking("EMEC");
+            // set the region name and low energy limit for Woodcock tracking: the
+            // EMEC, or the region selected from the geometry by the detector
+            // construction with the `WoodcockRegionAnalyser`
+            fAutoWoodcockRegionFlag = parPhysListName==G4String("FTFP_BERT_ATL_WDCK_AUTO");
+            em0AndWDCK->SetRegionNameForWoodcockTracking(fAutoWoodcockRegionFlag ? WoodcockRegionAnalyser::GetAutoRegionName()
+                                                                                 : G4String("EMEC"));
             em0AndWDCK->SetLowEnergyLimitForWoodcockTracking(200.0*CLHEP::keV);
             physList->ReplacePhysics(em0AndWDCK);
             // the local version of the `G4EmExtraPhysics` that will use the local `GammaGeneralProcess`
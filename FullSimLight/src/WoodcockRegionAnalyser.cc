@@ -0,0 +1,235 @@
+/*
+  Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+*/
+
+#include "WoodcockRegionAnalyser.hh"
+
+#include "G4LogicalVolume.hh"
+#include "G4Material.hh"
+#include "G4Region.hh"
+#include "G4RegionStore.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4VSolid.hh"
+#include "G4PhysicalConstants.hh"
+#include "G4SystemOfUnits.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <ostream>
+
+
+namespace {
+  // total Klein-Nishina cross section per electron for a photon of energy `energy`
+  G4double KleinNishinaCrossSection(G4double energy) {
+    const G4double k    = energy/CLHEP::electron_mass_c2;
+    const G4double k2   = 1.0 + 2.0*k;
+    const G4double logK = std::log(k2);
+    return CLHEP::twopi*CLHEP::classic_electr_radius*CLHEP::classic_electr_radius*
+           ( (1.0 + k)/(k*k)*(2.0*(1.0 + k)/k2 - logK/k) + 0.5*logK/k - (1.0 + 3.0*k)/(k2*k2) );
+  }
+}
+
+
+WoodcockRegionAnalyser::WoodcockRegionAnalyser()
+: fReferenceEnergy(1.0*CLHEP::MeV),
+  fMinGain(2.0),
+  fMinHomogeneity(0.1),
+  fMinVolumes(10.0),
+  fCrossSectionPerElectron(0.0),
+  fWorldLV(nullptr) {}
+
+
+const G4String& WoodcockRegionAnalyser::GetAutoRegionName() {
+  static const G4String name = "WoodcockAuto";
+  return name;
+}
+
+
+void WoodcockRegionAnalyser::Analyse(const G4VPhysicalVolume* world) {
+  fSubtreeData.clear();
+  fSelected.clear();
+  fCrossSectionPerElectron = KleinNishinaCrossSection(fReferenceEnergy);
+  fWorldLV = world->GetLogicalVolume();
+  // the volumes of the configured regions keep them: only the root logical
+  // volumes know their region until the run manager scans the trees
+  fRegionLVs.clear();
+  for (G4Region* region : *G4RegionStore::GetInstance()) {
+    std::vector<G4LogicalVolume*>::iterator itr = region->GetRootLogicalVolumeIterator();
+    for (std::size_t ir = 0, nr = region->GetNumberOfRootVolumes(); ir < nr; ++ir, ++itr) {
+      if (*itr != fWorldLV) {
+        CollectSubtree(*itr, fRegionLVs);
+      }
+    }
+  }
+  // select the largest candidate subtrees, top-down
+  std::set<const G4LogicalVolume*> visited;
+  SelectCandidates(fWorldLV, visited);
+  // the Woodcock steps of all the subtrees are sampled in the densest material
+  // of the region: drop the subtrees which do not pay off with it, until the
+  // densest material does not change
+  for (G4bool changed = true; changed && !fSelected.empty(); ) {
+    const G4Material* densest = GetRegionDensest();
+    const std::size_t nSelected = fSelected.size();
+    fSelected.erase(std::remove_if(fSelected.begin(), fSelected.end(),
+                                   [&](const G4LogicalVolume* lv) {
+                                     const SubtreeData& data = fSubtreeData.at(lv);
+                                     return !IsCandidate(lv, data, ComputeScore(data, densest));
+                                   }),
+                    fSelected.end());
+    changed = fSelected.size() != nSelected;
+  }
+}
+
+
+// The volume, number of volumes, electrons and the densest material of the
+// subtree of `lv`, computed once per logical volume
+const WoodcockRegionAnalyser::SubtreeData&
+WoodcockRegionAnalyser::GetSubtreeData(const G4LogicalVolume* lv) {
+  auto itr = fSubtreeData.find(lv);
+  if (itr != fSubtreeData.end()) {
+    return itr->second;
+  }
+  SubtreeData data;
+  data.fVolume     = lv->GetSolid()->GetCubicVolume();
+  data.fNumVolumes = 1.0;
+  data.fDensest    = lv->GetMaterial();
+  data.fInRegion   = fRegionLVs.count(lv) > 0;
+  // the daughters displace the material of the mother
+  G4double motherVolume = data.fVolume;
+  G4double electrons    = 0.0;
+  for (std::size_t id = 0, nd = lv->GetNoDaughters(); id < nd; ++id) {
+    const G4VPhysicalVolume* pv = lv->GetDaughter(id);
+    const G4double nCopies      = pv->GetMultiplicity();
+    const SubtreeData& daughter = GetSubtreeData(pv->GetLogicalVolume());
+    data.fNumVolumes += nCopies*daughter.fNumVolumes;
+    electrons        += nCopies*daughter.fElectrons;
+    motherVolume     -= nCopies*daughter.fVolume;
+    data.fInRegion    = data.fInRegion || daughter.fInRegion;
+    if (daughter.fDensest->GetDensity() > data.fDensest->GetDensity()) {
+      data.fDensest = daughter.fDensest;
+    }
+  }
+  data.fElectrons = electrons + std::max(motherVolume, 0.0)*lv->GetMaterial()->GetElectronDensity();
+  return fSubtreeData.emplace(lv, data).first->second;
+}
+
+
+WoodcockRegionAnalyser::Score
+WoodcockRegionAnalyser::ComputeScore(const SubtreeData& data, const G4Material* densest) const {
+  Score score{0.0, 0.0, 0.0};
+  if (data.fVolume <= 0.0) {
+    return score;
+  }
+  // boundary crossings per unit length: the inverse of the size of the volumes
+  const G4double boundaries  = 1.0/std::cbrt(data.fVolume/data.fNumVolumes);
+  const G4double attenuation = data.fElectrons/data.fVolume*fCrossSectionPerElectron;
+  const G4double majorant    = densest->GetElectronDensity()*fCrossSectionPerElectron;
+  score.fNormalSteps   = boundaries + attenuation;
+  // the Woodcock tracking stops at the boundary of the root volume only
+  score.fWoodcockSteps = majorant + 1.0/std::cbrt(data.fVolume);
+  score.fHomogeneity   = majorant > 0.0 ? attenuation/majorant : 0.0;
+  return score;
+}
+
+
+G4bool WoodcockRegionAnalyser::IsCandidate(const G4LogicalVolume* lv, const SubtreeData& data,
+                                           const Score& score) const {
+  // the world belongs to the default region, and the subtrees inside or
+  // containing a volume of a configured region would take it away
+  return lv != fWorldLV && !data.fInRegion &&
+         data.fNumVolumes >= fMinVolumes &&
+         score.fHomogeneity >= fMinHomogeneity &&
+         score.Gain() >= fMinGain;
+}
+
+
+void WoodcockRegionAnalyser::CollectSubtree(const G4LogicalVolume* lv,
+                                            std::set<const G4LogicalVolume*>& subtree) const {
+  if (!subtree.insert(lv).second) {
+    return;
+  }
+  for (std::size_t id = 0, nd = lv->GetNoDaughters(); id < nd; ++id) {
+    CollectSubtree(lv->GetDaughter(id)->GetLogicalVolume(), subtree);
+  }
+}
+
+
+void WoodcockRegionAnalyser::SelectCandidates(const G4LogicalVolume* lv,
+                                              std::set<const G4LogicalVolume*>& visited) {
+  if (!visited.insert(lv).second) {
+    return;
+  }
+  const SubtreeData& data = GetSubtreeData(lv);
+  if (IsCandidate(lv, data, ComputeScore(data, data.fDensest))) {
+    fSelected.push_back(const_cast<G4LogicalVolume*>(lv));
+    return;
+  }
+  for (std::size_t id = 0, nd = lv->GetNoDaughters(); id < nd; ++id) {
+    SelectCandidates(lv->GetDaughter(id)->GetLogicalVolume(), visited);
+  }
+}
+
+
+const G4Material* WoodcockRegionAnalyser::GetRegionDensest() const {
+  const G4Material* densest = nullptr;
+  for (const G4LogicalVolume* lv : fSelected) {
+    const G4Material* mat = fSubtreeData.at(lv).fDensest;
+    if (densest == nullptr || mat->GetDensity() > densest->GetDensity()) {
+      densest = mat;
+    }
+  }
+  return densest;
+}
+
+
+G4bool WoodcockRegionAnalyser::CreateRegion(const G4String& name) const {
+  if (fSelected.empty()) {
+    return false;
+  }
+  G4Region* reg = new G4Region(name);
+  for (G4LogicalVolume* lv : fSelected) {
+    reg->AddRootLogicalVolume(lv);
+  }
+  return true;
+}
+
+
+void WoodcockRegionAnalyser::PrintReport(std::ostream& out) const {
+  const std::ios::fmtflags flags = out.flags();
+  const std::streamsize precision = out.precision();
+  out << " Woodcock region analysis at " << fReferenceEnergy/CLHEP::MeV << " MeV"
+      << " (minimum gain " << fMinGain << ", homogeneity " << fMinHomogeneity
+      << ", volumes " << fMinVolumes << ")" << std::endl;
+  if (fSelected.empty()) {
+    out << "   no subtree is expected to gain from Woodcock tracking" << std::endl;
+    out.flags(flags);
+    out.precision(precision);
+    return;
+  }
+  const G4Material* densest = GetRegionDensest();
+  out << "   Woodcock material: " << densest->GetName() << std::endl;
+  out << std::setw(40) << std::left << "   root logical volume" << std::right
+      << std::setw(12) << "volumes" << std::setw(14) << "V [cm3]"
+      << std::setw(13) << "homogeneity" << std::setw(14) << "steps/m"
+      << std::setw(14) << "WDCK steps/m" << std::setw(10) << "saved" << std::endl;
+  G4double normalSteps   = 0.0;
+  G4double woodcockSteps = 0.0;
+  out << std::setprecision(3);
+  for (const G4LogicalVolume* lv : fSelected) {
+    const SubtreeData& data = fSubtreeData.at(lv);
+    const Score score = ComputeScore(data, densest);
+    // weighted by the volume, for a uniform photon flux
+    normalSteps   += score.fNormalSteps*data.fVolume;
+    woodcockSteps += score.fWoodcockSteps*data.fVolume;
+    out << "   " << std::setw(37) << std::left << lv->GetName() << std::right
+        << std::setw(12) << data.fNumVolumes << std::setw(14) << data.fVolume/CLHEP::cm3
+        << std::setw(13) << score.fHomogeneity << std::setw(14) << score.fNormalSteps*CLHEP::m
+        << std::setw(14) << score.fWoodcockSteps*CLHEP::m
+        << std::setw(9) << 100.0*(1.0 - 1.0/score.Gain()) << "%" << std::endl;
+  }
+  out << "   expected photon steps saved in the region: "
+      << 100.0*(1.0 - woodcockSteps/normalSteps) << "%" << std::endl;
+  out.flags(flags);
+  out.precision(precision);
+}
@@ -0,0 +1,92 @@
+// Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+
+// Checks that the clashes report of gmclash does not depend on the number
+// of threads: the same geometry, with overlaps among sisters and with the
+// mothers, is checked with 1 and with 4 threads and the reports must be
+// identical.
+
+#include "ClashDetector.hh"
+
+#include "G4Box.hh"
+#include "G4LogicalVolume.hh"
+#include "G4Material.hh"
+#include "G4PVPlacement.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4Tubs.hh"
+#include "Randomize.hh"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace {
+  // A world with a few distinct staves, each holding overlapping modules
+  G4VPhysicalVolume* buildGeometry()
+  {
+    G4Material* silicon = new G4Material("Silicon", 14., 28.0855*g/mole, 2.33*g/cm3);
+    G4LogicalVolume* worldLV = new G4LogicalVolume(new G4Box("World", 1.*m, 1.*m, 1.*m), silicon, "World");
+    G4VPhysicalVolume* world = new G4PVPlacement(nullptr, G4ThreeVector(), worldLV, "World", nullptr, false, 0);
+
+    G4LogicalVolume* moduleLV = new G4LogicalVolume(new G4Box("Module", 20.*mm, 20.*mm, 1.*mm), silicon, "Module");
+    G4LogicalVolume* pipeLV = new G4LogicalVolume(new G4Tubs("Pipe", 2.*mm, 3.*mm, 60.*mm, 0., CLHEP::twopi),
+                                                  silicon, "Pipe");
+    for (G4int s = 0; s < 4; ++s)
+    {
+      const G4String name = "Stave" + std::to_string(s);
+      G4LogicalVolume* staveLV = new G4LogicalVolume(new G4Box(name, 25.*mm, 25.*mm, 95.*mm), silicon, name);
+      for (G4int m = 0; m < 8; ++m)
+      {
+        // the modules overlap the pipe, and the last one sticks out
+        new G4PVPlacement(nullptr, G4ThreeVector(0., 0., (-80. + 25.*m + s)*mm), moduleLV, "Module",
+                          staveLV, false, m);
+      }
+      new G4PVPlacement(nullptr, G4ThreeVector((5. + s)*mm, 0., 0.), pipeLV, "Pipe", staveLV, false, 0);
+      for (G4int c = 0; c < 3; ++c)
+      {
+        new G4PVPlacement(nullptr, G4ThreeVector((-300. + 200.*s)*mm, (-200. + 150.*c)*mm, 0.), staveLV,
+                          name, worldLV, false, c);
+      }
+    }
+    return world;
+  }
+
+  std::string clashesReport(const G4VPhysicalVolume* world, G4int nthreads, G4int& nclashes)
+  {
+    G4Random::setTheSeed(20251017);
+    ClashDetector clashDetector(world);
+    clashDetector.SetNumberOfThreads(nthreads);
+    clashDetector.CheckOverlapsInTree();
+    nclashes = clashDetector.NumberOfClashes();
+
+    const G4String fileName = "testClashThreads_" + std::to_string(nthreads) + ".json";
+    clashDetector.PrintOutReport(fileName);
+    std::ifstream in(fileName);
+    std::stringstream report;
+    report << in.rdbuf();
+    return report.str();
+  }
+}
+
+int main()
+{
+  const G4VPhysicalVolume* world = buildGeometry();
+
+  G4int nclashes1 = 0, nclashes4 = 0;
+  const std::string report1 = clashesReport(world, 1, nclashes1);
+  const std::string report4 = clashesReport(world, 4, nclashes4);
+  if (nclashes1 == 0)
+  {
+    std::cerr << "testClashThreads: no clash was found" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (report1 != report4)
+  {
+    std::cerr << "testClashThreads: " << nclashes1 << " clashes with 1 thread, " << nclashes4
+              << " with 4, and the reports differ" << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << "testClashThreads: the " << nclashes1 << " clashes are the same with 1 and 4 threads" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,129 @@
+/*
+  Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+*/
+#ifndef GEOMODELHELPERS_GEOPLACEMENTTABLE_H
+#define GEOMODELHELPERS_GEOPLACEMENTTABLE_H
+
+#include "GeoModelKernel/GeoVPhysVol.h"
+#include "GeoModelKernel/GeoDefinitions.h"
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class GeoVAlignmentStore;
+
+/**
+ * @class GeoPlacementTable
+ *
+ * @brief Flat, structure-of-arrays view of all the placed volumes of a tree.
+ *        The tree is traversed once, with the serial transformers expanded
+ *        and the shared volumes repeated for each of their placements;
+ *        the placements are stored in depth-first order, so that the parent
+ *        of a placement always precedes it, and the passes over the whole
+ *        tree become linear scans of the columns.
+ *
+ *        The logical volumes, the shapes and the materials are stored once,
+ *        and the placements refer to them through their index.
+ *        The transforms are stored as 3x4 row-major matrices, i.e. 12 contiguous
+ *        doubles per placement: the local one w.r.t. the parent placement
+ *        and the global one w.r.t. the top volume of the table.
+ *
+ *        After the alignment deltas have been changed, refresh() updates the
+ *        local transforms which contain an alignable transform and the global
+ *        transforms of their subtrees, without traversing the tree again.
+ */
+class GeoPlacementTable {
+  public:
+    /// Index of the parent of the top placement
+    static constexpr int noParent = -1;
+    /// Number of doubles stored per transform
+    static constexpr unsigned int transformSize = 12;
+
+    /// Flattens the tree of 'top'; the alignment deltas are taken from 'store', if given
+    GeoPlacementTable(PVConstLink top, GeoVAlignmentStore* store = nullptr);
+
+    /// Number of placements, the top volume included
+    size_t size() const { return m_volumes.size(); }
+
+    /// Index of the parent placement, noParent for the top volume
+    int parent(size_t i) const { return m_parents[i]; }
+    /// Depth of the placement in the tree, 0 for the top volume
+    unsigned int depth(size_t i) const { return m_depths[i]; }
+    /// The placed physical volume
+    const GeoVPhysVol* volume(size_t i) const { return m_volumes[i]; }
+    /// Indices in the logical volume, shape and material tables
+    unsigned int logVolId(size_t i) const { return m_logVolIds[i]; }
+    unsigned int shapeId(size_t i) const { return m_shapeIds[i]; }
+    unsigned int materialId(size_t i) const { return m_materialIds[i]; }
+    /// Name of the placement, from the name tag or the serial denominator
+    const std::string& name(size_t i) const { return m_names[i]; }
+    /// Identifier of the placement, from the identifier tag or the serial identifier
+    const std::optional<int>& identifier(size_t i) const { return m_identifiers[i]; }
+
+    /// Transforms of the placement, w.r.t. its parent and w.r.t. the top volume
+    GeoTrf::Transform3D localTransform(size_t i) const;
+    GeoTrf::Transform3D globalTransform(size_t i) const;
+    /// The raw columns of transforms: transformSize doubles per placement
+    const std::vector<double>& localTransforms() const { return m_local; }
+    const std::vector<double>& globalTransforms() const { return m_global; }
+
+    /// The distinct logical volumes, shapes and materials of the tree
+    const std::vector<const GeoLogVol*>& logVols() const { return m_logVols; }
+    const std::vector<const GeoShape*>& shapes() const { return m_shapes; }
+    const std::vector<const GeoMaterial*>& materials() const { return m_materials; }
+
+    /// Updates the transforms after a change of the alignment deltas, which
+    /// are taken from 'store', if given. Returns the number of placements
+    /// whose global transform has been recomputed.
+    size_t refresh(GeoVAlignmentStore* store = nullptr);
+
+  private:
+    /// The indices of the logical volumes, shapes and materials met so far
+    struct Indices {
+        std::unordered_map<const GeoLogVol*, unsigned int> logVols{};
+        std::unordered_map<const GeoShape*, unsigned int> shapes{};
+        std::unordered_map<const GeoMaterial*, unsigned int> materials{};
+    };
+    template <class T>
+    static unsigned int indexOf(const T* obj, std::unordered_map<const T*, unsigned int>& indices,
+                                std::vector<const T*>& table);
+
+    /// Appends the placement of 'vol' and the ones of its subtree
+    void addPlacement(const GeoVPhysVol* vol, int parent, unsigned int depth,
+                      const GeoTrf::Transform3D& local, std::string name,
+                      std::optional<int> identifier, GeoVAlignmentStore* store,
+                      Indices& indices);
+    static void setTransform(std::vector<double>& column, size_t i, const GeoTrf::Transform3D& trf);
+    static GeoTrf::Transform3D getTransform(const std::vector<double>& column, size_t i);
+
+    /// The placements of the children of a volume which have an alignable transform
+    struct AlignedChildren {
+        /// the placement of the parent
+        size_t parent{0};
+        /// for each aligned child: its position among the volumes of the parent,
+        /// and its placement
+        std::vector<std::pair<unsigned int, size_t>> children{};
+    };
+
+    PVConstLink m_top{};
+    std::vector<int> m_parents{};
+    std::vector<unsigned int> m_depths{};
+    std::vector<const GeoVPhysVol*> m_volumes{};
+    std::vector<unsigned int> m_logVolIds{};
+    std::vector<unsigned int> m_shapeIds{};
+    std::vector<unsigned int> m_materialIds{};
+    std::vector<std::string> m_names{};
+    std::vector<std::optional<int>> m_identifiers{};
+    std::vector<double> m_local{};
+    std::vector<double> m_global{};
+
+    std::vector<const GeoLogVol*> m_logVols{};
+    std::vector<const GeoShape*> m_shapes{};
+    std::vector<const GeoMaterial*> m_materials{};
+
+    std::vector<AlignedChildren> m_alignedChildren{};
+};
+
+#endif
@@ -0,0 +1,114 @@
+/*
+  Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+*/
+#include "GeoModelHelpers/GeoPlacementTable.h"
+
+#include "GeoModelKernel/GeoLogVol.h"
+#include "GeoModelKernel/GeoVolumeCursor.h"
+
+GeoPlacementTable::GeoPlacementTable(PVConstLink top, GeoVAlignmentStore* store):
+    m_top{std::move(top)} {
+    if (!m_top) return;
+    Indices indices{};
+    addPlacement(m_top, noParent, 0, GeoTrf::Transform3D::Identity(),
+                 m_top->getLogVol()->getName(), std::nullopt, store, indices);
+}
+
+template <class T>
+unsigned int GeoPlacementTable::indexOf(const T* obj, std::unordered_map<const T*, unsigned int>& indices,
+                                        std::vector<const T*>& table) {
+    auto inserted = indices.emplace(obj, table.size());
+    if (inserted.second) table.push_back(obj);
+    return inserted.first->second;
+}
+
+void GeoPlacementTable::addPlacement(const GeoVPhysVol* vol, int parent, unsigned int depth,
+                                     const GeoTrf::Transform3D& local, std::string name,
+                                     std::optional<int> identifier, GeoVAlignmentStore* store,
+                                     Indices& indices) {
+    const size_t row = m_volumes.size();
+    const GeoLogVol* logVol = vol->getLogVol();
+    m_parents.push_back(parent);
+    m_depths.push_back(depth);
+    m_volumes.push_back(vol);
+    m_logVolIds.push_back(indexOf(logVol, indices.logVols, m_logVols));
+    m_shapeIds.push_back(indexOf(logVol->getShape(), indices.shapes, m_shapes));
+    m_materialIds.push_back(indexOf(logVol->getMaterial(), indices.materials, m_materials));
+    m_names.push_back(std::move(name));
+    m_identifiers.push_back(identifier);
+    m_local.resize(m_local.size() + transformSize);
+    m_global.resize(m_global.size() + transformSize);
+    setTransform(m_local, row, local);
+    setTransform(m_global, row, parent == noParent ? local : getTransform(m_global, parent) * local);
+
+    AlignedChildren aligned{row, {}};
+    unsigned int nChild{0};
+    for (GeoVolumeCursor cursor{vol, store}; !cursor.atEnd(); cursor.next()) {
+        PVConstLink child = cursor.getVolume();
+        if (!child) continue;
+        if (cursor.hasAlignableTransform()) {
+            aligned.children.emplace_back(nChild, m_volumes.size());
+        }
+        addPlacement(child, row, depth + 1, cursor.getTransform(), cursor.getName(),
+                     cursor.getId(), store, indices);
+        ++nChild;
+    }
+    if (!aligned.children.empty()) {
+        m_alignedChildren.push_back(std::move(aligned));
+    }
+}
+
+size_t GeoPlacementTable::refresh(GeoVAlignmentStore* store) {
+    std::vector<char> dirty(size(), 0);
+    for (const AlignedChildren& aligned : m_alignedChildren) {
+        auto child = aligned.children.begin();
+        unsigned int nChild{0};
+        for (GeoVolumeCursor cursor{m_volumes[aligned.parent], store};
+             !cursor.atEnd() && child != aligned.children.end(); cursor.next()) {
+            if (!cursor.getVolume()) continue;
+            if (nChild++ != child->first) continue;
+            setTransform(m_local, child->second, cursor.getTransform());
+            dirty[child->second] = 1;
+            ++child;
+        }
+    }
+    // The parents precede their children, so a single pass propagates the changes
+    size_t nUpdated{0};
+    for (size_t row = 0; row < size(); ++row) {
+        const int parent = m_parents[row];
+        if (parent == noParent) continue;
+        if (!dirty[row] && !dirty[parent]) continue;
+        dirty[row] = 1;
+        setTransform(m_global, row, getTransform(m_global, parent) * getTransform(m_local, row));
+        ++nUpdated;
+    }
+    return nUpdated;
+}
+
+GeoTrf::Transform3D GeoPlacementTable::localTransform(size_t i) const {
+    return getTransform(m_local, i);
+}
+
+GeoTrf::Transform3D GeoPlacementTable::globalTransform(size_t i) const {
+    return getTransform(m_global, i);
+}
+
+void GeoPlacementTable::setTransform(std::vector<double>& column, size_t i, const GeoTrf::Transform3D& trf) {
+    double* data = column.data() + i * transformSize;
+    for (unsigned int r = 0; r < 3; ++r) {
+        for (unsigned int c = 0; c < 4; ++c) {
+            data[4 * r + c] = trf(r, c);
+        }
+    }
+}
+
+GeoTrf::Transform3D GeoPlacementTable::getTransform(const std::vector<double>& column, size_t i) {
+    const double* data = column.data() + i * transformSize;
+    GeoTrf::Transform3D trf{GeoTrf::Transform3D::Identity()};
+    for (unsigned int r = 0; r < 3; ++r) {
+        for (unsigned int c = 0; c < 4; ++c) {
+            trf(r, c) = data[4 * r + c];
+        }
+    }
+    return trf;
+}
@@ -0,0 +1,113 @@
+// Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+
+#include <GeoModelKernel/GeoAlignableTransform.h>
+#include <GeoModelKernel/GeoBox.h>
+#include <GeoModelKernel/GeoClearAbsPosAction.h>
+#include <GeoModelKernel/GeoFullPhysVol.h>
+#include <GeoModelKernel/GeoIdentifierTag.h>
+#include <GeoModelKernel/GeoNameTag.h>
+#include <GeoModelKernel/GeoPhysVol.h>
+#include <GeoModelKernel/GeoSerialDenominator.h>
+#include <GeoModelKernel/GeoSerialTransformer.h>
+#include <GeoModelKernel/GeoTransform.h>
+#include <GeoModelKernel/GeoXF.h>
+#include <GeoGenericFunctions/Variable.h>
+
+#include <GeoModelHelpers/defineWorld.h>
+#include <GeoModelHelpers/GeoPlacementTable.h>
+#include <iostream>
+
+namespace {
+    bool checkTable(const GeoPlacementTable& table, const std::vector<const GeoFullPhysVol*>& modules) {
+        for (size_t i = 0; i < table.size(); ++i) {
+            GeoTrf::Transform3D expected{table.localTransform(i)};
+            for (int p = table.parent(i); p != GeoPlacementTable::noParent; p = table.parent(p)) {
+                expected = table.localTransform(p) * expected;
+            }
+            if (!table.globalTransform(i).isApprox(expected)) {
+                std::cerr<<"testPlacementTable() "<<__LINE__<<" Global transform mismatch for placement "<<i<<std::endl;
+                return false;
+            }
+            if (table.logVols()[table.logVolId(i)] != table.volume(i)->getLogVol() ||
+                table.shapes()[table.shapeId(i)] != table.volume(i)->getLogVol()->getShape() ||
+                table.materials()[table.materialId(i)] != table.volume(i)->getLogVol()->getMaterial()) {
+                std::cerr<<"testPlacementTable() "<<__LINE__<<" Wrong logical volume for placement "<<i<<std::endl;
+                return false;
+            }
+        }
+        // the uniquely placed volumes must be where the kernel puts them
+        for (size_t i = 0; i < table.size(); ++i) {
+            for (const GeoFullPhysVol* module : modules) {
+                if (table.volume(i) == module &&
+                    !table.globalTransform(i).isApprox(module->getAbsoluteTransform())) {
+                    std::cerr<<"testPlacementTable() "<<__LINE__<<" Module misplaced at placement "<<i<<std::endl;
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+}
+
+int main() {
+    GeoIntrusivePtr<GeoMaterial> material = make_intrusive<GeoMaterial>("Snow", 1.45);
+    GeoIntrusivePtr<GeoBox> box = make_intrusive<GeoBox>(10., 10., 10.);
+    PVLink world = createGeoWorld();
+
+    constexpr unsigned int nModules = 4;
+    constexpr unsigned int nCopies = 6;
+    std::vector<const GeoFullPhysVol*> modules{};
+    std::vector<GeoAlignableTransform*> alignables{};
+    GeoPhysVol* sharedVol = new GeoPhysVol(new GeoLogVol("Shared", box, material));
+    sharedVol->add(new GeoPhysVol(new GeoLogVol("Inner", box, material)));
+    GeoGenfun::Variable i;
+    GeoXF::TRANSFUNCTION copyTrf = GeoXF::Pow(GeoTrf::TranslateZ3D(20.), i);
+    GeoIntrusivePtr<GeoLogVol> moduleLog = make_intrusive<GeoLogVol>("Module", box, material);
+    GeoPhysVol* cellVol = new GeoPhysVol(new GeoLogVol("Cell", box, material));
+    for (unsigned int m = 0; m < nModules; ++m) {
+        GeoFullPhysVol* module = new GeoFullPhysVol(moduleLog);
+        alignables.push_back(new GeoAlignableTransform(GeoTrf::RotateZ3D(0.5 * m) * GeoTrf::TranslateX3D(200.)));
+        world->add(new GeoNameTag("Module"));
+        world->add(new GeoIdentifierTag(m));
+        world->add(alignables.back());
+        world->add(module);
+        modules.push_back(module);
+        module->add(new GeoTransform(GeoTrf::TranslateY3D(15.)));
+        module->add(sharedVol);
+        module->add(new GeoSerialDenominator("Cell"));
+        module->add(new GeoSerialTransformer(cellVol, &copyTrf, nCopies));
+    }
+
+    GeoPlacementTable table{world};
+    const size_t expectedSize = 1 + nModules * (1 + 2 + nCopies);
+    if (table.size() != expectedSize) {
+        std::cerr<<"testPlacementTable() "<<__LINE__<<" Found "<<table.size()<<" placements instead of "
+                 <<expectedSize<<std::endl;
+        return EXIT_FAILURE;
+    }
+    if (table.logVols().size() != 5 || table.shapes().size() != 2 || table.materials().size() != 2) {
+        std::cerr<<"testPlacementTable() "<<__LINE__<<" The logical volumes have not been deduplicated"<<std::endl;
+        return EXIT_FAILURE;
+    }
+    if (table.name(1) != "Module" || table.identifier(1) != 0 || table.name(table.size() - 1) != "Cell" + std::to_string(nCopies - 1)) {
+        std::cerr<<"testPlacementTable() "<<__LINE__<<" Wrong names: "<<table.name(1)<<", "
+                 <<table.name(table.size() - 1)<<std::endl;
+        return EXIT_FAILURE;
+    }
+    if (!checkTable(table, modules)) return EXIT_FAILURE;
+
+    // move the modules and refresh the table
+    for (unsigned int m = 0; m < nModules; ++m) {
+        alignables[m]->setDelta(GeoTrf::TranslateZ3D(1. + m));
+    }
+    GeoClearAbsPosAction clearAction{};
+    world->exec(&clearAction);
+    const size_t nUpdated = table.refresh();
+    if (nUpdated != expectedSize - 1) {
+        std::cerr<<"testPlacementTable() "<<__LINE__<<" Updated "<<nUpdated<<" placements instead of "
+                 <<expectedSize - 1<<std::endl;
+        return EXIT_FAILURE;
+    }
+    if (!checkTable(table, modules)) return EXIT_FAILURE;
+    return EXIT_SUCCESS;
+}
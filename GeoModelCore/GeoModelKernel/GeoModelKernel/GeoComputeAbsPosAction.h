@@ -0,0 +1,74 @@
+/*
+  Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+*/
+
+/**
+ * @class GeoComputeAbsPosAction
+ *
+ * @brief Fills the absolute and the default absolute transforms of all
+ *      the full physical volumes in a tree, in a single top-down pass.
+ *      This is the counterpart of GeoClearAbsPosAction: it is meant for
+ *      clients that access the position of every full physical volume,
+ *      which would otherwise compute each of them on demand, by walking
+ *      up to the top of the tree.
+ *
+ *      Like GeoNodePositioning, the transforms are cached in the volumes,
+ *      or in the alignment store, if one is given. Volumes which are not
+ *      uniquely positioned (shared volumes, volumes of serial transformers)
+ *      and their subtrees are skipped.
+ *
+ *      The subtrees of the daughters of the top volume can be processed
+ *      in parallel; the alignment store is then filled at the end, from
+ *      the calling thread.
+ */
+
+#ifndef GEOMODELKERNEL_GEOCOMPUTEABSPOSACTION_H
+#define GEOMODELKERNEL_GEOCOMPUTEABSPOSACTION_H
+
+#include "GeoModelKernel/GeoDefinitions.h"
+
+#include <vector>
+
+class GeoNodePositioning;
+class GeoVAlignmentStore;
+class GeoVPhysVol;
+
+class GeoComputeAbsPosAction {
+ public:
+  /// 'nThreads' is the number of threads used to process the subtrees;
+  /// 0 uses all the available cores.
+  GeoComputeAbsPosAction(GeoVAlignmentStore* store = nullptr, unsigned int nThreads = 1);
+
+  /// Fills the positions of the full physical volumes in the tree of 'top',
+  /// including 'top' itself
+  void apply(const GeoVPhysVol* top);
+
+  /// Returns the number of full physical volumes filled by the last apply()
+  unsigned int getNFullPhysVols() const;
+
+ private:
+  struct PlacedVolume {
+    const GeoVPhysVol* volume;
+    GeoTrf::Transform3D absTransf;
+    GeoTrf::Transform3D absDefTransf;
+  };
+  struct Position {
+    const GeoNodePositioning* node;
+    GeoTrf::Transform3D absTransf;
+    GeoTrf::Transform3D absDefTransf;
+  };
+
+  /// Appends the uniquely positioned daughters of 'parent'
+  void collectDaughters(const PlacedVolume& parent, std::vector<PlacedVolume>& daughters) const;
+  /// Fills the positions in the subtree of 'placed'. Without an alignment
+  /// store, they are cached in the volumes; otherwise they are appended to 'positions'.
+  unsigned int fillSubtree(const PlacedVolume& placed, std::vector<Position>& positions) const;
+  /// Fills the position of a single volume, if it is a full physical volume
+  bool fillVolume(const PlacedVolume& placed, std::vector<Position>& positions) const;
+
+  GeoVAlignmentStore* m_store{nullptr};
+  unsigned int m_nThreads{1};
+  unsigned int m_nFullPhysVols{0};
+};
+
+#endif
@@ -21,6 +21,9 @@ class GeoCons : public GeoShape {
   //    Returns true if the shape contains the point, false otherwise.
   virtual bool contains (double x, double y, double z) const;
 
+  //    Classifies the n points of xyz = {x0, y0, z0, x1, ...}: out[i] = contains(point i)
+  virtual void containsBatch (const double* xyz, size_t n, uint8_t* out) const;
+
   //    Returns the CONS shape type, as a string.
   virtual const std::string & type () const {
      return getClassType();
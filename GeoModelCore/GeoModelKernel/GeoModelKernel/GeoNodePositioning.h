@@ -43,7 +43,10 @@ class GeoNodePositioning {
       GeoNodePositioning(const GeoPlacement* node);
 
   private:
-    
+    friend class GeoComputeAbsPosAction;
+    /// @brief Caches the (default) absolute transforms computed from the top of the tree
+    void setPositionInfo(const GeoTrf::Transform3D& absTransf, const GeoTrf::Transform3D& absDefTransf) const;
+
     /// @brief  Enum to toggle whether the transform or the defAbsTransform shall accumulated
     enum class AccumlType{
         Aligned, Default
@@ -0,0 +1,79 @@
+/*
+  Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+*/
+
+#ifndef GEOMODELKERNEL_GEOPOLYHEDRONCACHE_H
+#define GEOMODELKERNEL_GEOPOLYHEDRONCACHE_H
+
+/**
+ * @class GeoPolyhedronCache
+ *
+ * @brief Polyhedral representations of shapes, computed once per shape.
+ *
+ *      The polyhedron of a shape is computed on the first request, with
+ *      GeoPolyhedrizeAction, and shared by the following ones. The operands
+ *      of the boolean shapes and of the shifts go through the cache as well,
+ *      so that an operand used by several booleans is polyhedrized once.
+ *
+ *      The cache is thread safe: all the distinct shapes of a tree can be
+ *      polyhedrized by a pool of threads, e.g. to tessellate a detector for
+ *      visualization or export. A shape requested by several threads at the
+ *      same time is computed by one of them, the others wait for it. The cache
+ *      holds a reference to the shapes, so that their addresses stay valid.
+ *
+ *      The polyhedra of shapes not handled by GeoPolyhedrizeAction are nullptr.
+ */
+
+#include "GeoModelKernel/GeoIntrusivePtr.h"
+
+#include <future>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+class GeoPolyhedron;
+class GeoShape;
+class GeoVPhysVol;
+
+class GeoPolyhedronCache {
+ public:
+  GeoPolyhedronCache() = default;
+  GeoPolyhedronCache(const GeoPolyhedronCache&) = delete;
+  GeoPolyhedronCache& operator=(const GeoPolyhedronCache&) = delete;
+
+  /// Returns the polyhedron of 'shape', computed on the first request
+  std::shared_ptr<const GeoPolyhedron> get(const GeoShape* shape);
+
+  /// Polyhedrizes the shapes with 'nThreads' threads; 0 uses all the
+  /// available cores. Rethrows the first error of the threads.
+  void polyhedrize(const std::vector<const GeoShape*>& shapes, unsigned int nThreads = 0);
+
+  /// Polyhedrizes the distinct shapes of the logical volumes of the tree of 'top'
+  void polyhedrize(const GeoVPhysVol* top, unsigned int nThreads = 0);
+
+  /// Returns the distinct shapes of the logical volumes of the tree of 'top'
+  static std::vector<const GeoShape*> collectShapes(const GeoVPhysVol* top);
+
+  /// Returns the number of shapes in the cache, the operands included
+  size_t size() const;
+
+  /// Forgets the polyhedra and releases the shapes
+  void clear();
+
+ private:
+  using Polyhedron = std::shared_ptr<const GeoPolyhedron>;
+
+  struct Entry {
+    GeoIntrusivePtr<const GeoShape> shape;
+    std::shared_future<Polyhedron> polyhedron;
+  };
+
+  /// Computes the polyhedron of a shape, the operands from the cache
+  Polyhedron compute(const GeoShape* shape);
+
+  mutable std::mutex m_mutex;
+  std::unordered_map<const GeoShape*, Entry> m_entries;
+};
+
+#endif
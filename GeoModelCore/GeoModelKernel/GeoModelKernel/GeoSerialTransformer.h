@@ -16,7 +16,9 @@
 #include "GeoModelKernel/GeoVPhysVol.h"
 #include "GeoModelKernel/GeoXF.h"
 
+#include <cstddef>
 #include <memory>
+#include <vector>
 class GeoSerialTransformer : public GeoGraphNode
 {
  public:
@@ -42,7 +44,26 @@ class GeoSerialTransformer : public GeoGraphNode
 
   // Returns the transformation to the ith copy:
   GeoTrf::Transform3D getTransform (int i) const {
-    return (*m_function) (i);
+    return m_transforms.empty() ? (*m_function) (i) : m_transforms[i];
+  }
+
+  // Returns in 'out' the transformations to the copies [begin, end). The
+  // function tree is walked once for the range instead of once per copy;
+  // Pow terms decompose their transform once, with direct paths for pure
+  // translations and rotations about the z axis.
+  void getTransforms (unsigned int begin, unsigned int end,
+                      std::vector<GeoTrf::Transform3D>& out) const;
+
+  // Evaluates the transformations of all the copies into a table, read by
+  // getTransform and getTransforms, if the table takes at most 'maxBytes'
+  // (a larger table is not built and a previous one is released).
+  // Returns whether the table is used. Not to be called concurrently with
+  // the readers of the transformations.
+  bool materializeTransforms (std::size_t maxBytes);
+
+  // Whether the transformations are read from a table:
+  bool isMaterialized () const {
+    return !m_transforms.empty();
   }
 
  protected:
@@ -58,6 +79,9 @@ class GeoSerialTransformer : public GeoGraphNode
 
   //	The physical volume to be multiply placed.
   GeoIntrusivePtr<const GeoVPhysVol> m_physVol{};
+
+  //	The transformations of the copies, if materialized.
+  std::vector<GeoTrf::Transform3D> m_transforms{};
 };
 
 #endif
@@ -28,6 +28,8 @@
 #include <GeoModelKernel/GeoDefinitions.h>
 #include <string>
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
 
 using ShapeType = unsigned int;
 class GeoShapeIntersection;
@@ -43,6 +45,8 @@ class GeoShape : public RCBase
   GeoShape () = default;
 
   //    Returns the volume of the shape, for mass inventory.
+  //    The default implementation is a Monte Carlo estimate with npoints
+  //    random points (at least 1000), computed in the calling thread.
   virtual double volume (int npoints = 1000000) const;
 
   //    Returns the bonding box of the shape.
@@ -52,6 +56,11 @@ class GeoShape : public RCBase
   //    Returns true if the shape contains the point, false otherwise.
   virtual bool contains (double x, double y, double z) const = 0;
 
+  //    Classifies the n points of xyz = {x0, y0, z0, x1, ...}: out[i] = contains(point i).
+  //    The default implementation calls contains for each point; the shapes
+  //    override it with loops which can be vectorized by the compiler.
+  virtual void containsBatch (const double* xyz, size_t n, uint8_t* out) const;
+
   //    Boolean OR operation for shapes.
   const GeoShapeUnion & add (const GeoShape& shape) const;
 
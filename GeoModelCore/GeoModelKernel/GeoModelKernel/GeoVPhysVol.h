@@ -16,6 +16,8 @@
 #include <string>
 #include <shared_mutex>
 #include <optional>
+#include <memory>
+#include <mutex>
 
 class GeoVolumeAction;
 class GeoVAlignmentStore;
@@ -70,13 +72,56 @@ class GeoVPhysVol: public GeoPlacement {
     const GeoGraphNode* const* getChildNode (unsigned int i) const;
     const GeoGraphNode* const* findChildNode(const GeoGraphNode *n) const;
 
-    /// Adds a Graph Node to the Geometry Graph
+    /// Adds a Graph Node to the Geometry Graph, after the daughters
+    /// of the daughter loader, if any.
     void add(const GeoIntrusivePtr<GeoGraphNode>& graphNode);
+
+    /// Creates the daughters of a volume on demand (see setDaughterLoader).
+    class DaughterLoader {
+      public:
+        virtual ~DaughterLoader() = default;
+        /// Adds the daughters to the volume, with appendDaughter.
+        virtual void loadDaughters(GeoVPhysVol& volume) = 0;
+      protected:
+        /// Adds a daughter to the volume being loaded. Unlike add(), it
+        /// does not invoke the loader, which is already running.
+        static void appendDaughter(GeoVPhysVol& volume, const GeoIntrusivePtr<GeoGraphNode>& graphNode);
+    };
+
+    /// Defers the creation of the daughters: the loader is invoked once, the
+    /// first time the daughters are accessed, and it is kept until the volume
+    /// is deleted. Must be set before the volume is shared between threads.
+    void setDaughterLoader(std::unique_ptr<DaughterLoader> loader);
   protected:
-    virtual ~GeoVPhysVol() = default;
+    virtual ~GeoVPhysVol();
+
+    /// Drops the child lookup table. Must be called, with m_muxVec exclusively
+    /// locked, whenever m_daughters is modified.
+    void resetChildIndex();
+
+    /// Invokes the daughter loader, if there is one and it has not run yet.
+    /// Must be called before accessing m_daughters, without holding m_muxVec.
+    void loadDaughters() const;
 
  private:
+    /// Adds a Graph Node without invoking the daughter loader.
+    void addDaughter(const GeoIntrusivePtr<GeoGraphNode>& graphNode);
+
+    /// Lookup table which maps the logical child index onto the daughter node
+    /// placing it. It is built on the first child query and dropped whenever
+    /// the list of daughters changes.
+    struct ChildIndex;
+
+    /// Returns the child lookup table, building it if needed.
+    /// The lock must hold m_muxVec in shared mode.
+    const ChildIndex& childIndex(std::shared_lock<std::shared_mutex>& lock) const;
+
     GeoIntrusivePtr<const GeoLogVol> m_logVol{};
+    mutable std::unique_ptr<const ChildIndex> m_childIndex{};
+
+    /// The daughter loader, if any, and the flag marking that it has run.
+    struct LazyDaughters;
+    std::unique_ptr<LazyDaughters> m_lazyDaughters{};
   protected:
     std::vector<GeoIntrusivePtr<GeoGraphNode>> m_daughters{};
     mutable std::shared_mutex m_muxVec{};
@@ -79,6 +79,12 @@ class GeoVolumeCursor final : public GeoNodeAction
   /// Ressucitate (undo terminate)
   void resuscitate();
 
+  /// Evaluates the transforms of the next batch of copies of the serial transformer
+  void fillSerialTransforms();
+
+  /// Number of copies of a serial transformer evaluated at once
+  static constexpr unsigned int s_serialBatchSize = 64;
+
 
   PVConstLink                           m_parent;
   PVConstLink                           m_volume;
@@ -90,6 +96,7 @@ class GeoVolumeCursor final : public GeoNodeAction
   unsigned int                          m_minorIndex;
   unsigned int                          m_minorLimit;
   const GeoSerialTransformer           *m_serialTransformer;
+  std::vector<GeoTrf::Transform3D>      m_serialTransforms;
   
   const GeoNameTag                     *m_nameTag;
   const GeoSerialDenominator           *m_serialDenominator;
@@ -35,6 +35,16 @@ bool GeoBox::contains (double x, double y, double z) const {
   return (std::max(std::max(distx, disty), distz) <= 0.0);
 }
 
+void GeoBox::containsBatch (const double* xyz, size_t n, uint8_t* out) const {
+  const double hx = m_xHalfLength, hy = m_yHalfLength, hz = m_zHalfLength;
+  for (size_t i = 0; i < n; ++i) {
+    double distx = std::abs(xyz[3 * i]) - hx;
+    double disty = std::abs(xyz[3 * i + 1]) - hy;
+    double distz = std::abs(xyz[3 * i + 2]) - hz;
+    out[i] = (std::max(std::max(distx, disty), distz) <= 0.0);
+  }
+}
+
 void GeoBox::exec (GeoShapeAction *action) const {
   action->handleBox(this);
 }
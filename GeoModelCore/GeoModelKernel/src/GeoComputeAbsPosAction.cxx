@@ -0,0 +1,145 @@
+/*
+  Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+*/
+
+#include "GeoModelKernel/GeoComputeAbsPosAction.h"
+#include "GeoModelKernel/GeoSerialTransformer.h"
+#include "GeoModelKernel/GeoTransform.h"
+#include "GeoModelKernel/GeoVAlignmentStore.h"
+#include "GeoModelKernel/GeoVFullPhysVol.h"
+#include "GeoModelKernel/GeoVSurface.h"
+#include "GeoModelKernel/throwExcept.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+GeoComputeAbsPosAction::GeoComputeAbsPosAction(GeoVAlignmentStore* store, unsigned int nThreads):
+  m_store{store},
+  m_nThreads{nThreads ? nThreads : std::max(1u, std::thread::hardware_concurrency())} {
+}
+
+unsigned int GeoComputeAbsPosAction::getNFullPhysVols() const {
+  return m_nFullPhysVols;
+}
+
+void GeoComputeAbsPosAction::apply(const GeoVPhysVol* top) {
+  m_nFullPhysVols = 0;
+  if (!top) return;
+
+  // The position of the top volume, as in GeoNodePositioning::accumulateTrfs()
+  PlacedVolume placedTop{top, GeoTrf::Transform3D::Identity(), GeoTrf::Transform3D::Identity()};
+  GeoIntrusivePtr<const GeoVPhysVol> child{top}, parent{top->getParent()};
+  while (true) {
+    if (child->isShared()) {
+      THROW_EXCEPTION("GeoPlacement node is shared");
+    }
+    if (!parent) break;
+    placedTop.absTransf = child->getX(m_store) * placedTop.absTransf;
+    placedTop.absDefTransf = child->getDefX(m_store) * placedTop.absDefTransf;
+    child = parent;
+    parent = child->getParent();
+  }
+
+  std::vector<Position> positions{};
+  m_nFullPhysVols += fillVolume(placedTop, positions);
+
+  std::vector<PlacedVolume> subtrees{};
+  collectDaughters(placedTop, subtrees);
+  const unsigned int nThreads = std::min<size_t>(m_nThreads, subtrees.size());
+  if (nThreads <= 1) {
+    for (const PlacedVolume& subtree : subtrees) {
+      m_nFullPhysVols += fillSubtree(subtree, positions);
+    }
+  } else {
+    // The subtrees are handed out one at a time, since their sizes can be very different
+    std::atomic<size_t> nextSubtree{0};
+    std::atomic<unsigned int> nFilled{0};
+    std::vector<std::vector<Position>> threadPositions(nThreads);
+    std::exception_ptr error{};
+    std::mutex errorMutex{};
+    std::vector<std::thread> workers{};
+    workers.reserve(nThreads);
+    for (unsigned int t = 0; t < nThreads; ++t) {
+      workers.emplace_back([&, t]() {
+        try {
+          for (size_t s = nextSubtree++; s < subtrees.size(); s = nextSubtree++) {
+            nFilled += fillSubtree(subtrees[s], threadPositions[t]);
+          }
+        } catch (...) {
+          std::lock_guard<std::mutex> lock{errorMutex};
+          if (!error) error = std::current_exception();
+          nextSubtree = subtrees.size();
+        }
+      });
+    }
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+    if (error) std::rethrow_exception(error);
+    m_nFullPhysVols += nFilled;
+    for (std::vector<Position>& filled : threadPositions) {
+      positions.insert(positions.end(), filled.begin(), filled.end());
+    }
+  }
+
+  // The alignment stores are not meant to be filled concurrently
+  if (!m_store) return;
+  for (const Position& position : positions) {
+    m_store->setAbsPosition(position.node, position.absTransf);
+    m_store->setDefAbsPosition(position.node, position.absDefTransf);
+  }
+}
+
+void GeoComputeAbsPosAction::collectDaughters(const PlacedVolume& parent,
+                                              std::vector<PlacedVolume>& daughters) const {
+  // The transforms preceding a daughter are accumulated as in GeoPlacement::getX()
+  GeoTrf::Transform3D xform{GeoTrf::Transform3D::Identity()};
+  GeoTrf::Transform3D defXform{GeoTrf::Transform3D::Identity()};
+  const unsigned int nNodes = parent.volume->getNChildNodes();
+  for (unsigned int n = 0; n < nNodes; ++n) {
+    const GeoGraphNode* node = *parent.volume->getChildNode(n);
+    if (const GeoTransform* xf = dynamic_cast<const GeoTransform*>(node)) {
+      xform = xform * xf->getTransform(m_store);
+      defXform = defXform * xf->getDefTransform(m_store);
+      continue;
+    }
+    if (const GeoVPhysVol* daughter = dynamic_cast<const GeoVPhysVol*>(node)) {
+      if (!daughter->isShared() && daughter->getParent() == parent.volume) {
+        daughters.push_back(PlacedVolume{daughter, parent.absTransf * xform, parent.absDefTransf * defXform});
+      }
+    } else if (!dynamic_cast<const GeoVSurface*>(node) && !dynamic_cast<const GeoSerialTransformer*>(node)) {
+      continue;
+    }
+    xform = GeoTrf::Transform3D::Identity();
+    defXform = GeoTrf::Transform3D::Identity();
+  }
+}
+
+unsigned int GeoComputeAbsPosAction::fillSubtree(const PlacedVolume& placed,
+                                                 std::vector<Position>& positions) const {
+  unsigned int nFilled{0};
+  std::vector<PlacedVolume> pending{placed};
+  while (!pending.empty()) {
+    const PlacedVolume current{pending.back()};
+    pending.pop_back();
+    nFilled += fillVolume(current, positions);
+    collectDaughters(current, pending);
+  }
+  return nFilled;
+}
+
+bool GeoComputeAbsPosAction::fillVolume(const PlacedVolume& placed,
+                                        std::vector<Position>& positions) const {
+  const GeoVFullPhysVol* fullVol = dynamic_cast<const GeoVFullPhysVol*>(placed.volume);
+  if (!fullVol) return false;
+  const GeoNodePositioning* node{fullVol};
+  if (m_store) {
+    positions.push_back(Position{node, placed.absTransf, placed.absDefTransf});
+  } else {
+    node->setPositionInfo(placed.absTransf, placed.absDefTransf);
+  }
+  return true;
+}
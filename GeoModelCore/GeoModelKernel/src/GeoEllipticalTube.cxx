@@ -42,6 +42,15 @@ bool GeoEllipticalTube::contains (double x, double y, double z) const
           (y * y) / (m_yHalfLength * m_yHalfLength) <= 1.0);
 }
 
+void GeoEllipticalTube::containsBatch (const double* xyz, size_t n, uint8_t* out) const
+{
+  const double a2 = m_xHalfLength * m_xHalfLength, b2 = m_yHalfLength * m_yHalfLength;
+  for (size_t i = 0; i < n; ++i) {
+    double x = xyz[3 * i], y = xyz[3 * i + 1], z = xyz[3 * i + 2];
+    out[i] = (std::abs(z) - m_zHalfLength <= 0.0) & ((x * x) / a2 + (y * y) / b2 <= 1.0);
+  }
+}
+
 void GeoEllipticalTube::exec (GeoShapeAction *action) const {
   action->handleEllipticalTube(this);
 }
@@ -10,6 +10,7 @@
 #include "GeoModelKernel/GeoAccessVolumeAction.h"
 
 #include <algorithm>
+#include <mutex>
 
 GeoFullPhysVol::GeoFullPhysVol (const GeoLogVol* LogVol)
   : GeoVFullPhysVol(LogVol){ }
@@ -40,6 +41,7 @@ void GeoFullPhysVol::exec(GeoNodeAction *action) const {
      && action->getPath()->getLength() > action->getDepthLimit()) {
   }
   else {
+    loadDaughters();
     for(const GeoIntrusivePtr<GeoGraphNode>& node : m_daughters) {
       node->exec(action);
       if(action->shouldTerminate()) {
@@ -57,6 +59,7 @@ void GeoFullPhysVol::exec(GeoNodeAction *action) const {
 
 GeoFullPhysVol* GeoFullPhysVol::clone(bool attached) {
   GeoFullPhysVol* clone = new GeoFullPhysVol(this->getLogVol());
+  loadDaughters();
   for(const auto& daughter : m_daughters) {
     clone->add(daughter);
   }
@@ -79,6 +82,9 @@ const GeoFullPhysVol* GeoFullPhysVol::cloneOrigin() const {
 /// Use it only in Simulation jobs and
 /// Don't call it until geometry has been completely translated to G4
 void GeoFullPhysVol::clear() {
+    loadDaughters();
+    std::unique_lock lk{m_muxVec};
     m_daughters.clear();
+    resetChildIndex();
 }
 
@@ -80,6 +80,13 @@ void GeoNodePositioning::clearPositionInfo() const {
     m_absTransf.reset();
 }
 
+void GeoNodePositioning::setPositionInfo(const GeoTrf::Transform3D& absTransf,
+                                         const GeoTrf::Transform3D& absDefTransf) const {
+    std::unique_lock guard{m_mutex};
+    m_absTransf = std::make_unique<GeoTrf::Transform3D>(absTransf);
+    m_absDefTransf = std::make_unique<GeoTrf::Transform3D>(absDefTransf);
+}
+
 
 const GeoTrf::Transform3D& GeoNodePositioning::getDefAbsoluteTransform(GeoVAlignmentStore* store) const {
    if (!store) {
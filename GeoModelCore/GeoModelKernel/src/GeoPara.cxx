@@ -60,6 +60,23 @@ bool GeoPara::contains (double x, double y, double z) const
   return (std::max(std::max(distx, disty), distz) <= 0.0);
 }
 
+void GeoPara::containsBatch (const double* xyz, size_t n, uint8_t* out) const
+{
+  const double cosPhi = std::cos(m_phi);
+  const double sinPhi = std::sin(m_phi);
+  const double tanTheta = std::tan(m_theta);
+  const double tanAlpha = std::tan(m_alpha);
+  for (size_t i = 0; i < n; ++i) {
+    double z0 = xyz[3 * i + 2];
+    double y0 = xyz[3 * i + 1] - z0 * tanTheta * sinPhi;
+    double x0 = xyz[3 * i] - y0 * tanAlpha - z0 * tanTheta * cosPhi;
+    double distx = std::abs(x0) - m_xHalfLength;
+    double disty = std::abs(y0) - m_yHalfLength;
+    double distz = std::abs(z0) - m_zHalfLength;
+    out[i] = (std::max(std::max(distx, disty), distz) <= 0.0);
+  }
+}
+
 void GeoPara::exec (GeoShapeAction *action) const
 {
   action->handlePara(this);
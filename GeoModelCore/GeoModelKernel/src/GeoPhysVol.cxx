@@ -41,6 +41,7 @@ void GeoPhysVol::exec(GeoNodeAction *action) const {
      && action->getPath()->getLength() > action->getDepthLimit()) {
   }
   else {
+    loadDaughters();
     // FIXME: m_daughters access is now protected in other methods, but having the lock here makes a deadlock
     // std::scoped_lock lk(m_muxVec);
     // TODO: Think more thouroughly about thread-safe of this class...!!
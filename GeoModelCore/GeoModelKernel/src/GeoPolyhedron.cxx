@@ -1050,10 +1050,10 @@ bool GeoPolyhedron::GetNextVertexIndex (int &index, int &edgeFlag) const
  *                                                                     *
  ***********************************************************************/
 {
-  static int
+  static thread_local int
     iFace =
     1;
-  static int
+  static thread_local int
     iQVertex =
     0;
   int
@@ -1132,8 +1132,8 @@ bool
  *                                                                     *
  ***********************************************************************/
 {
-  static int iFace = 1;
-  static int iNode = 0;
+  static thread_local int iFace = 1;
+  static thread_local int iNode = 0;
 
   if (m_nface == 0)
     return false;    // empty polyhedron
@@ -1178,9 +1178,9 @@ bool
  *                                                                     *
  ***********************************************************************/
 {
-  static int iFace = 1;
-  static int iQVertex = 0;
-  static int iOrder = 1;
+  static thread_local int iFace = 1;
+  static thread_local int iQVertex = 0;
+  static thread_local int iOrder = 1;
   int k1, k2, kflag, kface1, kface2;
 
   if (iFace == 1 && iQVertex == 0)
@@ -1372,7 +1372,7 @@ bool
  *                                                                     *
  ***********************************************************************/
 {
-  static int iFace = 1;
+  static thread_local int iFace = 1;
 
   if (edgeFlags == 0)
     {
@@ -1482,7 +1482,7 @@ bool GeoPolyhedron::GetNextNormal (GeoTrf::Vector3D & normal) const
  *                                                                     *
  ***********************************************************************/
 {
-  static int
+  static thread_local int
     iFace =
     1;
   normal = GetNormal (iFace);
@@ -2269,7 +2269,9 @@ int
  ***********************************************************************/
 
 #include "BooleanProcessor.src"
-static
+// One processor per thread, so that the boolean operations of different
+// threads do not share the working arrays
+static thread_local
   Geo_BooleanProcessor
   processor;
 
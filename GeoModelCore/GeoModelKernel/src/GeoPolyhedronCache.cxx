@@ -0,0 +1,144 @@
+/*
+  Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+*/
+
+#include "GeoModelKernel/GeoPolyhedronCache.h"
+#include "GeoModelKernel/GeoLogVol.h"
+#include "GeoModelKernel/GeoPolyhedrizeAction.h"
+#include "GeoModelKernel/GeoPolyhedron.h"
+#include "GeoModelKernel/GeoShapeIntersection.h"
+#include "GeoModelKernel/GeoShapeShift.h"
+#include "GeoModelKernel/GeoShapeSubtraction.h"
+#include "GeoModelKernel/GeoShapeUnion.h"
+#include "GeoModelKernel/GeoVPhysVol.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <unordered_set>
+
+std::shared_ptr<const GeoPolyhedron> GeoPolyhedronCache::get(const GeoShape* shape) {
+  std::promise<Polyhedron> promise{};
+  std::shared_future<Polyhedron> polyhedron{};
+  bool owner{false};
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    auto found = m_entries.find(shape);
+    if (found == m_entries.end()) {
+      polyhedron = promise.get_future().share();
+      m_entries.emplace(shape, Entry{GeoIntrusivePtr<const GeoShape>{shape}, polyhedron});
+      owner = true;
+    } else {
+      polyhedron = found->second.polyhedron;
+    }
+  }
+  // The operands are requested while computing, outside of the lock: they
+  // are never waiting for the shapes which use them, so there is no deadlock
+  if (owner) {
+    try {
+      promise.set_value(compute(shape));
+    } catch (...) {
+      promise.set_exception(std::current_exception());
+    }
+  }
+  return polyhedron.get();
+}
+
+GeoPolyhedronCache::Polyhedron GeoPolyhedronCache::compute(const GeoShape* shape) {
+  const ShapeType type = shape->typeID();
+  if (type == GeoShapeShift::getClassTypeID()) {
+    const GeoShapeShift* shift = static_cast<const GeoShapeShift*>(shape);
+    Polyhedron op = get(shift->getOp());
+    if (!op) return nullptr;
+    auto polyhedron = std::make_shared<GeoPolyhedron>(*op);
+    polyhedron->Transform(shift->getX().matrix().block<3,3>(0,0), shift->getX().translation());
+    return polyhedron;
+  }
+  if (type == GeoShapeUnion::getClassTypeID() ||
+      type == GeoShapeIntersection::getClassTypeID() ||
+      type == GeoShapeSubtraction::getClassTypeID()) {
+    const GeoShape* opA{nullptr};
+    const GeoShape* opB{nullptr};
+    if (type == GeoShapeUnion::getClassTypeID()) {
+      opA = static_cast<const GeoShapeUnion*>(shape)->getOpA();
+      opB = static_cast<const GeoShapeUnion*>(shape)->getOpB();
+    } else if (type == GeoShapeIntersection::getClassTypeID()) {
+      opA = static_cast<const GeoShapeIntersection*>(shape)->getOpA();
+      opB = static_cast<const GeoShapeIntersection*>(shape)->getOpB();
+    } else {
+      opA = static_cast<const GeoShapeSubtraction*>(shape)->getOpA();
+      opB = static_cast<const GeoShapeSubtraction*>(shape)->getOpB();
+    }
+    Polyhedron a = get(opA);
+    Polyhedron b = get(opB);
+    if (!a || !b) return nullptr;
+    if (type == GeoShapeUnion::getClassTypeID()) return std::make_shared<GeoPolyhedron>(a->add(*b));
+    if (type == GeoShapeIntersection::getClassTypeID()) return std::make_shared<GeoPolyhedron>(a->intersect(*b));
+    return std::make_shared<GeoPolyhedron>(a->subtract(*b));
+  }
+  GeoPolyhedrizeAction action{};
+  shape->exec(&action);
+  if (!action.getPolyhedron()) return nullptr;
+  return std::make_shared<GeoPolyhedron>(*action.getPolyhedron());
+}
+
+void GeoPolyhedronCache::polyhedrize(const std::vector<const GeoShape*>& shapes, unsigned int nThreads) {
+  if (nThreads == 0) nThreads = std::max(1u, std::thread::hardware_concurrency());
+  nThreads = std::min<size_t>(nThreads, shapes.size());
+  if (nThreads <= 1) {
+    for (const GeoShape* shape : shapes) get(shape);
+    return;
+  }
+  std::atomic<size_t> nextShape{0};
+  std::exception_ptr error{};
+  std::mutex errorMutex{};
+  auto work = [&]() {
+    try {
+      for (size_t s = nextShape++; s < shapes.size(); s = nextShape++) {
+        get(shapes[s]);
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> lock{errorMutex};
+      if (!error) error = std::current_exception();
+    }
+  };
+  std::vector<std::thread> workers{};
+  workers.reserve(nThreads);
+  for (unsigned int t = 0; t < nThreads; ++t) workers.emplace_back(work);
+  for (std::thread& worker : workers) worker.join();
+  if (error) std::rethrow_exception(error);
+}
+
+void GeoPolyhedronCache::polyhedrize(const GeoVPhysVol* top, unsigned int nThreads) {
+  polyhedrize(collectShapes(top), nThreads);
+}
+
+std::vector<const GeoShape*> GeoPolyhedronCache::collectShapes(const GeoVPhysVol* top) {
+  std::vector<const GeoShape*> shapes{};
+  std::unordered_set<const GeoShape*> seenShapes{};
+  std::unordered_set<const GeoVPhysVol*> seenVolumes{};
+  std::vector<const GeoVPhysVol*> stack{top};
+  while (!stack.empty()) {
+    const GeoVPhysVol* volume = stack.back();
+    stack.pop_back();
+    if (!seenVolumes.insert(volume).second) continue;
+    const GeoShape* shape = volume->getLogVol()->getShape();
+    if (shape && seenShapes.insert(shape).second) shapes.push_back(shape);
+    for (unsigned int c = 0, n = volume->getNChildVols(); c < n; ++c) {
+      const GeoVPhysVol* child = volume->getChildVol(c).get();
+      if (!seenVolumes.count(child)) stack.push_back(child);
+    }
+  }
+  return shapes;
+}
+
+size_t GeoPolyhedronCache::size() const {
+  std::lock_guard<std::mutex> lock{m_mutex};
+  return m_entries.size();
+}
+
+void GeoPolyhedronCache::clear() {
+  std::lock_guard<std::mutex> lock{m_mutex};
+  m_entries.clear();
+}
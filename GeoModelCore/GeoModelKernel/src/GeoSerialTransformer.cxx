@@ -4,6 +4,68 @@
 
 #include "GeoModelKernel/GeoSerialTransformer.h"
 #include "GeoModelKernel/GeoNodeAction.h"
+#include "GeoModelKernel/throwExcept.h"
+#include "GeoGenericFunctions/Variable.h"
+
+#include <cmath>
+
+namespace {
+  // Writes f(x) for x in [begin, end) to out[0 .. end - begin)
+  void evaluate(const GeoXF::Function* f, unsigned int begin, unsigned int end,
+                GeoTrf::Transform3D* out);
+
+  // Pow(xf, n(x)) = Translation(n t) * AngleAxis(n angle, axis), with the
+  // angle and axis of xf computed once for the range.
+  void evaluatePow(const GeoXF::Pow* pow, unsigned int begin, unsigned int end,
+                   GeoTrf::Transform3D* out) {
+    const GeoGenfun::AbsFunction* nTimes = pow->function();
+    const GeoGenfun::Variable* variable = dynamic_cast<const GeoGenfun::Variable*>(nTimes);
+    const bool identity = variable && variable->index() == 0;
+    const GeoTrf::Vector3D translate = pow->transform().translation();
+    const Eigen::AngleAxis<double> aa(pow->transform().rotation());
+    const GeoTrf::Vector3D& axis = aa.axis();
+    const bool aboutZ = axis.x() == 0. && axis.y() == 0. && std::abs(axis.z()) == 1.;
+    for (unsigned int x = begin; x < end; ++x) {
+      const double n = identity ? x : (*nTimes)(x);
+      GeoTrf::Transform3D& xf = out[x - begin];
+      if (aa.angle() == 0.) {
+        // A translation: AngleAxis(0) is the identity
+        xf.setIdentity();
+      } else if (aboutZ) {
+        // The terms of AngleAxis::toRotationMatrix for the axis (0, 0, +-1)
+        const double angle = aa.angle() * n;
+        const double s = std::sin(angle) * axis.z(), c = std::cos(angle);
+        xf.linear() << c, -s, 0.,
+                       s,  c, 0.,
+                       0., 0., (1. - c) + c;
+        xf.matrix().row(3) << 0., 0., 0., 1.;
+      } else {
+        xf = GeoTrf::Transform3D(Eigen::AngleAxis<double>(aa.angle() * n, axis));
+      }
+      xf.translation() = translate * n;
+    }
+  }
+
+  void evaluate(const GeoXF::Function* f, unsigned int begin, unsigned int end,
+                GeoTrf::Transform3D* out) {
+    if (const GeoXF::Pow* pow = dynamic_cast<const GeoXF::Pow*>(f)) {
+      evaluatePow(pow, begin, end, out);
+    } else if (const GeoXF::PreMult* pre = dynamic_cast<const GeoXF::PreMult*>(f)) {
+      evaluate(pre->arg2(), begin, end, out);
+      for (unsigned int k = 0; k < end - begin; ++k) out[k] = pre->arg1() * out[k];
+    } else if (const GeoXF::PostMult* post = dynamic_cast<const GeoXF::PostMult*>(f)) {
+      evaluate(post->arg1(), begin, end, out);
+      for (unsigned int k = 0; k < end - begin; ++k) out[k] = out[k] * post->arg2();
+    } else if (const GeoXF::Product* product = dynamic_cast<const GeoXF::Product*>(f)) {
+      std::vector<GeoTrf::Transform3D> right(end - begin);
+      evaluate(product->arg1(), begin, end, out);
+      evaluate(product->arg2(), begin, end, right.data());
+      for (unsigned int k = 0; k < end - begin; ++k) out[k] = out[k] * right[k];
+    } else {
+      for (unsigned int x = begin; x < end; ++x) out[x - begin] = (*f)(x);
+    }
+  }
+}
 
 GeoSerialTransformer::GeoSerialTransformer (const GeoVPhysVol *volume, 
                                             const GeoXF::Function *func, 
@@ -16,3 +78,26 @@ GeoSerialTransformer::GeoSerialTransformer (const GeoVPhysVol *volume,
 void GeoSerialTransformer::exec(GeoNodeAction *action) const {
     action->handleSerialTransformer(this);
 }
+
+void GeoSerialTransformer::getTransforms(unsigned int begin, unsigned int end,
+                                         std::vector<GeoTrf::Transform3D>& out) const {
+    if (begin > end || end > m_nCopies) {
+        THROW_EXCEPTION("Copies [" << begin << ", " << end << ") out of the "
+                        << m_nCopies << " copies of the serial transformer");
+    }
+    if (!m_transforms.empty()) {
+        out.assign(m_transforms.begin() + begin, m_transforms.begin() + end);
+        return;
+    }
+    out.resize(end - begin);
+    evaluate(m_function.get(), begin, end, out.data());
+}
+
+bool GeoSerialTransformer::materializeTransforms(std::size_t maxBytes) {
+    if (m_nCopies * sizeof(GeoTrf::Transform3D) > maxBytes) {
+        std::vector<GeoTrf::Transform3D>{}.swap(m_transforms);
+        return false;
+    }
+    if (m_transforms.empty()) getTransforms(0, m_nCopies, m_transforms);
+    return !m_transforms.empty();
+}
@@ -10,6 +10,11 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <vector>
+
+namespace {
+  constexpr size_t volumeChunkSize = 4096;   // points classified per containsBatch call
+}
 
 double GeoShape::volume (int npoints) const
 {
@@ -30,35 +35,50 @@ double GeoShape::volume (int npoints) const
   ymax += dely;
   zmax += delz;
 
+  // the points are classified by chunks; they are the same as point by point
+  std::vector<double> xyz(3 * volumeChunkSize);
+  std::vector<uint8_t> out(volumeChunkSize);
   uint32_t y = 2463534242; // seed for random number generation
   int icount = 0; // counter of inside points
-  for (int i = 0; i < np; ++i)
+  for (int first = 0; first < np; first += volumeChunkSize)
   {
-    // generate three random numbers
-    uint32_t x = y;
-    x ^= x << 13;
-    x ^= x >> 17;
-    x ^= x << 5;
-    double randx = x * f;
-    x ^= x << 13;
-    x ^= x >> 17;
-    x ^= x << 5;
-    double randy = x * f;
-    x ^= x << 13;
-    x ^= x >> 17;
-    x ^= x << 5;
-    double randz = x * f;
-    y = x;
+    const int n = std::min<int>(volumeChunkSize, np - first);
+    for (int i = 0; i < n; ++i)
+    {
+      // generate three random numbers
+      uint32_t x = y;
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      double randx = x * f;
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      double randy = x * f;
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      double randz = x * f;
+      y = x;
 
-    // calculate coordinates of random point and check its position
-    double px = xmin + (xmax - xmin) * randx;
-    double py = ymin + (ymax - ymin) * randy;
-    double pz = zmin + (zmax - zmin) * randz;
-    icount += contains(px, py, pz);
+      // calculate coordinates of random point
+      xyz[3 * i] = xmin + (xmax - xmin) * randx;
+      xyz[3 * i + 1] = ymin + (ymax - ymin) * randy;
+      xyz[3 * i + 2] = zmin + (zmax - zmin) * randz;
+    }
+    containsBatch(xyz.data(), n, out.data());
+    for (int i = 0; i < n; ++i) icount += out[i];
   }
   return (xmax - xmin) * (ymax - ymin) * (zmax -zmin) * icount / npoints;
 }
 
+void GeoShape::containsBatch (const double* xyz, size_t n, uint8_t* out) const
+{
+  for (size_t i = 0; i < n; ++i) {
+    out[i] = contains(xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2]);
+  }
+}
+
 const GeoShapeUnion & GeoShape::add (const GeoShape& shape) const
 {
   GeoShapeUnion *unionNode = new GeoShapeUnion (this, &shape);
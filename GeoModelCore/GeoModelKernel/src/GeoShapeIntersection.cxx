@@ -7,6 +7,7 @@
 #include "GeoModelKernel/GeoPolyhedrizeAction.h"
 #include "GeoModelKernel/GeoShapeAction.h"
 #include <stdexcept>
+#include <vector>
 
 const std::string GeoShapeIntersection::s_classType = "Intersection";
 const ShapeType GeoShapeIntersection::s_classTypeID = 0x00;
@@ -45,6 +46,14 @@ bool GeoShapeIntersection::contains (double x, double y, double z) const
   return (getOpA()->contains(x, y, z)) ? getOpB()->contains(x, y, z) : false;
 }
 
+void GeoShapeIntersection::containsBatch (const double* xyz, size_t n, uint8_t* out) const
+{
+  std::vector<uint8_t> inB(n);
+  getOpA()->containsBatch(xyz, n, out);
+  getOpB()->containsBatch(xyz, n, inB.data());
+  for (size_t i = 0; i < n; ++i) out[i] &= inB[i];
+}
+
 void GeoShapeIntersection::exec (GeoShapeAction *action) const
 {
   action->getPath ()->push (this);
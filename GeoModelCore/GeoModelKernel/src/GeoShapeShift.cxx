@@ -6,6 +6,7 @@
 #include "GeoModelKernel/GeoShapeAction.h"
 
 #include <array>
+#include <vector>
 
 const std::string GeoShapeShift::s_classType = "Shift";
 const ShapeType GeoShapeShift::s_classTypeID = 0x03;
@@ -68,6 +69,18 @@ bool GeoShapeShift::contains (double x, double y, double z) const {
   return shape->contains(p.x(), p.y(), p.z());
 }
 
+void GeoShapeShift::containsBatch (const double* xyz, size_t n, uint8_t* out) const {
+  const GeoTrf::Transform3D inverse = getX().inverse();
+  std::vector<double> local(3 * n);
+  for (size_t i = 0; i < n; ++i) {
+    GeoTrf::Vector3D p = inverse * GeoTrf::Vector3D(xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2]);
+    local[3 * i] = p.x();
+    local[3 * i + 1] = p.y();
+    local[3 * i + 2] = p.z();
+  }
+  getOp()->containsBatch(local.data(), n, out);
+}
+
 void GeoShapeShift::exec (GeoShapeAction *action) const {
   action->getPath ()->push (this);
   action->handleShift (this);
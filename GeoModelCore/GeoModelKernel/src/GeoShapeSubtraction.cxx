@@ -8,6 +8,7 @@
 #include "GeoModelKernel/GeoPolyhedrizeAction.h"
 #include "GeoModelKernel/GeoPolyhedron.h"
 #include <stdexcept>
+#include <vector>
 
 const std::string GeoShapeSubtraction::s_classType = "Subtraction";
 const ShapeType GeoShapeSubtraction::s_classTypeID = 0x02;
@@ -54,6 +55,14 @@ bool GeoShapeSubtraction::contains (double x, double y, double z) const
   return (!getOpA()->contains(x, y, z)) ? false : !getOpB()->contains(x, y, z);
 }
 
+void GeoShapeSubtraction::containsBatch (const double* xyz, size_t n, uint8_t* out) const
+{
+  std::vector<uint8_t> inB(n);
+  getOpA()->containsBatch(xyz, n, out);
+  getOpB()->containsBatch(xyz, n, inB.data());
+  for (size_t i = 0; i < n; ++i) out[i] &= !inB[i];
+}
+
 void GeoShapeSubtraction::exec (GeoShapeAction *action) const
 {
   action->getPath ()->push (this);
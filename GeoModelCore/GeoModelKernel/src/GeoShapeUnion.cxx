@@ -8,6 +8,7 @@
 #include "GeoModelKernel/GeoPolyhedron.h"
 #include "GeoModelKernel/GeoPolyhedrizeAction.h"
 #include <stdexcept>
+#include <vector>
 
 const std::string GeoShapeUnion::s_classType = "Union";
 const ShapeType GeoShapeUnion::s_classTypeID = 0x01;
@@ -61,6 +62,13 @@ bool GeoShapeUnion::contains (double x, double y, double z) const {
   return getOpA()->contains(x, y, z) || getOpB()->contains(x, y, z);
 }
 
+void GeoShapeUnion::containsBatch (const double* xyz, size_t n, uint8_t* out) const {
+  std::vector<uint8_t> inB(n);
+  getOpA()->containsBatch(xyz, n, out);
+  getOpB()->containsBatch(xyz, n, inB.data());
+  for (size_t i = 0; i < n; ++i) out[i] |= inB[i];
+}
+
 void GeoShapeUnion::exec (GeoShapeAction *action) const
 {
   action->getPath ()->push (this);
@@ -49,6 +49,19 @@ bool GeoTrd::contains (double x, double y, double z) const
   return (std::max(distx, disty) <= 0.0);
 }
 
+void GeoTrd::containsBatch (const double* xyz, size_t n, uint8_t* out) const
+{
+  for (size_t i = 0; i < n; ++i) {
+    double x = xyz[3 * i], y = xyz[3 * i + 1], z = xyz[3 * i + 2];
+    double t = 0.5 * (1.0 + z / m_zHalfLength);
+    double dx = m_xHalfLength1 + (m_xHalfLength2 - m_xHalfLength1) * t;
+    double dy = m_yHalfLength1 + (m_yHalfLength2 - m_yHalfLength1) * t;
+    double distx = std::abs(x) - dx;
+    double disty = std::abs(y) - dy;
+    out[i] = (std::abs(z) - m_zHalfLength <= 0.0) & (std::max(distx, disty) <= 0.0);
+  }
+}
+
 
 
 void GeoTrd::exec (GeoShapeAction *action) const
@@ -42,6 +42,16 @@ bool GeoTube::contains (double x, double y, double z) const
   return ((rr <= m_rMax * m_rMax) && (rr >= m_rMin * m_rMin));
 }
 
+void GeoTube::containsBatch (const double* xyz, size_t n, uint8_t* out) const
+{
+  const double rmin2 = m_rMin * m_rMin, rmax2 = m_rMax * m_rMax, hz = m_zHalfLength;
+  for (size_t i = 0; i < n; ++i) {
+    double x = xyz[3 * i], y = xyz[3 * i + 1], z = xyz[3 * i + 2];
+    double rr = x * x + y * y;
+    out[i] = (std::abs(z) - hz <= 0.0) & (rr <= rmax2) & (rr >= rmin2);
+  }
+}
+
 void GeoTube::exec (GeoShapeAction *action) const
 {
   action->handleTube(this);
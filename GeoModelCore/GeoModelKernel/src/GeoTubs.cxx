@@ -48,6 +48,29 @@ bool GeoTubs::contains (double x, double y, double z) const
   return (m_dPhi <= M_PI) ? (ds <= 0 && de <= 0) : (ds <= 0 || de <= 0);
 }
 
+void GeoTubs::containsBatch (const double* xyz, size_t n, uint8_t* out) const
+{
+#ifndef M_PI
+  constexpr double M_PI = 3.14159265358979323846;
+#endif
+  const double rmin2 = m_rMin * m_rMin, rmax2 = m_rMax * m_rMax, hz = m_zHalfLength;
+  const bool fullPhi = (m_dPhi >= 2.0 * M_PI);
+  const bool convex = (m_dPhi <= M_PI);
+  const double nsx = std::sin(m_sPhi), nsy = -std::cos(m_sPhi);
+  const double nex = -std::sin(m_sPhi + m_dPhi), ney = std::cos(m_sPhi + m_dPhi);
+  for (size_t i = 0; i < n; ++i) {
+    double x = xyz[3 * i], y = xyz[3 * i + 1], z = xyz[3 * i + 2];
+    double rr = x * x + y * y;
+    bool inPhi = fullPhi;
+    if (!fullPhi) {
+      bool ds = (nsx * x + nsy * y <= 0);
+      bool de = (nex * x + ney * y <= 0);
+      inPhi = convex ? (ds & de) : (ds | de);
+    }
+    out[i] = (std::abs(z) - hz <= 0.0) & (rr <= rmax2) & (rr >= rmin2) & inPhi;
+  }
+}
+
 void GeoTubs::exec (GeoShapeAction *action) const
 {
   action->handleTubs(this);
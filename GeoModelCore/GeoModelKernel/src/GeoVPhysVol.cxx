@@ -5,25 +5,287 @@
 #include "GeoModelKernel/GeoVPhysVol.h"
 #include "GeoModelKernel/GeoVolumeAction.h"
 #include "GeoModelKernel/GeoAccessVolumeAction.h"
-#include "GeoModelKernel/GeoCountVolAction.h"
 #include "GeoModelKernel/GeoCountVolAndSTAction.h"
+#include "GeoModelKernel/GeoAlignableTransform.h"
+#include "GeoModelKernel/GeoNameTag.h"
+#include "GeoModelKernel/GeoIdentifierTag.h"
+#include "GeoModelKernel/GeoSerialDenominator.h"
+#include "GeoModelKernel/GeoSerialIdentifier.h"
+#include "GeoModelKernel/GeoSerialTransformer.h"
 
 #include <stdexcept>
 #include <string>
 #include <mutex>
 
+namespace {
+  /// A physical volume or a serial transformer found among the daughters,
+  /// together with the tags and the transforms which apply to it.
+  struct ChildPlacement {
+    const GeoVPhysVol* volume{nullptr};
+    const GeoSerialTransformer* serialTransformer{nullptr};
+    /// Position of the placing node in the list of daughters
+    unsigned int slot{0};
+    /// Logical index of the first child volume placed by the node
+    unsigned int firstChild{0};
+    /// Range of the pending transforms in ChildIndex::transforms
+    unsigned int firstTrf{0};
+    unsigned int nTrfs{0};
+    /// If one of the pending transforms is alignable, the accumulated
+    /// transforms cannot be cached and are recomputed on every request
+    bool alignable{false};
+    GeoTrf::Transform3D transform{GeoTrf::Transform3D::Identity()};
+    GeoTrf::Transform3D defTransform{GeoTrf::Transform3D::Identity()};
+
+    const GeoNameTag* nameTag{nullptr};
+    const GeoSerialDenominator* serialDenominator{nullptr};
+    unsigned int serialDenomPosition{0};
+    const GeoIdentifierTag* idTag{nullptr};
+    const GeoSerialIdentifier* serialIdentifier{nullptr};
+    unsigned int serialIdentPosition{0};
+  };
+
+  /// Walks once over the daughters of a volume and records a ChildPlacement
+  /// for every physical volume and serial transformer. The bookkeeping of
+  /// the name & id tags follows the one of GeoAccessVolumeAction, the child
+  /// count follows GeoCountVolAction.
+  class ChildIndexBuilder final : public GeoNodeAction {
+    public:
+      ChildIndexBuilder() {
+        setDepthLimit(0);
+      }
+
+      void setSlot(unsigned int slot) { m_slot = slot; }
+
+      virtual void handleTransform(const GeoTransform* xform) override {
+        m_pending.push_back(xform);
+      }
+      virtual void handlePhysVol(const GeoPhysVol* vol) override {
+        addPlacement(vol, nullptr, 1);
+      }
+      virtual void handleFullPhysVol(const GeoFullPhysVol* vol) override {
+        addPlacement(vol, nullptr, 1);
+      }
+      virtual void handleSerialTransformer(const GeoSerialTransformer* sT) override {
+        addPlacement(sT->getVolume(), sT, sT->getNCopies());
+      }
+      virtual void handleVSurface(const GeoVSurface*) override {
+        m_pending.clear();
+        ++m_nSurfaces;
+      }
+      virtual void handleNameTag(const GeoNameTag* nameTag) override {
+        m_nameTag = nameTag;
+        m_serialDenominator = nullptr;
+        m_serialDenomPosition = 0;
+      }
+      virtual void handleSerialDenominator(const GeoSerialDenominator* sD) override {
+        m_serialDenominator = sD;
+        m_serialDenomPosition = m_counter;
+      }
+      virtual void handleIdentifierTag(const GeoIdentifierTag* idTag) override {
+        m_idTag = idTag;
+        m_serialIdentifier = nullptr;
+        m_serialIdentPosition = 0;
+      }
+      virtual void handleSerialIdentifier(const GeoSerialIdentifier* sI) override {
+        m_serialIdentifier = sI;
+        m_serialIdentPosition = m_counter;
+      }
+
+      std::vector<ChildPlacement> placements{};
+      std::vector<unsigned int> placementOfChild{};
+      std::vector<const GeoTransform*> transforms{};
+
+      unsigned int nChildVols() const { return m_counter + m_nSurfaces; }
+
+    private:
+      void addPlacement(const GeoVPhysVol* vol,
+                        const GeoSerialTransformer* sT,
+                        unsigned int nCopies) {
+        if (nCopies == 0) {
+          m_pending.clear();
+          m_nameTag = nullptr;
+          m_idTag = nullptr;
+          return;
+        }
+        ChildPlacement& placement = placements.emplace_back();
+        placement.volume = vol;
+        placement.serialTransformer = sT;
+        placement.slot = m_slot;
+        placement.firstChild = m_counter;
+        placement.firstTrf = transforms.size();
+        placement.nTrfs = m_pending.size();
+        for (const GeoTransform* xform : m_pending) {
+          transforms.push_back(xform);
+          placement.alignable |= dynamic_cast<const GeoAlignableTransform*>(xform) != nullptr;
+          placement.transform = placement.transform * xform->getTransform();
+          placement.defTransform = placement.defTransform * xform->getDefTransform();
+        }
+        placement.nameTag = m_nameTag;
+        placement.serialDenominator = m_serialDenominator;
+        placement.serialDenomPosition = m_serialDenomPosition;
+        placement.idTag = m_idTag;
+        placement.serialIdentifier = m_serialIdentifier;
+        placement.serialIdentPosition = m_serialIdentPosition;
+
+        placementOfChild.insert(placementOfChild.end(), nCopies, placements.size() - 1);
+        m_counter += nCopies;
+
+        m_pending.clear();
+        m_nameTag = nullptr;
+        m_idTag = nullptr;
+      }
+
+      unsigned int m_slot{0};
+      unsigned int m_counter{0};
+      unsigned int m_nSurfaces{0};
+      std::vector<const GeoTransform*> m_pending{};
+      const GeoNameTag* m_nameTag{nullptr};
+      const GeoSerialDenominator* m_serialDenominator{nullptr};
+      unsigned int m_serialDenomPosition{0};
+      const GeoIdentifierTag* m_idTag{nullptr};
+      const GeoSerialIdentifier* m_serialIdentifier{nullptr};
+      unsigned int m_serialIdentPosition{0};
+  };
+}
+
+struct GeoVPhysVol::ChildIndex {
+  std::vector<ChildPlacement> placements{};
+  /// Index of the placement for each logical child volume
+  std::vector<unsigned int> placementOfChild{};
+  std::vector<const GeoTransform*> transforms{};
+  /// Number of children as counted by the GeoCountVolAction
+  unsigned int nChildVols{0};
+
+  /// Returns the placement of the ith child volume or nullptr if the index
+  /// is not covered by the table (e.g. virtual surfaces)
+  const ChildPlacement* find(unsigned int index) const {
+    return index < placementOfChild.size() ? &placements[placementOfChild[index]] : nullptr;
+  }
+
+  GeoTrf::Transform3D transform(const ChildPlacement& placement, unsigned int index,
+                                const GeoVAlignmentStore* store, bool defTrf) const {
+    GeoTrf::Transform3D xform{defTrf ? placement.defTransform : placement.transform};
+    if (placement.alignable) {
+      xform = GeoTrf::Transform3D::Identity();
+      for (unsigned int t = placement.firstTrf; t < placement.firstTrf + placement.nTrfs; ++t) {
+        xform = xform * (defTrf ? transforms[t]->getDefTransform(store)
+                                : transforms[t]->getTransform(store));
+      }
+    }
+    if (placement.serialTransformer) {
+      xform = xform * placement.serialTransformer->getTransform(index - placement.firstChild);
+    }
+    return xform;
+  }
+
+  static std::string name(const ChildPlacement& placement, unsigned int index) {
+    if (placement.nameTag) {
+      return placement.nameTag->getName();
+    } else if (placement.serialDenominator) {
+      return placement.serialDenominator->getBaseName() +
+             std::to_string(index - placement.serialDenomPosition);
+    }
+    return "ANON";
+  }
+
+  static std::optional<int> id(const ChildPlacement& placement, unsigned int index) {
+    if (placement.idTag) {
+      return std::optional<int>(placement.idTag->getIdentifier());
+    } else if (placement.serialIdentifier) {
+      return std::optional<int>(index - placement.serialIdentPosition +
+                                placement.serialIdentifier->getBaseId());
+    }
+    return std::nullopt;
+  }
+};
+
+struct GeoVPhysVol::LazyDaughters {
+  std::once_flag loaded{};
+  std::unique_ptr<DaughterLoader> loader{};
+};
+
 GeoVPhysVol::GeoVPhysVol(const GeoLogVol* LogVol): 
     m_logVol(LogVol) {}
 
+GeoVPhysVol::~GeoVPhysVol() = default;
+
+void GeoVPhysVol::setDaughterLoader(std::unique_ptr<DaughterLoader> loader) {
+  m_lazyDaughters = std::make_unique<LazyDaughters>();
+  m_lazyDaughters->loader = std::move(loader);
+}
+
+void GeoVPhysVol::loadDaughters() const {
+  if (!m_lazyDaughters || !m_lazyDaughters->loader) return;
+  std::call_once(m_lazyDaughters->loaded, [this]() {
+    m_lazyDaughters->loader->loadDaughters(const_cast<GeoVPhysVol&>(*this));
+  });
+}
+
+const GeoVPhysVol::ChildIndex& 
+  GeoVPhysVol::childIndex(std::shared_lock<std::shared_mutex>& lock) const {
+  while (!m_childIndex) {
+    lock.unlock();
+    loadDaughters();
+    {
+      std::unique_lock guard{m_muxVec};
+      if (!m_childIndex) {
+        ChildIndexBuilder builder{};
+        for (unsigned int slot = 0; slot < m_daughters.size(); ++slot) {
+          builder.setSlot(slot);
+          m_daughters[slot]->exec(&builder);
+        }
+        auto index = std::make_unique<ChildIndex>();
+        index->placements = std::move(builder.placements);
+        index->placementOfChild = std::move(builder.placementOfChild);
+        index->transforms = std::move(builder.transforms);
+        index->nChildVols = builder.nChildVols();
+        m_childIndex = std::move(index);
+      }
+    }
+    lock.lock();
+  }
+  return *m_childIndex;
+}
+
+void GeoVPhysVol::resetChildIndex() {
+  m_childIndex.reset();
+}
+
 std::optional<unsigned int> GeoVPhysVol::indexOf(const PVConstLink& daughter) const {
-  unsigned int nChildVols{getNChildVols()};
-  for(unsigned int i=0; i<nChildVols; i++) { // To Do: replace this with Volume Iterator!
-    if(getChildVol(i) == daughter) return std::optional<unsigned int>{i};
+  std::shared_lock lk{m_muxVec};
+  for (const ChildPlacement& placement : childIndex(lk).placements) {
+    if (placement.volume == daughter) return std::optional<unsigned int>{placement.firstChild};
   }
   return std::nullopt;
 }
 
 void GeoVPhysVol::apply(GeoVolumeAction *action) const {
+  auto applyToChild = [this, action](unsigned int d) {
+    PVConstLink child{};
+    {
+      std::shared_lock lk{m_muxVec};
+      const ChildIndex& index = childIndex(lk);
+      if (const ChildPlacement* placement = index.find(d)) {
+        action->getState()->setTransform(index.transform(*placement, d, nullptr, false));
+        action->getState()->setDefTransform(index.transform(*placement, d, nullptr, true));
+        action->getState()->setId(ChildIndex::id(*placement, d));
+        action->getState()->setName(ChildIndex::name(*placement, d));
+        child = placement->volume;
+      }
+    }
+    if (!child) {
+      GeoAccessVolumeAction av(d,nullptr);
+      exec(&av);
+
+      action->getState()->setTransform(av.getTransform());
+      action->getState()->setDefTransform(av.getDefTransform());
+      action->getState()->setId(av.getId());
+      action->getState()->setName(av.getName());
+      child = av.getVolume();
+    }
+    child->apply(action);
+  };
+
   int nVols(0);
   switch(action->getType()) {
   case GeoVolumeAction::TOP_DOWN:
@@ -33,15 +295,7 @@ void GeoVPhysVol::apply(GeoVolumeAction *action) const {
     action->getState()->nextLevel(this);
     nVols = getNChildVols();
     for(int d = 0; d < nVols; d++) {
-      GeoAccessVolumeAction av(d,nullptr);
-      exec (&av);
-
-      action->getState()->setTransform(av.getTransform());
-      action->getState()->setDefTransform(av.getDefTransform());
-      action->getState()->setId(av.getId());
-      action->getState()->setName(av.getName());
-
-      av.getVolume()->apply(action);
+      applyToChild(d);
       if(action->shouldTerminate()) break;
     }
     action->getState()->previousLevel();
@@ -50,15 +304,7 @@ void GeoVPhysVol::apply(GeoVolumeAction *action) const {
     action->getState()->nextLevel(this);
     nVols = getNChildVols();
     for(int d = 0; d < nVols; d++) {
-      GeoAccessVolumeAction av(d,nullptr);
-      exec(&av);
-
-      action->getState()->setTransform(av.getTransform());
-      action->getState()->setDefTransform(av.getDefTransform());
-      action->getState()->setId(av.getId());
-      action->getState()->setName(av.getName());
-
-      av.getVolume()->apply(action);
+      applyToChild(d);
       if(action->shouldTerminate()) break;
     }
     action->getState()->previousLevel();
@@ -72,18 +318,35 @@ void GeoVPhysVol::apply(GeoVolumeAction *action) const {
 }
 
 void GeoVPhysVol::add(const GeoIntrusivePtr<GeoGraphNode>& graphNode) {
+  // the daughters of the loader come first, as if they had been added eagerly
+  loadDaughters();
+  addDaughter(graphNode);
+}
+
+void GeoVPhysVol::DaughterLoader::appendDaughter(GeoVPhysVol& volume,
+                                                 const GeoIntrusivePtr<GeoGraphNode>& graphNode) {
+  volume.addDaughter(graphNode);
+}
+
+void GeoVPhysVol::addDaughter(const GeoIntrusivePtr<GeoGraphNode>& graphNode) {
   std::unique_lock lk{m_muxVec};
   m_daughters.emplace_back(graphNode);
+  resetChildIndex();
   graphNode->dockTo(this);
 }
 
 unsigned int GeoVPhysVol::getNChildVols() const {
-  GeoCountVolAction cv;
-  exec(&cv);
-  return cv.getCount();
+  std::shared_lock lk{m_muxVec};
+  return childIndex(lk).nChildVols;
 }
 
 PVConstLink GeoVPhysVol::getChildVol(unsigned int index) const {
+  {
+    std::shared_lock lk{m_muxVec};
+    if (const ChildPlacement* placement = childIndex(lk).find(index)) {
+      return placement->volume;
+    }
+  }
   GeoAccessVolumeAction av(index,nullptr);
   exec(&av);
   return av.getVolume();
@@ -91,6 +354,13 @@ PVConstLink GeoVPhysVol::getChildVol(unsigned int index) const {
 
 GeoTrf::Transform3D GeoVPhysVol::getXToChildVol(unsigned int index, 
                                                 const GeoVAlignmentStore* store) const {
+  {
+    std::shared_lock lk{m_muxVec};
+    const ChildIndex& childIdx = childIndex(lk);
+    if (const ChildPlacement* placement = childIdx.find(index)) {
+      return childIdx.transform(*placement, index, store, false);
+    }
+  }
   GeoAccessVolumeAction av(index,store);
   exec(&av);
   return av.getTransform();
@@ -99,6 +369,13 @@ GeoTrf::Transform3D GeoVPhysVol::getXToChildVol(unsigned int index,
 GeoTrf::Transform3D GeoVPhysVol::getDefXToChildVol(unsigned int index,
                                                    const GeoVAlignmentStore* store) const
 {
+  {
+    std::shared_lock lk{m_muxVec};
+    const ChildIndex& childIdx = childIndex(lk);
+    if (const ChildPlacement* placement = childIdx.find(index)) {
+      return childIdx.transform(*placement, index, store, true);
+    }
+  }
   GeoAccessVolumeAction av(index,store);
   exec(&av);
   return av.getDefTransform();
@@ -106,12 +383,24 @@ GeoTrf::Transform3D GeoVPhysVol::getDefXToChildVol(unsigned int index,
 
 
 std::string GeoVPhysVol::getNameOfChildVol(unsigned int i) const {
+  {
+    std::shared_lock lk{m_muxVec};
+    if (const ChildPlacement* placement = childIndex(lk).find(i)) {
+      return ChildIndex::name(*placement, i);
+    }
+  }
   GeoAccessVolumeAction av(i,nullptr);
   exec(&av);
   return av.getName();
 }
 
 std::optional<int> GeoVPhysVol::getIdOfChildVol(unsigned int i) const {
+  {
+    std::shared_lock lk{m_muxVec};
+    if (const ChildPlacement* placement = childIndex(lk).find(i)) {
+      return ChildIndex::id(*placement, i);
+    }
+  }
   GeoAccessVolumeAction    av(i,nullptr);
   exec(&av);
   return av.getId();
@@ -124,16 +413,19 @@ unsigned int GeoVPhysVol::getNChildVolAndST() const {
 }
 
 unsigned int GeoVPhysVol::getNChildNodes() const {
+  loadDaughters();
   std::shared_lock lk{m_muxVec};
   return m_daughters.size();
 }
 
 const GeoGraphNode * const * GeoVPhysVol::getChildNode(unsigned int i) const {
+  loadDaughters();
   std::shared_lock lk{m_muxVec};
   return m_daughters[i];
 }
 
 const GeoGraphNode * const * GeoVPhysVol::findChildNode(const GeoGraphNode * n) const {
+  loadDaughters();
   std::shared_lock lk{m_muxVec};
   std::vector<GeoIntrusivePtr<GeoGraphNode>>::const_iterator i = std::find(m_daughters.begin(),m_daughters.end(),n);
   if (i==m_daughters.end()) {
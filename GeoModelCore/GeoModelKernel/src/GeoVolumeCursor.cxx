@@ -7,6 +7,8 @@
 #include "GeoModelKernel/GeoNameTag.h"
 #include "GeoModelKernel/GeoSerialDenominator.h"
 #include "GeoModelKernel/GeoSerialIdentifier.h"
+#include "GeoModelKernel/GeoSerialTransformer.h"
+#include <algorithm>
 #include <string>
 #include <utility>
 
@@ -48,6 +50,7 @@ void GeoVolumeCursor::next() {
       next();
     }
     else {
+      if (m_minorIndex % s_serialBatchSize == 0) fillSerialTransforms();
       m_volCount++;
     }              
   }
@@ -166,6 +169,7 @@ void GeoVolumeCursor::handleSerialTransformer (const GeoSerialTransformer  *sT)
   m_minorIndex = 0;
   m_serialTransformer = sT;
   m_volume = sT->getVolume();
+  fillSerialTransforms();
   
   unsigned int listSize = m_pendingTransformList.size ();
   if (listSize == 0) {
@@ -210,6 +214,12 @@ void GeoVolumeCursor::handleSerialIdentifier(const GeoSerialIdentifier *sI)
   m_serialIdentPosition =m_volCount;
 }
 
+void GeoVolumeCursor::fillSerialTransforms()
+{
+  const unsigned int end = std::min(m_minorIndex + s_serialBatchSize, m_minorLimit);
+  m_serialTransformer->getTransforms(m_minorIndex, end, m_serialTransforms);
+}
+
 PVConstLink GeoVolumeCursor::getVolume () const
 {
   return m_volume;
@@ -223,7 +233,7 @@ VSConstLink GeoVolumeCursor::getSurface () const
 GeoTrf::Transform3D GeoVolumeCursor::getTransform () const
 {
   if (m_minorLimit) {
-    return m_transform*m_serialTransformer->getTransform(m_minorIndex);
+    return m_transform*m_serialTransforms[m_minorIndex % s_serialBatchSize];
   }
   else {
     return m_transform;
@@ -233,7 +243,7 @@ GeoTrf::Transform3D GeoVolumeCursor::getTransform () const
 GeoTrf::Transform3D GeoVolumeCursor::getDefTransform () const
 {
   if (m_minorLimit) {
-    return m_defTransform*m_serialTransformer->getTransform(m_minorIndex);
+    return m_defTransform*m_serialTransforms[m_minorIndex % s_serialBatchSize];
   }
   else {
     return m_defTransform;
@@ -0,0 +1,143 @@
+// Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+
+/// Checks that the indexed child access of GeoVPhysVol returns the same answers
+/// as the GeoAccessVolumeAction and compares the time needed to loop over all
+/// children with both approaches.
+
+#include "GeoModelKernel/GeoAccessVolumeAction.h"
+#include "GeoModelKernel/GeoAlignableTransform.h"
+#include "GeoModelKernel/GeoBox.h"
+#include "GeoModelKernel/GeoFullPhysVol.h"
+#include "GeoModelKernel/GeoIdentifierTag.h"
+#include "GeoModelKernel/GeoNameTag.h"
+#include "GeoModelKernel/GeoPhysVol.h"
+#include "GeoModelKernel/GeoSerialDenominator.h"
+#include "GeoModelKernel/GeoSerialIdentifier.h"
+#include "GeoModelKernel/GeoSerialTransformer.h"
+#include "GeoModelKernel/GeoTransform.h"
+#include "GeoModelKernel/GeoXF.h"
+#include "GeoGenericFunctions/Variable.h"
+#include "GeoModelKernel/Units.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+using namespace GeoXF;
+using namespace GeoGenfun;
+
+namespace {
+    GeoLogVol* makeLogVol(const std::string& name) {
+        static GeoIntrusivePtr<GeoMaterial> air{new GeoMaterial("Air", 1.)};
+        return new GeoLogVol(name, new GeoBox(1., 1., 1.), air);
+    }
+
+    bool compareChildren(const GeoVPhysVol* mother) {
+        const unsigned int nChildren = mother->getNChildVols();
+        for (unsigned int i = 0; i < nChildren; ++i) {
+            GeoAccessVolumeAction av{i, nullptr};
+            mother->exec(&av);
+            if (mother->getChildVol(i) != av.getVolume()) {
+                std::cerr<<"testChildIndex() "<<__LINE__<<" Volume mismatch for child "<<i<<std::endl;
+                return false;
+            }
+            if (!mother->getXToChildVol(i).isApprox(av.getTransform()) ||
+                !mother->getDefXToChildVol(i).isApprox(av.getDefTransform())) {
+                std::cerr<<"testChildIndex() "<<__LINE__<<" Transform mismatch for child "<<i<<std::endl;
+                return false;
+            }
+            if (mother->getNameOfChildVol(i) != av.getName()) {
+                std::cerr<<"testChildIndex() "<<__LINE__<<" Name mismatch for child "<<i<<": "
+                         <<mother->getNameOfChildVol(i)<<" vs. "<<av.getName()<<std::endl;
+                return false;
+            }
+            if (mother->getIdOfChildVol(i) != av.getId()) {
+                std::cerr<<"testChildIndex() "<<__LINE__<<" Identifier mismatch for child "<<i<<std::endl;
+                return false;
+            }
+            if (av.getVolume() && mother->indexOf(av.getVolume()) > i) {
+                std::cerr<<"testChildIndex() "<<__LINE__<<" indexOf() failed for child "<<i<<std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main() {
+    GeoIntrusivePtr<GeoPhysVol> world{new GeoPhysVol(makeLogVol("World"))};
+
+    world->add(new GeoNameTag("Named"));
+    world->add(new GeoTransform(GeoTrf::TranslateX3D(10.)));
+    world->add(new GeoTransform(GeoTrf::RotateZ3D(0.1)));
+    world->add(new GeoPhysVol(makeLogVol("Named")));
+
+    /// Plain volumes without any tags
+    world->add(new GeoPhysVol(makeLogVol("Anon")));
+
+    /// A serial transformer with serial name & identifier
+    Variable i;
+    GENFUNCTION f = 360 * GeoModelKernelUnits::deg / 64 * i;
+    TRANSFUNCTION t = Pow(GeoTrf::RotateZ3D(1.0), f) * GeoTrf::TranslateX3D(100.);
+    world->add(new GeoSerialDenominator("Plate"));
+    world->add(new GeoSerialIdentifier(1000));
+    world->add(new GeoTransform(GeoTrf::TranslateZ3D(5.)));
+    world->add(new GeoSerialTransformer(new GeoPhysVol(makeLogVol("Plate")), &t, 64));
+
+    /// An alignable volume
+    GeoIntrusivePtr<GeoAlignableTransform> alignable{new GeoAlignableTransform(GeoTrf::TranslateY3D(20.))};
+    world->add(new GeoIdentifierTag(42));
+    world->add(alignable);
+    world->add(new GeoFullPhysVol(makeLogVol("Aligned")));
+
+    /// The serial denominator is still in charge for the following volumes
+    for (unsigned int k = 0; k < 10; ++k) {
+        world->add(new GeoTransform(GeoTrf::TranslateZ3D(k)));
+        world->add(new GeoPhysVol(makeLogVol("Serial")));
+    }
+
+    if (!compareChildren(world)) return EXIT_FAILURE;
+
+    /// The index must follow the alignment
+    alignable->setDelta(GeoTrf::TranslateX3D(1.));
+    if (!compareChildren(world)) return EXIT_FAILURE;
+
+    /// ... and the addition of new children
+    world->add(new GeoNameTag("Late"));
+    world->add(new GeoPhysVol(makeLogVol("Late")));
+    if (world->getNameOfChildVol(world->getNChildVols() - 1) != "Late") {
+        std::cerr<<"testChildIndex() "<<__LINE__<<" The index has not been updated."<<std::endl;
+        return EXIT_FAILURE;
+    }
+    if (!compareChildren(world)) return EXIT_FAILURE;
+
+    /// Scaling of the loop over all children
+    for (unsigned int nChildren : {1000, 2000, 4000}) {
+        GeoIntrusivePtr<GeoPhysVol> mother{new GeoPhysVol(makeLogVol("Mother"))};
+        for (unsigned int k = 0; k < nChildren; ++k) {
+            mother->add(new GeoTransform(GeoTrf::TranslateX3D(k)));
+            mother->add(new GeoPhysVol(makeLogVol("Child")));
+        }
+        using clock = std::chrono::steady_clock;
+        double sum{0.};
+        const auto t0 = clock::now();
+        for (unsigned int k = 0; k < nChildren; ++k) {
+            GeoAccessVolumeAction av{k, nullptr};
+            mother->exec(&av);
+            sum += av.getTransform().translation().x();
+        }
+        const auto t1 = clock::now();
+        for (unsigned int k = 0; k < nChildren; ++k) {
+            sum -= mother->getXToChildVol(k).translation().x();
+        }
+        const auto t2 = clock::now();
+        if (std::abs(sum) > 1.e-9) {
+            std::cerr<<"testChildIndex() "<<__LINE__<<" Inconsistent transforms "<<sum<<std::endl;
+            return EXIT_FAILURE;
+        }
+        std::cout<<"testChildIndex() "<<nChildren<<" children: GeoAccessVolumeAction "
+                 <<std::chrono::duration<double, std::milli>(t1 - t0).count()<<" ms, indexed access "
+                 <<std::chrono::duration<double, std::milli>(t2 - t1).count()<<" ms"<<std::endl;
+    }
+    return EXIT_SUCCESS;
+}
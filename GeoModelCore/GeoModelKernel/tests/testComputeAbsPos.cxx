@@ -0,0 +1,163 @@
+// Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+
+/// Checks that GeoComputeAbsPosAction fills the same (default) absolute transforms
+/// as the ones computed on demand by GeoNodePositioning, with and without an
+/// alignment store, and compares the time needed by both approaches.
+
+#include "GeoModelKernel/GeoAlignableTransform.h"
+#include "GeoModelKernel/GeoBox.h"
+#include "GeoModelKernel/GeoClearAbsPosAction.h"
+#include "GeoModelKernel/GeoComputeAbsPosAction.h"
+#include "GeoModelKernel/GeoFullPhysVol.h"
+#include "GeoModelKernel/GeoNameTag.h"
+#include "GeoModelKernel/GeoPhysVol.h"
+#include "GeoModelKernel/GeoSerialTransformer.h"
+#include "GeoModelKernel/GeoTransform.h"
+#include "GeoModelKernel/GeoVAlignmentStore.h"
+#include "GeoModelKernel/GeoXF.h"
+#include "GeoGenericFunctions/Variable.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+
+using namespace GeoXF;
+using namespace GeoGenfun;
+
+namespace {
+    class AlignmentStore : public GeoVAlignmentStore {
+      public:
+        void setDelta(const GeoAlignableTransform* x, const GeoTrf::Transform3D& delta) override { m_deltas[x] = delta; }
+        const GeoTrf::Transform3D* getDelta(const GeoAlignableTransform* x) const override { return find(m_deltas, x); }
+        void setAbsPosition(const GeoNodePositioning* n, const GeoTrf::Transform3D& x) override { m_abs[n] = x; }
+        const GeoTrf::Transform3D* getAbsPosition(const GeoNodePositioning* n) const override { return find(m_abs, n); }
+        void setDefAbsPosition(const GeoNodePositioning* n, const GeoTrf::Transform3D& x) override { m_defAbs[n] = x; }
+        const GeoTrf::Transform3D* getDefAbsPosition(const GeoNodePositioning* n) const override { return find(m_defAbs, n); }
+        void clearPositions() {
+            m_abs.clear();
+            m_defAbs.clear();
+        }
+      private:
+        template <class Key>
+        static const GeoTrf::Transform3D* find(const std::map<Key, GeoTrf::Transform3D>& m, Key k) {
+            auto it = m.find(k);
+            return it != m.end() ? &it->second : nullptr;
+        }
+        std::map<const GeoAlignableTransform*, GeoTrf::Transform3D> m_deltas{};
+        std::map<const GeoNodePositioning*, GeoTrf::Transform3D> m_abs{};
+        std::map<const GeoNodePositioning*, GeoTrf::Transform3D> m_defAbs{};
+    };
+
+    GeoLogVol* makeLogVol(const std::string& name) {
+        static GeoIntrusivePtr<GeoMaterial> air{new GeoMaterial("Air", 1.)};
+        return new GeoLogVol(name, new GeoBox(1., 1., 1.), air);
+    }
+
+    constexpr unsigned int nModules = 8;
+    constexpr unsigned int nLayers = 20;
+    constexpr unsigned int nSensors = 50;
+
+    /// A world with aligned modules, made of layers of sensors, plus a
+    /// shared volume and a serial transformer, which cannot be positioned
+    GeoIntrusivePtr<GeoPhysVol> buildTree(std::vector<const GeoVFullPhysVol*>& sensors,
+                                          std::vector<GeoAlignableTransform*>& alignables) {
+        GeoIntrusivePtr<GeoPhysVol> world{new GeoPhysVol(makeLogVol("World"))};
+        for (unsigned int m = 0; m < nModules; ++m) {
+            GeoAlignableTransform* alignable{new GeoAlignableTransform(GeoTrf::RotateZ3D(0.7 * m) *
+                                                                       GeoTrf::TranslateX3D(100.))};
+            alignables.push_back(alignable);
+            GeoFullPhysVol* module{new GeoFullPhysVol(makeLogVol("Module"))};
+            world->add(new GeoNameTag("Module"));
+            world->add(alignable);
+            world->add(module);
+            for (unsigned int l = 0; l < nLayers; ++l) {
+                GeoPhysVol* layer{new GeoPhysVol(makeLogVol("Layer"))};
+                module->add(new GeoTransform(GeoTrf::TranslateZ3D(5. * l)));
+                module->add(new GeoTransform(GeoTrf::RotateY3D(0.01 * l)));
+                module->add(layer);
+                for (unsigned int s = 0; s < nSensors; ++s) {
+                    GeoFullPhysVol* sensor{new GeoFullPhysVol(makeLogVol("Sensor"))};
+                    layer->add(new GeoNameTag("Sensor"));
+                    layer->add(new GeoTransform(GeoTrf::TranslateY3D(2. * s) * GeoTrf::RotateX3D(0.02 * s)));
+                    layer->add(sensor);
+                    sensors.push_back(sensor);
+                }
+            }
+        }
+        GeoPhysVol* shared{new GeoPhysVol(makeLogVol("Shared"))};
+        shared->add(new GeoFullPhysVol(makeLogVol("Unplaced")));
+        world->add(shared);
+        world->add(new GeoTransform(GeoTrf::TranslateZ3D(-50.)));
+        world->add(shared);
+        Variable i;
+        GENFUNCTION f = 3. * i;
+        TRANSFUNCTION t = Pow(GeoTrf::TranslateZ3D(1.), f);
+        world->add(new GeoSerialTransformer(new GeoFullPhysVol(makeLogVol("Serial")), &t, 10));
+        return world;
+    }
+
+    template <class Compute>
+    double timeIt(Compute compute) {
+        const auto start = std::chrono::high_resolution_clock::now();
+        compute();
+        const auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+}
+
+int main() {
+    std::vector<const GeoVFullPhysVol*> sensors{};
+    std::vector<GeoAlignableTransform*> alignables{};
+    GeoIntrusivePtr<GeoPhysVol> world{buildTree(sensors, alignables)};
+    AlignmentStore store{};
+    for (unsigned int m = 0; m < alignables.size(); ++m) {
+        alignables[m]->setDelta(GeoTrf::TranslateY3D(0.1 * m));
+        store.setDelta(alignables[m], GeoTrf::RotateZ3D(0.001 * m));
+    }
+
+    // the reference, computed on demand
+    std::vector<GeoTrf::Transform3D> absRef{}, defAbsRef{}, storeRef{};
+    const double onDemandTime = timeIt([&]() {
+        for (const GeoVFullPhysVol* sensor : sensors) {
+            absRef.push_back(sensor->getAbsoluteTransform());
+            defAbsRef.push_back(sensor->getDefAbsoluteTransform());
+        }
+    });
+    for (const GeoVFullPhysVol* sensor : sensors) {
+        storeRef.push_back(sensor->getAbsoluteTransform(&store));
+    }
+
+    const unsigned int expected = nModules + nModules * nLayers * nSensors;
+    for (unsigned int nThreads : {1u, 4u}) {
+        GeoClearAbsPosAction clearAction{};
+        world->exec(&clearAction);
+        store.clearPositions();
+
+        GeoComputeAbsPosAction computeAction{nullptr, nThreads};
+        const double batchTime = timeIt([&]() { computeAction.apply(world); });
+        if (computeAction.getNFullPhysVols() != expected) {
+            std::cerr<<"testComputeAbsPos() "<<__LINE__<<" Filled "<<computeAction.getNFullPhysVols()
+                     <<" volumes instead of "<<expected<<std::endl;
+            return EXIT_FAILURE;
+        }
+        GeoComputeAbsPosAction storeAction{&store, nThreads};
+        storeAction.apply(world);
+
+        for (unsigned int s = 0; s < sensors.size(); ++s) {
+            if (!sensors[s]->getCachedAbsoluteTransform().isApprox(absRef[s]) ||
+                !sensors[s]->getCachedDefAbsoluteTransform().isApprox(defAbsRef[s])) {
+                std::cerr<<"testComputeAbsPos() "<<__LINE__<<" Transform mismatch for sensor "<<s<<std::endl;
+                return EXIT_FAILURE;
+            }
+            if (!sensors[s]->getCachedAbsoluteTransform(&store).isApprox(storeRef[s]) ||
+                !sensors[s]->getCachedDefAbsoluteTransform(&store).isApprox(defAbsRef[s])) {
+                std::cerr<<"testComputeAbsPos() "<<__LINE__<<" Aligned transform mismatch for sensor "<<s<<std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+        std::cout<<"testComputeAbsPos() -- "<<sensors.size()<<" sensors, on demand: "<<onDemandTime
+                 <<" ms, batch with "<<nThreads<<" thread(s): "<<batchTime<<" ms"<<std::endl;
+    }
+    return EXIT_SUCCESS;
+}
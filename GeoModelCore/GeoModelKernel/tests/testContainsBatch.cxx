@@ -0,0 +1,120 @@
+// Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+
+/// Checks that GeoShape::containsBatch classifies the points as contains() does,
+/// that the Monte Carlo volume of a boolean shape agrees with the analytic
+/// one, and that volume() keeps the points of its serial Monte Carlo.
+
+#include "GeoModelKernel/GeoBox.h"
+#include "GeoModelKernel/GeoCons.h"
+#include "GeoModelKernel/GeoEllipticalTube.h"
+#include "GeoModelKernel/GeoPara.h"
+#include "GeoModelKernel/GeoShapeIntersection.h"
+#include "GeoModelKernel/GeoShapeShift.h"
+#include "GeoModelKernel/GeoShapeSubtraction.h"
+#include "GeoModelKernel/GeoShapeUnion.h"
+#include "GeoModelKernel/GeoTrd.h"
+#include "GeoModelKernel/GeoTube.h"
+#include "GeoModelKernel/GeoTubs.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+    bool compareContains(const GeoShape& shape) {
+        double xmin{0.}, ymin{0.}, zmin{0.}, xmax{0.}, ymax{0.}, zmax{0.};
+        shape.extent(xmin, ymin, zmin, xmax, ymax, zmax);
+        std::mt19937 generator{12345};
+        std::uniform_real_distribution<double> u{-0.2, 1.2};
+        constexpr size_t n = 20000;
+        std::vector<double> xyz(3 * n);
+        for (size_t i = 0; i < n; ++i) {
+            xyz[3 * i] = xmin + (xmax - xmin) * u(generator);
+            xyz[3 * i + 1] = ymin + (ymax - ymin) * u(generator);
+            xyz[3 * i + 2] = zmin + (zmax - zmin) * u(generator);
+        }
+        std::vector<uint8_t> out(n, 2);
+        shape.containsBatch(xyz.data(), n, out.data());
+        for (size_t i = 0; i < n; ++i) {
+            if (out[i] != shape.contains(xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2])) {
+                std::cerr << "testContainsBatch() " << __LINE__ << " " << shape.type() << ": mismatch for point ("
+                          << xyz[3 * i] << ", " << xyz[3 * i + 1] << ", " << xyz[3 * i + 2] << ")" << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // GeoShape::volume point by point, with contains()
+    double referenceVolume(const GeoShape& shape, int npoints) {
+        double xmin{0.}, ymin{0.}, zmin{0.}, xmax{0.}, ymax{0.}, zmax{0.};
+        shape.extent(xmin, ymin, zmin, xmax, ymax, zmax);
+        const double delx = (xmax - xmin) * 0.001, dely = (ymax - ymin) * 0.001, delz = (zmax - zmin) * 0.001;
+        xmin -= delx; ymin -= dely; zmin -= delz;
+        xmax += delx; ymax += dely; zmax += delz;
+        uint32_t x = 2463534242;
+        auto next = [&x]() {
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+            return x * (1. / 4294967296.);
+        };
+        int icount = 0;
+        for (int i = 0; i < npoints; ++i) {
+            const double px = xmin + (xmax - xmin) * next();
+            const double py = ymin + (ymax - ymin) * next();
+            const double pz = zmin + (zmax - zmin) * next();
+            icount += shape.contains(px, py, pz);
+        }
+        return (xmax - xmin) * (ymax - ymin) * (zmax - zmin) * icount / npoints;
+    }
+}
+
+int main() {
+    GeoIntrusivePtr<GeoBox> box{new GeoBox(100., 80., 60.)};
+    GeoIntrusivePtr<GeoTube> tube{new GeoTube(10., 40., 70.)};
+    std::vector<GeoIntrusivePtr<const GeoShape>> shapes{
+        box, tube,
+        new GeoTubs(10., 40., 50., 0.3, 1.2),
+        new GeoTubs(10., 40., 50., -0.5, 4.5),
+        new GeoCons(5., 10., 20., 40., 30., 0.1, 2.),
+        new GeoCons(5., 10., 20., 40., 30., 0., 2. * M_PI),
+        new GeoTrd(10., 20., 15., 5., 30.),
+        new GeoEllipticalTube(20., 10., 30.),
+        new GeoPara(20., 15., 10., 0.2, 0.3, 0.4),
+        new GeoShapeShift(box, GeoTrf::TranslateX3D(50.) * GeoTrf::RotateZ3D(0.3)),
+        new GeoShapeUnion(box, new GeoShapeShift(tube, GeoTrf::TranslateX3D(100.))),
+        new GeoShapeIntersection(box, tube),
+    };
+    for (const GeoIntrusivePtr<const GeoShape>& shape : shapes) {
+        if (!compareContains(*shape)) return EXIT_FAILURE;
+    }
+
+    // box minus tube, the boolean volume is estimated by Monte Carlo
+    GeoIntrusivePtr<GeoShapeSubtraction> subtraction{new GeoShapeSubtraction(box, new GeoTube(0., 50., 100.))};
+    if (!compareContains(*subtraction)) return EXIT_FAILURE;
+    const double expected = box->volume() - M_PI * 50. * 50. * 120.;
+    const auto start = std::chrono::high_resolution_clock::now();
+    const double subtractionVolume = subtraction->volume();
+    const auto end = std::chrono::high_resolution_clock::now();
+    if (std::abs(subtractionVolume / expected - 1.) > 5.e-3) {
+        std::cerr << "testContainsBatch() " << __LINE__ << " Wrong volume: " << subtractionVolume
+                  << " instead of " << expected << std::endl;
+        return EXIT_FAILURE;
+    }
+    // volume() keeps its serial sequence of points
+    for (const GeoIntrusivePtr<const GeoShape>& shape : shapes) {
+        const double volume = shape->GeoShape::volume(100000);
+        if (volume != referenceVolume(*shape, 100000)) {
+            std::cerr << "testContainsBatch() " << __LINE__ << " " << shape->type() << ": volume " << volume
+                      << " differs from the point by point one " << referenceVolume(*shape, 100000) << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    std::cout << "testContainsBatch() -- Monte Carlo volume: "
+              << std::chrono::duration<double, std::milli>(end - start).count() << " ms" << std::endl;
+    return EXIT_SUCCESS;
+}
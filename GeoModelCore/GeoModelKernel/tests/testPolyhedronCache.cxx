@@ -0,0 +1,122 @@
+// Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+
+/// Checks that the polyhedra of GeoPolyhedronCache, computed by several threads,
+/// match the ones of GeoPolyhedrizeAction, that the boolean operations of
+/// different threads do not interfere, and that each shape is computed once.
+
+#include "GeoModelKernel/GeoBox.h"
+#include "GeoModelKernel/GeoCons.h"
+#include "GeoModelKernel/GeoLogVol.h"
+#include "GeoModelKernel/GeoMaterial.h"
+#include "GeoModelKernel/GeoPhysVol.h"
+#include "GeoModelKernel/GeoPolyhedrizeAction.h"
+#include "GeoModelKernel/GeoPolyhedron.h"
+#include "GeoModelKernel/GeoPolyhedronCache.h"
+#include "GeoModelKernel/GeoShapeIntersection.h"
+#include "GeoModelKernel/GeoShapeShift.h"
+#include "GeoModelKernel/GeoShapeSubtraction.h"
+#include "GeoModelKernel/GeoShapeUnion.h"
+#include "GeoModelKernel/GeoTransform.h"
+#include "GeoModelKernel/GeoTube.h"
+#include "GeoModelKernel/GeoTubs.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace {
+    double polyhedronVolume(const GeoShape* shape) {
+        GeoPolyhedrizeAction action{};
+        shape->exec(&action);
+        return action.getPolyhedron() ? action.getPolyhedron()->GetVolume() : -1.;
+    }
+
+    bool closeEnough(double a, double b) {
+        return std::abs(a - b) <= 1.e-6 * std::max(std::abs(a), std::abs(b));
+    }
+}
+
+int main() {
+    GeoIntrusivePtr<GeoMaterial> air{new GeoMaterial("Air", 1.)};
+
+    // booleans sharing their operands
+    GeoIntrusivePtr<const GeoShape> box{new GeoBox(100., 80., 60.)};
+    GeoIntrusivePtr<const GeoShape> tube{new GeoTube(0., 30., 90.)};
+    GeoIntrusivePtr<const GeoShape> shiftedTube{new GeoShapeShift(tube.get(), GeoTrf::TranslateX3D(40.))};
+    std::vector<GeoIntrusivePtr<const GeoShape>> shapes{
+        box, tube,
+        new GeoTubs(10., 40., 50., 0.3, 1.2),
+        new GeoCons(5., 10., 20., 40., 30., 0., 2. * M_PI),
+        new GeoShapeSubtraction(box.get(), tube.get()),
+        new GeoShapeSubtraction(box.get(), shiftedTube.get()),
+        new GeoShapeUnion(box.get(), shiftedTube.get()),
+        new GeoShapeIntersection(box.get(), shiftedTube.get()),
+        new GeoShapeSubtraction(new GeoShapeSubtraction(box.get(), tube.get()), shiftedTube.get()),
+    };
+
+    // the world has a volume per shape, the volumes placed twice
+    GeoIntrusivePtr<GeoPhysVol> world{new GeoPhysVol(new GeoLogVol("World", new GeoBox(1000., 1000., 1000.), air.get()))};
+    for (const GeoIntrusivePtr<const GeoShape>& shape : shapes) {
+        GeoIntrusivePtr<GeoPhysVol> volume{new GeoPhysVol(new GeoLogVol("Volume", shape.get(), air.get()))};
+        for (int copy = 0; copy < 2; ++copy) {
+            world->add(new GeoTransform(GeoTrf::TranslateZ3D(200. * copy)));
+            world->add(volume);
+        }
+    }
+
+    std::vector<double> expected{};
+    for (const GeoIntrusivePtr<const GeoShape>& shape : shapes) expected.push_back(polyhedronVolume(shape.get()));
+
+    for (unsigned int nThreads : {1u, 4u}) {
+        GeoPolyhedronCache cache{};
+        const std::vector<const GeoShape*> collected = GeoPolyhedronCache::collectShapes(world.get());
+        // the shapes of the volumes and the one of the world
+        if (collected.size() != shapes.size() + 1) {
+            std::cerr << "testPolyhedronCache() " << __LINE__ << ": " << collected.size()
+                      << " shapes collected instead of " << shapes.size() + 1 << std::endl;
+            return EXIT_FAILURE;
+        }
+        cache.polyhedrize(world.get(), nThreads);
+        // the operands which are not volume shapes: the shift and the inner subtraction
+        if (cache.size() != collected.size() + 2) {
+            std::cerr << "testPolyhedronCache() " << __LINE__ << ": " << cache.size()
+                      << " cached shapes instead of " << collected.size() + 2 << std::endl;
+            return EXIT_FAILURE;
+        }
+        for (size_t s = 0; s < shapes.size(); ++s) {
+            std::shared_ptr<const GeoPolyhedron> polyhedron = cache.get(shapes[s].get());
+            if (!polyhedron || polyhedron != cache.get(shapes[s].get())) {
+                std::cerr << "testPolyhedronCache() " << __LINE__ << ": " << shapes[s]->type()
+                          << " is not computed once" << std::endl;
+                return EXIT_FAILURE;
+            }
+            if (!closeEnough(polyhedron->GetVolume(), expected[s])) {
+                std::cerr << "testPolyhedronCache() " << __LINE__ << ": " << shapes[s]->type()
+                          << " volume " << polyhedron->GetVolume() << " instead of " << expected[s]
+                          << " with " << nThreads << " threads" << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    // boolean operations run concurrently, without the cache
+    const double subtracted = polyhedronVolume(shapes[8].get());
+    std::vector<double> volumes(8, 0.);
+    std::vector<std::thread> workers{};
+    for (size_t t = 0; t < volumes.size(); ++t) {
+        workers.emplace_back([&volumes, &shapes, t]() {
+            for (int i = 0; i < 20; ++i) volumes[t] = polyhedronVolume(shapes[8].get());
+        });
+    }
+    for (std::thread& worker : workers) worker.join();
+    for (double volume : volumes) {
+        if (!closeEnough(volume, subtracted)) {
+            std::cerr << "testPolyhedronCache() " << __LINE__ << ": concurrent subtraction volume "
+                      << volume << " instead of " << subtracted << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,154 @@
+// Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+
+/// Checks that the batch evaluation of the GeoSerialTransformer transforms,
+/// computed or read from the materialized table, and the transforms seen by
+/// GeoVolumeCursor are bit for bit those of the evaluation of the function
+/// copy by copy, and prints the time per copy of both evaluations.
+
+#include "GeoModelKernel/GeoBox.h"
+#include "GeoModelKernel/GeoLogVol.h"
+#include "GeoModelKernel/GeoMaterial.h"
+#include "GeoModelKernel/GeoPhysVol.h"
+#include "GeoModelKernel/GeoSerialTransformer.h"
+#include "GeoModelKernel/GeoVolumeCursor.h"
+#include "GeoModelKernel/GeoXF.h"
+#include "GeoGenericFunctions/Variable.h"
+#include "GeoGenericFunctions/Sin.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace GeoXF;
+using namespace GeoGenfun;
+
+namespace {
+    bool sameTransforms(const GeoTrf::Transform3D& a, const GeoTrf::Transform3D& b) {
+        return a.matrix() == b.matrix();
+    }
+
+    bool checkBatch(const std::string& name, const GeoSerialTransformer* serial) {
+        const unsigned int nCopies = serial->getNCopies();
+        std::vector<GeoTrf::Transform3D> transforms{};
+        for (unsigned int begin : {0u, 1u, nCopies / 3}) {
+            serial->getTransforms(begin, nCopies, transforms);
+            if (transforms.size() != nCopies - begin) {
+                std::cerr << "testSerialTransforms() " << __LINE__ << ": " << name << " "
+                          << transforms.size() << " transforms instead of " << nCopies - begin << std::endl;
+                return false;
+            }
+            for (unsigned int i = begin; i < nCopies; ++i) {
+                if (!sameTransforms(transforms[i - begin], (*serial->getFunction())(i))) {
+                    std::cerr << "testSerialTransforms() " << __LINE__ << ": " << name << " copy " << i
+                              << " differs from the function:\n" << transforms[i - begin].matrix() << "\n"
+                              << (*serial->getFunction())(i).matrix() << std::endl;
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+}
+
+int main() {
+    GeoIntrusivePtr<GeoMaterial> air{new GeoMaterial("Air", 1.)};
+    GeoIntrusivePtr<GeoPhysVol> volume{new GeoPhysVol(new GeoLogVol("Volume", new GeoBox(1., 1., 1.), air.get()))};
+
+    Variable i;
+    const unsigned int nCopies = 100;
+    const double dPhi = 2. * M_PI / nCopies;
+    std::vector<std::pair<std::string, GeoIntrusivePtr<GeoSerialTransformer>>> serials{};
+    auto add = [&](const std::string& name, TRANSFUNCTION function) {
+        serials.emplace_back(name, new GeoSerialTransformer(volume.get(), &function, nCopies));
+    };
+    add("translation", Pow(GeoTrf::TranslateZ3D(12.5), i));
+    add("rotation about z", Pow(GeoTrf::RotateZ3D(dPhi), i));
+    add("rotation about -z", Pow(GeoTrf::RotateZ3D(-dPhi), i));
+    add("rotation about x", Pow(GeoTrf::RotateX3D(dPhi), i));
+    add("screw", Pow(GeoTrf::TranslateZ3D(3.) * GeoTrf::RotateZ3D(dPhi), i));
+    add("stave ring", GeoTrf::TranslateZ3D(-40.) * Pow(GeoTrf::RotateZ3D(dPhi), 2. * i + 0.5) *
+                      GeoTrf::TranslateX3D(300.) * GeoTrf::RotateY3D(0.1));
+    add("product", Pow(GeoTrf::RotateZ3D(dPhi), i) * Pow(GeoTrf::TranslateX3D(1.), Sin()(i)));
+
+    for (const auto& [name, serial] : serials) {
+        if (!checkBatch(name, serial.get())) return EXIT_FAILURE;
+    }
+
+    // the cursor walks the copies in batches
+    GeoIntrusivePtr<GeoPhysVol> parent{new GeoPhysVol(new GeoLogVol("Parent", new GeoBox(1., 1., 1.), air.get()))};
+    for (const auto& serial : serials) parent->add(serial.second);
+    unsigned int nVolumes{0};
+    for (GeoVolumeCursor cursor{parent}; !cursor.atEnd(); cursor.next(), ++nVolumes) {
+        const GeoSerialTransformer* serial = serials[nVolumes / nCopies].second.get();
+        if (!sameTransforms(cursor.getTransform(), (*serial->getFunction())(nVolumes % nCopies))) {
+            std::cerr << "testSerialTransforms() " << __LINE__ << ": " << serials[nVolumes / nCopies].first
+                      << " copy " << nVolumes % nCopies << " differs from the function in the cursor" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    if (nVolumes != serials.size() * nCopies) {
+        std::cerr << "testSerialTransforms() " << __LINE__ << ": the cursor visited " << nVolumes
+                  << " volumes instead of " << serials.size() * nCopies << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // time per copy of the function and of the batch evaluation
+    const unsigned int nTimed = 100000;
+    const TRANSFUNCTION ring = GeoTrf::TranslateZ3D(-40.) * Pow(GeoTrf::RotateZ3D(dPhi), 2. * i + 0.5) *
+                               GeoTrf::TranslateX3D(300.) * GeoTrf::RotateY3D(0.1);
+    GeoIntrusivePtr<GeoSerialTransformer> timed{new GeoSerialTransformer(volume.get(), &ring, nTimed)};
+    std::vector<GeoTrf::Transform3D> byFunction(nTimed);
+    std::vector<GeoTrf::Transform3D> byBatch{};
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (unsigned int c = 0; c < nTimed; ++c) byFunction[c] = (*timed->getFunction())(c);
+    const auto middle = std::chrono::high_resolution_clock::now();
+    timed->getTransforms(0, nTimed, byBatch);
+    const auto end = std::chrono::high_resolution_clock::now();
+    for (unsigned int c = 0; c < nTimed; ++c) {
+        if (!sameTransforms(byBatch[c], byFunction[c])) {
+            std::cerr << "testSerialTransforms() " << __LINE__ << ": timed copy " << c
+                      << " differs from the function" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    std::cout << "testSerialTransforms() -- stave ring, function: "
+              << std::chrono::duration<double, std::micro>(middle - start).count() / nTimed << " us per copy, batch: "
+              << std::chrono::duration<double, std::micro>(end - middle).count() / nTimed << " us per copy" << std::endl;
+
+    // the out of range copies are refused
+    std::vector<GeoTrf::Transform3D> transforms{};
+    try {
+        serials[0].second->getTransforms(0, nCopies + 1, transforms);
+        std::cerr << "testSerialTransforms() " << __LINE__ << ": copy " << nCopies << " accepted" << std::endl;
+        return EXIT_FAILURE;
+    } catch (const std::exception&) {}
+
+    // the table is built only within the budget
+    GeoSerialTransformer* serial = serials[5].second.get();
+    const std::size_t tableBytes = nCopies * sizeof(GeoTrf::Transform3D);
+    if (serial->materializeTransforms(tableBytes - 1) || serial->isMaterialized()) {
+        std::cerr << "testSerialTransforms() " << __LINE__ << ": table built over the budget" << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (!serial->materializeTransforms(tableBytes) || !serial->isMaterialized()) {
+        std::cerr << "testSerialTransforms() " << __LINE__ << ": table not built within the budget" << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (!checkBatch("materialized", serial)) return EXIT_FAILURE;
+    for (unsigned int c = 0; c < nCopies; ++c) {
+        if (!sameTransforms(serial->getTransform(c), (*serial->getFunction())(c))) {
+            std::cerr << "testSerialTransforms() " << __LINE__ << ": materialized copy " << c
+                      << " differs from the function" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    serial->materializeTransforms(0);
+    if (serial->isMaterialized()) {
+        std::cerr << "testSerialTransforms() " << __LINE__ << ": table not released" << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -6,26 +6,47 @@
 #define GEO2G4_ExtParameterisedVolumeBuilder_H
 
 #include "VolumeBuilder.h"
+#include "GeoModel2G4/Geo2G4ConversionContext.h"
+#include <memory>
 #include <string>
 
+class Geo2G4AssemblyFactory;
 class Geo2G4AssemblyVolume;
+class Geo2G4LVFactory;
 class GeoMaterial;
 class GeoElement;
+class GeoSerialTransformer;
 
 class ExtParameterisedVolumeBuilder: public VolumeBuilder
 {
 public:
-  ExtParameterisedVolumeBuilder(std::string n);
+  /// Converts with 'context', to share the Geant4 volumes with other
+  /// builders, or with a context of its own if none is given
+  ExtParameterisedVolumeBuilder(std::string n, Geo2G4ConversionContext* context = nullptr);
+  ~ExtParameterisedVolumeBuilder();
   ///
   G4LogicalVolume* Build(PVConstLink pv) const;
   ///
   Geo2G4AssemblyVolume* BuildAssembly(PVConstLink pv) const;
+  /// The caches and statistics of the conversion
+  Geo2G4ConversionContext& GetContext() const { return *m_context; }
  private:
   /// Prints info when some PhysVol contains both types (PV and ST) of daughters
   void PrintSTInfo(std::string volume) const;
+  /// Places the copies of a serial transformer, as a G4PVReplica when they
+  /// fill the mother, with a Geo2G4STParameterisation otherwise
+  void PlaceSerialTransformer(const GeoSerialTransformer* serialTransformer,
+                              const std::string& name,
+                              G4LogicalVolume* theG4LogChild,
+                              G4LogicalVolume* theG4LogVolume) const;
   ///
   void getMatEther() const;
 
+  std::unique_ptr<Geo2G4ConversionContext> m_ownContext;
+  Geo2G4ConversionContext* m_context;
+  std::unique_ptr<Geo2G4LVFactory>       m_LVFactory;
+  std::unique_ptr<Geo2G4AssemblyFactory> m_assemblyFactory;
+
   mutable bool               m_getMatEther;
   mutable const GeoMaterial* m_matEther;
   mutable const GeoMaterial* m_matHypUr;
@@ -8,13 +8,17 @@
 #include "GeoModelKernel/GeoVPhysVol.h"
 
 class Geo2G4AssemblyVolume;
+class Geo2G4ConversionContext;
 
 class Geo2G4AssemblyFactory 
 {
  public:
-  Geo2G4AssemblyFactory();
+  Geo2G4AssemblyFactory(Geo2G4ConversionContext& context);
   Geo2G4AssemblyVolume* Build(const PVConstLink,
 			  bool&) const;
+
+ private:
+  Geo2G4ConversionContext& m_context;
 };
 
 #endif
@@ -0,0 +1,133 @@
+/*
+  Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+*/
+
+#ifndef GEO2G4_Geo2G4ConversionContext_h
+#define GEO2G4_Geo2G4ConversionContext_h
+
+#include "GeoModelHelpers/GeoShapeSorter.h"
+#include "GeoModelKernel/GeoIntrusivePtr.h"
+
+#include <cstddef>
+#include <iosfwd>
+#include <map>
+#include <unordered_map>
+
+class G4LogicalVolume;
+class G4Material;
+class G4VSolid;
+class GeoFullPhysVol;
+class GeoLogVol;
+class GeoMaterial;
+class GeoShape;
+class GeoVPhysVol;
+class Geo2G4AssemblyVolume;
+
+/**
+ * @class Geo2G4ConversionContext
+ *
+ * @brief The state of a GeoModel to Geant4 conversion: the Geant4 solids,
+ *        logical volumes and assemblies already built for the GeoModel
+ *        objects, and how often they were reused.
+ *
+ *        A context is passed to the ExtParameterisedVolumeBuilder. Worlds
+ *        converted with the same context share the Geant4 volumes of the
+ *        GeoModel objects they have in common; clear() forgets them, e.g.
+ *        before converting a new tree whose objects may reuse the addresses
+ *        of a deleted one. The Geant4 objects are owned by the Geant4 stores,
+ *        the context does not delete them.
+ *
+ *        Optionally, shapes with the same defining parameters (within the
+ *        tolerance of GeoShapeSorter) share one solid, which saves memory and
+ *        voxelization time for trees that were not deduplicated on the GeoModel
+ *        side. The shared solid keeps the name of the first logical volume.
+ */
+class Geo2G4ConversionContext
+{
+ public:
+  /// Map from the GeoModel objects to the Geant4 objects built for them
+  template <class Key, class Value>
+  class Cache
+  {
+   public:
+    /// The cached object, nullptr if there is none. Counts a hit or a miss.
+    Value* find(const Key* key)
+    {
+      auto it = m_map.find(key);
+      if (it == m_map.end()) {
+        ++m_misses;
+        return nullptr;
+      }
+      ++m_hits;
+      return it->second;
+    }
+    void insert(const Key* key, Value* value) { m_map[key] = value; }
+    void clear() { m_map.clear(); m_hits = 0; m_misses = 0; }
+
+    size_t size() const { return m_map.size(); }
+    size_t hits() const { return m_hits; }
+    size_t misses() const { return m_misses; }
+
+   private:
+    std::unordered_map<const Key*, Value*> m_map;
+    size_t m_hits{0};
+    size_t m_misses{0};
+  };
+
+  Geo2G4ConversionContext() = default;
+  Geo2G4ConversionContext(const Geo2G4ConversionContext&) = delete;
+  Geo2G4ConversionContext& operator=(const Geo2G4ConversionContext&) = delete;
+
+  /// The Geant4 material, shared by all the contexts since the
+  /// Geant4 materials are identified by their name
+  static G4Material* material(const GeoMaterial* material);
+
+  /// Solids of the shapes
+  Cache<GeoShape, G4VSolid>& solids() { return m_solids; }
+  /// Logical volumes of the shared leaf volumes
+  Cache<GeoLogVol, G4LogicalVolume>& leafLogVols() { return m_leafLogVols; }
+  /// Logical volumes of the shared volumes with children
+  Cache<GeoVPhysVol, G4LogicalVolume>& branchLogVols() { return m_branchLogVols; }
+  /// Logical volumes of the full physical volumes, by clone origin
+  Cache<GeoFullPhysVol, G4LogicalVolume>& clonedLogVols() { return m_clonedLogVols; }
+  /// Assemblies of the volumes made of Ether or HyperUranium
+  Cache<GeoVPhysVol, Geo2G4AssemblyVolume>& assemblies() { return m_assemblies; }
+
+  /// Enables the sharing of the solids of equal shapes
+  void setDeduplicateSolids(bool flag) { m_deduplicateSolids = flag; }
+  bool deduplicateSolids() const { return m_deduplicateSolids; }
+  /// The solid of a shape equal to 'shape', nullptr if there is none
+  G4VSolid* findEqualSolid(const GeoShape* shape);
+  void insertEqualSolid(const GeoShape* shape, G4VSolid* solid);
+  /// Counts a solid shared instead of built, of about 'bytes' bytes
+  void countDeduplicatedSolid(size_t bytes) { ++m_nDeduplicatedSolids; m_savedBytes += bytes; }
+  size_t nDeduplicatedSolids() const { return m_nDeduplicatedSolids; }
+  size_t savedBytes() const { return m_savedBytes; }
+
+  /// Counts the Geant4 objects built through this context
+  void countSolid() { ++m_nSolids; }
+  void countLogVol() { ++m_nLogVols; }
+  size_t nSolids() const { return m_nSolids; }
+  size_t nLogVols() const { return m_nLogVols; }
+
+  /// Forgets the converted volumes and resets the statistics
+  void clear();
+
+  /// Prints the number of objects built and the hit rates of the caches
+  void print(std::ostream& out) const;
+
+ private:
+  Cache<GeoShape, G4VSolid> m_solids;
+  Cache<GeoLogVol, G4LogicalVolume> m_leafLogVols;
+  Cache<GeoVPhysVol, G4LogicalVolume> m_branchLogVols;
+  Cache<GeoFullPhysVol, G4LogicalVolume> m_clonedLogVols;
+  Cache<GeoVPhysVol, Geo2G4AssemblyVolume> m_assemblies;
+  bool m_deduplicateSolids{false};
+  std::map<GeoIntrusivePtr<const GeoShape>, G4VSolid*, GeoShapeSorter> m_equalSolids;
+  size_t m_nDeduplicatedSolids{0};
+  size_t m_savedBytes{0};
+  size_t m_nSolids{0};
+  size_t m_nLogVols{0};
+};
+
+#endif
@@ -6,20 +6,27 @@
 #define GEO2G4_Geo2G4LVFactory_h
 
 #include "GeoModelKernel/GeoVPhysVol.h"
+#include "GeoModel2G4/Geo2G4SolidFactory.h"
 // Units
 #include "GeoModelKernel/Units.h"
 #define SYSTEM_OF_UNITS GeoModelKernelUnits
 
 class G4LogicalVolume;
 class GeoLogVol;
+class Geo2G4ConversionContext;
 
 class Geo2G4LVFactory 
 {
  public:
-  Geo2G4LVFactory();
+  Geo2G4LVFactory(Geo2G4ConversionContext& context);
+  /// The logical volume of the physical volume, built or taken from the
+  /// caches of the context. 'descend' tells if the children must be placed.
   G4LogicalVolume* Build(const PVConstLink,
-			 bool&) const;
-    
+			 bool& descend) const;
+
+ private:
+  Geo2G4ConversionContext& m_context;
+  Geo2G4SolidFactory m_solidFactory;
 };
 
 #endif
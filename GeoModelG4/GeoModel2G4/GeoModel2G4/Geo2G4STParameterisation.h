@@ -8,9 +8,12 @@
 #include "globals.hh"
 #include "G4VPVParameterisation.hh"
 #include "G4RotationMatrix.hh"
+#include "G4ThreeVector.hh"
 
 #include "GeoModelKernel/GeoXF.h"
 
+#include <vector>
+
 class G4VPhysicalVolume;
 
 // Dummy declarations. To avoid warnings
@@ -29,6 +32,11 @@ class G4Polyhedra;
 class G4Polycone;
 class G4Ellipsoid;
 
+/// Parameterisation of a GeoSerialTransformer. The transforms of the copies
+/// are evaluated from the GeoXF::Function once, at construction, and stored
+/// in a table: ComputeTransformation() is a lookup by copy number. When no
+/// copy is rotated, e.g. for a pure translation, the copies share a single
+/// identity rotation. Debug builds check the table against the function.
 class Geo2G4STParameterisation : public G4VPVParameterisation
 {
 public:
@@ -66,7 +74,11 @@ private:
   void ComputeDimensions (G4Ellipsoid&,const G4int,const G4VPhysicalVolume*) const {}
 
   const GeoXF::Function *m_function;
-  G4RotationMatrix* m_rotation;
+  /// The inverse rotations (as expected by G4VPhysicalVolume) and the
+  /// translations of the copies. A single rotation is shared by all the
+  /// copies when none of them is rotated.
+  std::vector<G4RotationMatrix> m_rotations;
+  std::vector<G4ThreeVector> m_translations;
   unsigned int m_nCopies;
 };
 
@@ -0,0 +1,69 @@
+/*
+  Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+*/
+
+#ifndef GEO2G4_Geo2G4STPattern_h
+#define GEO2G4_Geo2G4STPattern_h
+
+#include "GeoModelKernel/GeoDefinitions.h"
+#include "GeoModelKernel/GeoXF.h"
+
+/**
+ * @class Geo2G4STPattern
+ *
+ * @brief Recognizes the regular patterns of the GeoSerialTransformer functions,
+ *        so that copies which fill their mother can be placed as replicas:
+ *
+ *        - RotationZ:   pre * RotateZ3D(phi0 + i * dPhi) * post,
+ *                       e.g. Pow(RotateZ3D(angle), Variable);
+ *        - Translation: pre * Translate3D(t0 + i * dt) * post,
+ *                       e.g. Pow(TranslateX3D(step), Variable).
+ *
+ *        The function tree is walked through Pow, PreMult and PostMult. The
+ *        argument of a Pow must be affine in the copy number, which is checked
+ *        on the copy numbers, and the pattern found is checked against the
+ *        function for every copy. Anything else is Generic.
+ *        Pure rotations around z (translations) in pre or post are folded
+ *        into phi0 (t0), so that pre and post are the identity when the
+ *        copies are only rotated (translated).
+ */
+class Geo2G4STPattern
+{
+ public:
+  enum Kind { Generic, RotationZ, Translation };
+
+  Geo2G4STPattern(const GeoXF::Function& function, unsigned int nCopies);
+
+  Kind kind() const { return m_kind; }
+
+  const GeoTrf::Transform3D& pre() const { return m_pre; }
+  const GeoTrf::Transform3D& post() const { return m_post; }
+  /// True if pre and post are the identity
+  bool isPure() const { return m_pure; }
+
+  /// RotationZ: the angle of the first copy and the step
+  double phi0() const { return m_phi0; }
+  double dPhi() const { return m_dPhi; }
+
+  /// Translation: the shift of the first copy and the step
+  const GeoTrf::Vector3D& t0() const { return m_t0; }
+  const GeoTrf::Vector3D& dt() const { return m_dt; }
+
+  /// The transform of copy i, for the regular patterns
+  GeoTrf::Transform3D transform(unsigned int i) const;
+
+ private:
+  bool analyse(const GeoXF::Function& function, unsigned int nCopies);
+  void fold();
+
+  Kind m_kind{Generic};
+  GeoTrf::Transform3D m_pre{GeoTrf::Transform3D::Identity()};
+  GeoTrf::Transform3D m_post{GeoTrf::Transform3D::Identity()};
+  bool m_pure{false};
+  double m_phi0{0.};
+  double m_dPhi{0.};
+  GeoTrf::Vector3D m_t0{GeoTrf::Vector3D::Zero()};
+  GeoTrf::Vector3D m_dt{GeoTrf::Vector3D::Zero()};
+};
+
+#endif
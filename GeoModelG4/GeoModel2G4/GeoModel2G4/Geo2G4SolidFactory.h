@@ -11,16 +11,19 @@
 class G4VSolid;
 class GeoShape;
 class GeoUnidentifiedShape;
+class Geo2G4ConversionContext;
 
 class Geo2G4SolidFactory
 {
 public:
     
 
-  Geo2G4SolidFactory();
+  Geo2G4SolidFactory(Geo2G4ConversionContext& context);
+  /// The solid of the shape, built or taken from the solid cache of the context
   G4VSolid* Build(const GeoShape*, std::string name=std::string("")) const;
   
-
+private:
+  Geo2G4ConversionContext& m_context;
 };
 
 #endif
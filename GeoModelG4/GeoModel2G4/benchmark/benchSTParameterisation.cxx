@@ -0,0 +1,116 @@
+//
+// Navigation through a parameterised GeoSerialTransformer: transforms of the
+// copies evaluated from the GeoXF::Function at each step, as the previous
+// Geo2G4STParameterisation did, versus the precomputed table.
+//
+// Usage: benchSTParameterisation [copies] [points]
+//
+// Debug builds check the table against the function at each step:
+// build with NDEBUG to compare the two.
+//
+#include "GeoModel2G4/Geo2G4STParameterisation.h"
+#include "GeoModel2G4/CLHEPtoEigenConverter.h"
+
+#include "GeoModelKernel/GeoXF.h"
+#include "GeoGenericFunctions/Variable.h"
+
+#include "G4Box.hh"
+#include "G4GeometryManager.hh"
+#include "G4LogicalVolume.hh"
+#include "G4Navigator.hh"
+#include "G4NistManager.hh"
+#include "G4PVParameterised.hh"
+#include "G4PVPlacement.hh"
+#include "G4Tubs.hh"
+#include "G4VPVParameterisation.hh"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// The parameterisation before the table: evaluates the function for each copy
+class FunctionParameterisation : public G4VPVParameterisation
+{
+public:
+  explicit FunctionParameterisation(const GeoXF::Function* func) : m_function(func->clone()) {}
+  ~FunctionParameterisation() { delete m_function; }
+  void ComputeTransformation(const G4int copyNo, G4VPhysicalVolume* physVol) const override
+  {
+    HepGeom::Transform3D transform = Amg::EigenTransformToCLHEP((*m_function)(copyNo));
+    m_rotation = transform.getRotation().inverse();
+    physVol->SetTranslation(transform.getTranslation());
+    physVol->SetRotation(&m_rotation);
+  }
+private:
+  const GeoXF::Function* m_function;
+  mutable G4RotationMatrix m_rotation;
+};
+
+// A helix of boxes in a tube, which is not a pattern of Geo2G4STPattern
+G4VPhysicalVolume* buildWorld(unsigned int nCopies, G4VPVParameterisation* parameterisation)
+{
+  G4Material* air = G4NistManager::Instance()->FindOrBuildMaterial("G4_AIR");
+  G4LogicalVolume* world = new G4LogicalVolume(new G4Box("World", 2000., 2000., 2000.), air, "World");
+  G4LogicalVolume* mother = new G4LogicalVolume(new G4Tubs("Mother", 0., 1000., 1500., 0., CLHEP::twopi), air, "Mother");
+  G4LogicalVolume* copy = new G4LogicalVolume(new G4Box("Copy", 20., 20., 0.5), air, "Copy");
+  new G4PVPlacement(nullptr, G4ThreeVector(), mother, "Mother", world, false, 0);
+  new G4PVParameterised("Copies", copy, mother, kUndefined, nCopies, parameterisation);
+  return new G4PVPlacement(nullptr, G4ThreeVector(), world, "World", nullptr, false, 0);
+}
+
+double navigate(G4VPhysicalVolume* world, const std::vector<G4ThreeVector>& points, unsigned int& inCopies)
+{
+  G4Navigator navigator;
+  navigator.SetWorldVolume(world);
+  inCopies = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (const G4ThreeVector& point : points)
+  {
+    G4VPhysicalVolume* volume = navigator.LocateGlobalPointAndSetup(point, nullptr, false, true);
+    if (volume && volume->GetName() == "Copies") ++inCopies;
+  }
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv)
+{
+  const unsigned int nCopies = argc > 1 ? std::atoi(argv[1]) : 2000;
+  const unsigned int nPoints = argc > 2 ? std::atoi(argv[2]) : 2000000;
+
+  GeoGenfun::Variable i;
+  GeoXF::TRANSFUNCTION helix = GeoXF::Pow(GeoTrf::RotateZ3D(0.05), i) * GeoTrf::TranslateX3D(500.) *
+                               GeoXF::Pow(GeoTrf::TranslateZ3D(1.4), i);
+  const GeoXF::Function& function = GeoTrf::TranslateZ3D(-1400.) * helix;
+
+  G4VPhysicalVolume* functionWorld = buildWorld(nCopies, new FunctionParameterisation(&function));
+  G4VPhysicalVolume* tableWorld = buildWorld(nCopies, new Geo2G4STParameterisation(&function, nCopies));
+  G4GeometryManager::GetInstance()->CloseGeometry(true);
+
+  // points around the copies, a fraction of them inside
+  std::mt19937 generator(12345);
+  std::uniform_int_distribution<unsigned int> copy(0, nCopies - 1);
+  std::normal_distribution<double> smear(0., 15.);
+  std::vector<G4ThreeVector> points(nPoints);
+  for (G4ThreeVector& point : points)
+  {
+    const GeoTrf::Vector3D centre = function(copy(generator)).translation();
+    point = G4ThreeVector(centre.x() + smear(generator), centre.y() + smear(generator), centre.z() + smear(generator) / 10.);
+  }
+
+  unsigned int functionIn = 0, tableIn = 0;
+  const double functionTime = navigate(functionWorld, points, functionIn);
+  const double tableTime = navigate(tableWorld, points, tableIn);
+  if (functionIn != tableIn)
+  {
+    std::cerr << "benchSTParameterisation: " << functionIn << " points in the copies with the function, "
+              << tableIn << " with the table" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << nCopies << " copies, " << nPoints << " points (" << tableIn << " in the copies)" << std::endl;
+  std::cout << "  function per step : " << functionTime << " s, " << nPoints / functionTime << " points/s" << std::endl;
+  std::cout << "  precomputed table : " << tableTime << " s, " << nPoints / tableTime << " points/s" << std::endl;
+  return EXIT_SUCCESS;
+}
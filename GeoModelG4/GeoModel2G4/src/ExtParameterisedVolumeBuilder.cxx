@@ -7,9 +7,13 @@
 #include "GeoModel2G4/Geo2G4AssemblyVolume.h"
 #include "GeoModel2G4/Geo2G4LVFactory.h"
 #include "GeoModel2G4/Geo2G4STParameterisation.h"
+#include "GeoModel2G4/Geo2G4STPattern.h"
 #include "G4LogicalVolume.hh"
 
+#include "G4Box.hh"
 #include "G4PVPlacement.hh"
+#include "G4PVReplica.hh"
+#include "G4Tubs.hh"
 #include "G4ReflectionFactory.hh"
 #include "G4VPVParameterisation.hh"
 #include "G4PVParameterised.hh"
@@ -20,6 +24,7 @@
 #include "GeoModelKernel/GeoMaterial.h"
 #include "GeoModelKernel/GeoLogVol.h"
 #include "GeoModelKernel/GeoSerialTransformer.h"
+#include <cmath>
 #include <iostream>
 
 #include "GeoModel2G4/CLHEPtoEigenConverter.h"
@@ -32,13 +37,75 @@ bool hasEnding (std::string const &fullString, std::string const &ending) {
     }
 }
 
-ExtParameterisedVolumeBuilder::ExtParameterisedVolumeBuilder(std::string n):
+namespace {
+  bool isClose(double a, double b) {
+    return std::abs(a - b) <= 1.e-9 * (1. + std::abs(a) + std::abs(b));
+  }
+
+  // A G4PVReplica must fill its mother: the copies of a rotation around z
+  // are phi slices [-width/2, width/2] of the tube of the mother, rotated by
+  // offset + (i + 1/2) * width.
+  bool isPhiReplica(const Geo2G4STPattern& pattern, unsigned int nCopies,
+                    const G4VSolid* motherSolid, const G4VSolid* childSolid,
+                    double& width, double& offset) {
+    const G4Tubs* mother = dynamic_cast<const G4Tubs*>(motherSolid);
+    const G4Tubs* child = dynamic_cast<const G4Tubs*>(childSolid);
+    if (!mother || !child || pattern.kind() != Geo2G4STPattern::RotationZ || !pattern.isPure())
+      return false;
+    width = pattern.dPhi();
+    offset = pattern.phi0() - 0.5 * width;
+    return width > 0. &&
+           isClose(mother->GetDeltaPhiAngle(), CLHEP::twopi) &&
+           isClose(nCopies * width, CLHEP::twopi) &&
+           isClose(child->GetDeltaPhiAngle(), width) &&
+           isClose(child->GetStartPhiAngle(), -0.5 * width) &&
+           isClose(child->GetInnerRadius(), mother->GetInnerRadius()) &&
+           isClose(child->GetOuterRadius(), mother->GetOuterRadius()) &&
+           isClose(child->GetZHalfLength(), mother->GetZHalfLength());
+  }
+
+  // The copies of a translation along an axis are slices of the box of the
+  // mother, centred at -width * (nCopies - 1) / 2 + i * width.
+  bool isCartesianReplica(const Geo2G4STPattern& pattern, unsigned int nCopies,
+                          const G4VSolid* motherSolid, const G4VSolid* childSolid,
+                          EAxis& axis, double& width) {
+    const G4Box* mother = dynamic_cast<const G4Box*>(motherSolid);
+    const G4Box* child = dynamic_cast<const G4Box*>(childSolid);
+    if (!mother || !child || pattern.kind() != Geo2G4STPattern::Translation || !pattern.isPure())
+      return false;
+    const double motherHalf[3] = {mother->GetXHalfLength(), mother->GetYHalfLength(), mother->GetZHalfLength()};
+    const double childHalf[3] = {child->GetXHalfLength(), child->GetYHalfLength(), child->GetZHalfLength()};
+    const EAxis axes[3] = {kXAxis, kYAxis, kZAxis};
+    for (int k = 0; k < 3; ++k) {
+      width = pattern.dt()[k];
+      if (width <= 0.) continue;
+      const int k1 = (k + 1) % 3, k2 = (k + 2) % 3;
+      axis = axes[k];
+      return isClose(pattern.dt()[k1], 0.) && isClose(pattern.dt()[k2], 0.) &&
+             isClose(pattern.t0()[k1], 0.) && isClose(pattern.t0()[k2], 0.) &&
+             isClose(pattern.t0()[k], -0.5 * width * (nCopies - 1)) &&
+             isClose(2. * childHalf[k], width) &&
+             isClose(nCopies * width, 2. * motherHalf[k]) &&
+             isClose(childHalf[k1], motherHalf[k1]) &&
+             isClose(childHalf[k2], motherHalf[k2]);
+    }
+    return false;
+  }
+}
+
+ExtParameterisedVolumeBuilder::ExtParameterisedVolumeBuilder(std::string n, Geo2G4ConversionContext* context):
   VolumeBuilder(n),
+  m_ownContext(context ? nullptr : new Geo2G4ConversionContext()),
+  m_context(context ? context : m_ownContext.get()),
+  m_LVFactory(new Geo2G4LVFactory(*m_context)),
+  m_assemblyFactory(new Geo2G4AssemblyFactory(*m_context)),
   m_getMatEther(true),
   m_matEther(0),m_matHypUr(0)
 {
 }
 
+ExtParameterisedVolumeBuilder::~ExtParameterisedVolumeBuilder() = default;
+
 G4LogicalVolume* ExtParameterisedVolumeBuilder::Build(const PVConstLink theGeoPhysVolume) const
 {
   PVConstLink theGeoPhysChild;
@@ -51,9 +118,8 @@ G4LogicalVolume* ExtParameterisedVolumeBuilder::Build(const PVConstLink theGeoPh
 
   if(m_getMatEther) getMatEther();
 
-  static Geo2G4LVFactory LVFactory;
   //std::cout<<"    ----->ExtParameterisedVolumeBuilder::Build()"<<std::endl;
-  G4LogicalVolume* theG4LogVolume = LVFactory.Build(theGeoPhysVolume,descend);
+  G4LogicalVolume* theG4LogVolume = m_LVFactory->Build(theGeoPhysVolume,descend);
   //std::cout<<"    ----->LVFactory built"<<std::endl;
   if(!descend) return theG4LogVolume;
 
@@ -103,15 +169,7 @@ G4LogicalVolume* ExtParameterisedVolumeBuilder::Build(const PVConstLink theGeoPh
       if (nameChild == "ANON") nameChild=theG4LogChild->GetName();
       nameChild += "_Param";
 
-      Geo2G4STParameterisation* stParameterisation = new Geo2G4STParameterisation(serialTransformerChild->getFunction(),
-                                                                                  serialTransformerChild->getNCopies());
-
-      G4VPhysicalVolume* pvParametrised __attribute__ ((unused)) = new G4PVParameterised(nameChild,
-                                                                                         theG4LogChild,
-                                                                                         theG4LogVolume,
-                                                                                         kUndefined,
-                                                                                         serialTransformerChild->getNCopies(),
-                                                                                         stParameterisation);
+      PlaceSerialTransformer(serialTransformerChild,nameChild,theG4LogChild,theG4LogVolume);
     }
   else
     {
@@ -181,8 +239,6 @@ G4LogicalVolume* ExtParameterisedVolumeBuilder::Build(const PVConstLink theGeoPh
   return theG4LogVolume;
 }
 
-
-
 Geo2G4AssemblyVolume* ExtParameterisedVolumeBuilder::BuildAssembly(PVConstLink pv) const
 {
   PVConstLink theGeoPhysChild;
@@ -192,9 +248,7 @@ Geo2G4AssemblyVolume* ExtParameterisedVolumeBuilder::BuildAssembly(PVConstLink p
 
   if(m_getMatEther) getMatEther();
 
-  static Geo2G4AssemblyFactory AssemblyFactory;
-
-  Geo2G4AssemblyVolume* assemblyVolume = AssemblyFactory.Build(pv,descend);
+  Geo2G4AssemblyVolume* assemblyVolume = m_assemblyFactory->Build(pv,descend);
 
   if(!descend) return assemblyVolume;
 
@@ -261,6 +315,36 @@ void ExtParameterisedVolumeBuilder::PrintSTInfo(std::string volume) const
     std::cout<< "********************************************** " << std::endl;
 }
 
+void ExtParameterisedVolumeBuilder::PlaceSerialTransformer(const GeoSerialTransformer* serialTransformer,
+                                                           const std::string& name,
+                                                           G4LogicalVolume* theG4LogChild,
+                                                           G4LogicalVolume* theG4LogVolume) const
+{
+  const unsigned int nCopies = serialTransformer->getNCopies();
+  const Geo2G4STPattern pattern(*serialTransformer->getFunction(), nCopies);
+
+  double width{0.}, offset{0.};
+  EAxis axis{kUndefined};
+  if(isPhiReplica(pattern,nCopies,theG4LogVolume->GetSolid(),theG4LogChild->GetSolid(),width,offset))
+    {
+      new G4PVReplica(name,theG4LogChild,theG4LogVolume,kPhi,nCopies,width,offset);
+      std::cout << "ExtParameterisedVolumeBuilder: " << name << " (" << nCopies
+                << " copies) placed as a phi replica" << std::endl;
+    }
+  else if(isCartesianReplica(pattern,nCopies,theG4LogVolume->GetSolid(),theG4LogChild->GetSolid(),axis,width))
+    {
+      new G4PVReplica(name,theG4LogChild,theG4LogVolume,axis,nCopies,width);
+      std::cout << "ExtParameterisedVolumeBuilder: " << name << " (" << nCopies
+                << " copies) placed as a replica along "
+                << (axis == kXAxis ? "x" : axis == kYAxis ? "y" : "z") << std::endl;
+    }
+  else
+    {
+      new G4PVParameterised(name,theG4LogChild,theG4LogVolume,kUndefined,nCopies,
+                            new Geo2G4STParameterisation(serialTransformer->getFunction(),nCopies));
+    }
+}
+
 void ExtParameterisedVolumeBuilder::getMatEther() const
 {
     GeoElement* ethElement = new GeoElement("EtherEl","ET",500.0,0.0);
@@ -4,24 +4,21 @@
 
 #include "GeoModel2G4/Geo2G4AssemblyFactory.h"
 #include "GeoModel2G4/Geo2G4AssemblyVolume.h"
+#include "GeoModel2G4/Geo2G4ConversionContext.h"
 
 #include "GeoModelKernel/GeoLogVol.h"
 #include "GeoModelKernel/GeoVPhysVol.h"
 
 #include <iostream>
-#include <map>
 
-typedef std::map<const GeoVPhysVol*, Geo2G4AssemblyVolume*, std::less<const GeoVPhysVol*> > assemblyMap;
-
-Geo2G4AssemblyFactory::Geo2G4AssemblyFactory()
+Geo2G4AssemblyFactory::Geo2G4AssemblyFactory(Geo2G4ConversionContext& context):
+  m_context(context)
 {
 }
 
 Geo2G4AssemblyVolume* Geo2G4AssemblyFactory::Build(const PVConstLink thePhys,
                                                    bool& descend) const
 {
-  static assemblyMap map;
-  assemblyMap::const_iterator it;
   Geo2G4AssemblyVolume* assembly;
 
   const GeoLogVol* theLog = thePhys->getLogVol();
@@ -34,15 +31,14 @@ Geo2G4AssemblyVolume* Geo2G4AssemblyFactory::Build(const PVConstLink thePhys,
   descend = true;
 
   // Search for the assembly in the map
-  it = map.find(&(*thePhys));
-  if(it == map.end())
+  assembly = m_context.assemblies().find(&(*thePhys));
+  if(!assembly)
     {
       assembly = new Geo2G4AssemblyVolume();
-      map[&(*thePhys)] = assembly;
+      m_context.assemblies().insert(&(*thePhys), assembly);
     }
   else
     {
-      assembly = it->second;
       descend = false;
     }
 
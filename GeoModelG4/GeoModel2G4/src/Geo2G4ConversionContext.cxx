@@ -0,0 +1,74 @@
+/*
+  Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+*/
+
+#include "GeoModel2G4/Geo2G4ConversionContext.h"
+#include "GeoMaterial2G4/Geo2G4MaterialFactory.h"
+
+#include <iomanip>
+#include <ostream>
+
+namespace {
+  template <class Cache>
+  void printCache(std::ostream& out, const char* name, const Cache& cache)
+  {
+    const size_t lookups = cache.hits() + cache.misses();
+    const std::ios::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+    out << "  " << std::left << std::setw(24) << name << std::right
+        << std::setw(10) << cache.size() << " entries"
+        << std::setw(10) << cache.hits() << " hits"
+        << std::setw(10) << cache.misses() << " misses";
+    if (lookups) out << "  (" << std::fixed << std::setprecision(1)
+                     << 100. * cache.hits() / lookups << "% hits)";
+    out << std::endl;
+    out.flags(flags);
+    out.precision(precision);
+  }
+}
+
+G4Material* Geo2G4ConversionContext::material(const GeoMaterial* material)
+{
+  static Geo2G4MaterialFactory theMaterialFactory;
+  return theMaterialFactory.Build(material);
+}
+
+G4VSolid* Geo2G4ConversionContext::findEqualSolid(const GeoShape* shape)
+{
+  auto it = m_equalSolids.find(GeoIntrusivePtr<const GeoShape>{shape});
+  return it == m_equalSolids.end() ? nullptr : it->second;
+}
+
+void Geo2G4ConversionContext::insertEqualSolid(const GeoShape* shape, G4VSolid* solid)
+{
+  m_equalSolids.emplace(GeoIntrusivePtr<const GeoShape>{shape}, solid);
+}
+
+void Geo2G4ConversionContext::clear()
+{
+  m_solids.clear();
+  m_leafLogVols.clear();
+  m_branchLogVols.clear();
+  m_clonedLogVols.clear();
+  m_assemblies.clear();
+  m_equalSolids.clear();
+  m_nDeduplicatedSolids = 0;
+  m_savedBytes = 0;
+  m_nSolids = 0;
+  m_nLogVols = 0;
+}
+
+void Geo2G4ConversionContext::print(std::ostream& out) const
+{
+  out << "Geo2G4ConversionContext: " << m_nSolids << " solids and "
+      << m_nLogVols << " logical volumes built" << std::endl;
+  if (m_deduplicateSolids) {
+    out << "  " << m_nDeduplicatedSolids << " solids shared between equal shapes, about "
+        << m_savedBytes / 1024 << " kB saved" << std::endl;
+  }
+  printCache(out, "solids", m_solids);
+  printCache(out, "shared leaf volumes", m_leafLogVols);
+  printCache(out, "shared branch volumes", m_branchLogVols);
+  printCache(out, "cloned full volumes", m_clonedLogVols);
+  printCache(out, "assemblies", m_assemblies);
+}
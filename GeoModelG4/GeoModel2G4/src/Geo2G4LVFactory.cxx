@@ -3,8 +3,7 @@
 */
 
 #include "GeoModel2G4/Geo2G4LVFactory.h"
-#include "GeoModel2G4/Geo2G4SolidFactory.h"
-#include "GeoMaterial2G4/Geo2G4MaterialFactory.h"
+#include "GeoModel2G4/Geo2G4ConversionContext.h"
 
 #include "GeoModelKernel/GeoLogVol.h"
 #include "GeoModelKernel/GeoFullPhysVol.h"
@@ -13,25 +12,15 @@
 #include "G4Material.hh"
 
 #include <iostream>
-#include <map>
 
-typedef std::map<const GeoLogVol*, G4LogicalVolume*, std::less<const GeoLogVol*> > leafVMap;
-typedef std::map<const GeoVPhysVol*, G4LogicalVolume*, std::less<const GeoVPhysVol*> > branchVMap;
-
-typedef std::map<const GeoFullPhysVol*, G4LogicalVolume*, std::less<const GeoFullPhysVol*> > fullPVMap;
-
-Geo2G4LVFactory::Geo2G4LVFactory()
+Geo2G4LVFactory::Geo2G4LVFactory(Geo2G4ConversionContext& context):
+  m_context(context),
+  m_solidFactory(context)
 {}
 
 G4LogicalVolume* Geo2G4LVFactory::Build(const PVConstLink thePhys,
                                         bool& descend) const
 {
-  static Geo2G4SolidFactory theSolidFactory;
-  static Geo2G4MaterialFactory theMaterialFactory;
-
-  static leafVMap sharedLeafLV;
-  static branchVMap sharedBranchLV;
-  static fullPVMap clonedLV;
   //std::cout<<"    ----->Geo2G4LVFactory::Build"<<std::endl;
   const GeoFullPhysVol* fullPV = dynamic_cast<const GeoFullPhysVol*>(&(*thePhys));
   const GeoFullPhysVol* clonePV=0;
@@ -52,8 +41,8 @@ G4LogicalVolume* Geo2G4LVFactory::Build(const PVConstLink thePhys,
       //std::cout<<"    ----->NChildVols() == 0"<<std::endl;
       descend=false;
 
-      if(sharedLeafLV.find(theLog) != sharedLeafLV.end())
-        return sharedLeafLV[theLog];
+      if((theG4Log = m_context.leafLogVols().find(theLog)))
+        return theG4Log;
       else // here supposed to be ---> else if(theLog->refCount() > 1)
         putLeaf = true;
     }
@@ -62,42 +51,42 @@ G4LogicalVolume* Geo2G4LVFactory::Build(const PVConstLink thePhys,
     {
       //std::cout<<"    ----->Full Physical Volume"<<std::endl;
       clonePV = fullPV->cloneOrigin();
-      if (clonedLV.find(clonePV)==clonedLV.end())
+      if (clonePV)
         {
-          if(clonePV) putFullPV = true;
-        }
-      else
-        {
-          descend = false;
-          return clonedLV[clonePV];
+          if((theG4Log = m_context.clonedLogVols().find(clonePV)))
+            {
+              descend = false;
+              return theG4Log;
+            }
+          putFullPV = true;
         }
     }
   else
     {
       //std::cout<<"    ----->else"<<std::endl;
-      if(sharedBranchLV.find(&(*thePhys)) == sharedBranchLV.end())
-        putBranch = true;
-      else
+      if((theG4Log = m_context.branchLogVols().find(&(*thePhys))))
         {
           descend = false;
-          return sharedBranchLV[&(*thePhys)];
+          return theG4Log;
         }
+      putBranch = true;
     }
   // Actually build the G4Log
   //std::cout<<"    ----->Actually build the G4Mat: "<<theLog->getMaterial()->getName()<<std::endl;
-  theG4Mat=theMaterialFactory.Build(theLog->getMaterial());
+  theG4Mat=Geo2G4ConversionContext::material(theLog->getMaterial());
   //std::cout<<"    ----->Actually build the G4Solid"<<std::endl;
-  theG4Solid = theSolidFactory.Build(theLog->getShape(),theLog->getName());
+  theG4Solid = m_solidFactory.Build(theLog->getShape(),theLog->getName());
   //std::cout<<"    ----->Actually build the G4Log: "<<theLog->getName()<<std::endl;
   theG4Log = new G4LogicalVolume(theG4Solid,
                                  theG4Mat,
                                  theLog->getName(),
                                  0,0,0);
+  m_context.countLogVol();
   //std::cout<<"    ----->G4Log successfully built!!!"<<std::endl;
 
-  if(putLeaf) sharedLeafLV[theLog] = theG4Log;
-  if(putBranch) sharedBranchLV[&(*thePhys)] = theG4Log;
-  if(putFullPV) clonedLV[clonePV] = theG4Log;
+  if(putLeaf) m_context.leafLogVols().insert(theLog, theG4Log);
+  if(putBranch) m_context.branchLogVols().insert(&(*thePhys), theG4Log);
+  if(putFullPV) m_context.clonedLogVols().insert(clonePV, theG4Log);
 
   return theG4Log;
 }
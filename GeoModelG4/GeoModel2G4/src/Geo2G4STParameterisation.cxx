@@ -12,21 +12,49 @@ Geo2G4STParameterisation::Geo2G4STParameterisation(const GeoXF::Function* func,
   m_function(func->clone()),
   m_nCopies(copies)
 {
-  m_rotation = new G4RotationMatrix();
+  m_rotations.reserve(m_nCopies);
+  m_translations.reserve(m_nCopies);
+  bool rotated = false;
+  for (unsigned int copyNo = 0; copyNo < m_nCopies; ++copyNo)
+    {
+      HepGeom::Transform3D transform = Amg::EigenTransformToCLHEP((*m_function)(copyNo));
+      m_rotations.push_back(transform.getRotation().inverse());
+      m_translations.push_back(transform.getTranslation());
+      rotated = rotated || !m_rotations.back().isIdentity();
+    }
+  if (!rotated && m_nCopies > 1)
+    {
+      m_rotations.resize(1);
+      m_rotations.shrink_to_fit();
+    }
 }
 
 Geo2G4STParameterisation::~Geo2G4STParameterisation()
 {
-  delete m_rotation;
+  delete m_function;
 }
 
 void Geo2G4STParameterisation::ComputeTransformation(const G4int copyNo,
                                                      G4VPhysicalVolume* physVol) const
 {
+  // The table is not modified after construction: the physical volume
+  // can point to its rotations, from any thread.
+  G4RotationMatrix* rotation =
+    const_cast<G4RotationMatrix*>(&m_rotations[m_rotations.size() == 1 ? 0 : copyNo]);
+
+#ifndef NDEBUG
   HepGeom::Transform3D transform = Amg::EigenTransformToCLHEP((*m_function)(copyNo));
-  G4ThreeVector translation = transform.getTranslation();
-  *m_rotation = transform.getRotation().inverse();
+  if (m_translations[copyNo] != transform.getTranslation() ||
+      *rotation != transform.getRotation().inverse())
+    {
+      G4ExceptionDescription description;
+      description << "The precomputed placement of copy " << copyNo
+                  << " differs from the GeoXF::Function";
+      G4Exception("Geo2G4STParameterisation::ComputeTransformation()", "Geo2G4_STTable",
+                  FatalException, description);
+    }
+#endif
 
-  physVol->SetTranslation(translation);
-  physVol->SetRotation(m_rotation);
+  physVol->SetTranslation(m_translations[copyNo]);
+  physVol->SetRotation(rotation);
 }
@@ -0,0 +1,137 @@
+/*
+  Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+*/
+
+#include "GeoModel2G4/Geo2G4STPattern.h"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+  // Tolerances of the pattern matching, on the rotation matrix elements
+  // and on the lengths in mm
+  constexpr double rotationTolerance = 1.e-10;
+  constexpr double lengthTolerance = 1.e-9;
+
+  bool isZero(const GeoTrf::Vector3D& v) {
+    return v.cwiseAbs().maxCoeff() <= lengthTolerance;
+  }
+
+  bool isIdentity(const GeoTrf::RotationMatrix3D& r) {
+    return (r - GeoTrf::RotationMatrix3D::Identity()).cwiseAbs().maxCoeff() <= rotationTolerance;
+  }
+
+  /// True if r is a rotation around the z axis, by 'angle'
+  bool isRotationZ(const GeoTrf::RotationMatrix3D& r, double& angle) {
+    if (std::abs(r(2,2) - 1.) > rotationTolerance ||
+        std::abs(r(0,2)) > rotationTolerance || std::abs(r(1,2)) > rotationTolerance ||
+        std::abs(r(2,0)) > rotationTolerance || std::abs(r(2,1)) > rotationTolerance) return false;
+    angle = std::atan2(r(1,0), r(0,0));
+    return true;
+  }
+
+  /// True if the values are a + b * i
+  bool isAffine(const std::vector<double>& values, double& a, double& b) {
+    a = values.front();
+    b = values.size() > 1 ? values[1] - values[0] : 0.;
+    for (size_t i = 0; i < values.size(); ++i) {
+      if (std::abs(values[i] - (a + b * i)) > 1.e-12 * (1. + std::abs(values[i]))) return false;
+    }
+    return true;
+  }
+}
+
+Geo2G4STPattern::Geo2G4STPattern(const GeoXF::Function& function, unsigned int nCopies)
+{
+  if (nCopies == 0 || !analyse(function, nCopies)) {
+    m_kind = Generic;
+    return;
+  }
+  fold();
+  // The pattern must give the transforms of the function
+  for (unsigned int i = 0; i < nCopies; ++i) {
+    const GeoTrf::Transform3D expected = function(i);
+    const GeoTrf::Transform3D found = transform(i);
+    if ((expected.linear() - found.linear()).cwiseAbs().maxCoeff() > 1.e-9 ||
+        (expected.translation() - found.translation()).cwiseAbs().maxCoeff() >
+        1.e-9 * (1. + expected.translation().cwiseAbs().maxCoeff())) {
+      m_kind = Generic;
+      return;
+    }
+  }
+}
+
+bool Geo2G4STPattern::analyse(const GeoXF::Function& function, unsigned int nCopies)
+{
+  if (const GeoXF::PreMult* preMult = dynamic_cast<const GeoXF::PreMult*>(&function)) {
+    if (!analyse(*preMult->arg2(), nCopies)) return false;
+    m_pre = preMult->arg1() * m_pre;
+    return true;
+  }
+  if (const GeoXF::PostMult* postMult = dynamic_cast<const GeoXF::PostMult*>(&function)) {
+    if (!analyse(*postMult->arg1(), nCopies)) return false;
+    m_post = m_post * postMult->arg2();
+    return true;
+  }
+  const GeoXF::Pow* pow = dynamic_cast<const GeoXF::Pow*>(&function);
+  if (!pow) return false;
+
+  // Pow scales the translation and the rotation angle of its transform
+  // by the value of its function at the copy number
+  std::vector<double> values(nCopies);
+  for (unsigned int i = 0; i < nCopies; ++i) values[i] = (*pow->function())(i);
+  double a{0.}, b{0.};
+  if (!isAffine(values, a, b)) return false;
+
+  const GeoTrf::RotationMatrix3D rotation = pow->transform().rotation();
+  const GeoTrf::Vector3D translation = pow->transform().translation();
+  if (isIdentity(rotation)) {
+    m_kind = Translation;
+    m_t0 = a * translation;
+    m_dt = b * translation;
+    return true;
+  }
+  if (!isZero(translation)) return false;
+  const Eigen::AngleAxis<double> angleAxis(rotation);
+  if (std::abs(std::abs(angleAxis.axis().z()) - 1.) > rotationTolerance) return false;
+  const double angle = angleAxis.angle() * (angleAxis.axis().z() > 0. ? 1. : -1.);
+  m_kind = RotationZ;
+  m_phi0 = a * angle;
+  m_dPhi = b * angle;
+  return true;
+}
+
+void Geo2G4STPattern::fold()
+{
+  double angle{0.};
+  if (m_kind == RotationZ) {
+    if (isZero(m_pre.translation()) && isRotationZ(m_pre.linear(), angle)) {
+      m_phi0 += angle;
+      m_pre.setIdentity();
+    }
+    if (isZero(m_post.translation()) && isRotationZ(m_post.linear(), angle)) {
+      m_phi0 += angle;
+      m_post.setIdentity();
+    }
+  }
+  else if (m_kind == Translation) {
+    if (isIdentity(m_pre.linear())) {
+      m_t0 += m_pre.translation();
+      m_pre.setIdentity();
+    }
+    if (isIdentity(m_post.linear())) {
+      m_t0 += m_post.translation();
+      m_post.setIdentity();
+    }
+  }
+  m_pure = m_pre.isApprox(GeoTrf::Transform3D::Identity()) &&
+           m_post.isApprox(GeoTrf::Transform3D::Identity());
+}
+
+GeoTrf::Transform3D Geo2G4STPattern::transform(unsigned int i) const
+{
+  if (m_kind == RotationZ) {
+    return m_pre * GeoTrf::RotateZ3D(m_phi0 + i * m_dPhi) * m_post;
+  }
+  return m_pre * GeoTrf::Translation3D(m_t0 + i * m_dt) * m_post;
+}
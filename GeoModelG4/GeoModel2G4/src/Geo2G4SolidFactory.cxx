@@ -3,6 +3,7 @@
 */
 
 #include "GeoModel2G4/Geo2G4SolidFactory.h"
+#include "GeoModel2G4/Geo2G4ConversionContext.h"
 #include "GeoModelKernel/GeoShape.h"
 #include "GeoModelKernel/GeoBox.h"
 #include "GeoModelKernel/GeoTube.h"
@@ -48,6 +49,8 @@
 #include "G4TriangularFacet.hh"
 #include "G4QuadrangularFacet.hh"
 #include "G4GenericTrap.hh"
+#include "G4BooleanSolid.hh"
+#include "G4AffineTransform.hh"
 
 #include <iostream>
 #include <map>
@@ -58,10 +61,61 @@
 #define STR_VALUE(arg) #arg
 #define STR_NAME(name) STR_VALUE(name)
 
-typedef std::map<const GeoShape*, G4VSolid*, std::less<const GeoShape*> > shapesMap;
+namespace {
+  /// True if GeoShapeSorter can compare the shape
+  bool isSortable(const GeoShape* shape) {
+    const unsigned int typeID = shape->typeID();
+    if (typeID == GeoTessellatedSolid::getClassTypeID() ||
+        typeID == GeoUnidentifiedShape::getClassTypeID()) return false;
+    if (typeID == GeoShapeShift::getClassTypeID())
+      return isSortable(static_cast<const GeoShapeShift*>(shape)->getOp());
+    if (typeID == GeoShapeUnion::getClassTypeID()) {
+      const GeoShapeUnion* op = static_cast<const GeoShapeUnion*>(shape);
+      return isSortable(op->getOpA()) && isSortable(op->getOpB());
+    }
+    if (typeID == GeoShapeIntersection::getClassTypeID()) {
+      const GeoShapeIntersection* op = static_cast<const GeoShapeIntersection*>(shape);
+      return isSortable(op->getOpA()) && isSortable(op->getOpB());
+    }
+    if (typeID == GeoShapeSubtraction::getClassTypeID()) {
+      const GeoShapeSubtraction* op = static_cast<const GeoShapeSubtraction*>(shape);
+      return isSortable(op->getOpA()) && isSortable(op->getOpB());
+    }
+    return true;
+  }
+
+  /// Approximate memory footprint of a solid and of its constituents
+  size_t solidBytes(const G4VSolid* solid) {
+    if (const G4BooleanSolid* boolean = dynamic_cast<const G4BooleanSolid*>(solid))
+      return sizeof(G4UnionSolid) + solidBytes(boolean->GetConstituentSolid(0))
+                                  + solidBytes(boolean->GetConstituentSolid(1));
+    if (const G4DisplacedSolid* displaced = dynamic_cast<const G4DisplacedSolid*>(solid))
+      return sizeof(G4DisplacedSolid) + 2 * sizeof(G4AffineTransform)
+             + solidBytes(displaced->GetConstituentMovedSolid());
+    if (const G4Polycone* polycone = dynamic_cast<const G4Polycone*>(solid))
+      return sizeof(G4Polycone) + polycone->GetNumRZCorner() * sizeof(G4PolyconeSideRZ);
+    if (const G4Polyhedra* polyhedra = dynamic_cast<const G4Polyhedra*>(solid))
+      return sizeof(G4Polyhedra) + polyhedra->GetNumRZCorner() * sizeof(G4PolyhedraSideRZ);
+    if (const G4ExtrudedSolid* extruded = dynamic_cast<const G4ExtrudedSolid*>(solid))
+      return sizeof(G4ExtrudedSolid) + extruded->GetNofVertices() * sizeof(G4TwoVector)
+             + extruded->GetNofZSections() * sizeof(G4ExtrudedSolid::ZSection);
+    if (dynamic_cast<const G4Box*>(solid)) return sizeof(G4Box);
+    if (dynamic_cast<const G4Tubs*>(solid)) return sizeof(G4Tubs);
+    if (dynamic_cast<const G4Cons*>(solid)) return sizeof(G4Cons);
+    if (dynamic_cast<const G4Trd*>(solid)) return sizeof(G4Trd);
+    if (dynamic_cast<const G4Trap*>(solid)) return sizeof(G4Trap);
+    if (dynamic_cast<const G4Para*>(solid)) return sizeof(G4Para);
+    if (dynamic_cast<const G4Torus*>(solid)) return sizeof(G4Torus);
+    if (dynamic_cast<const G4EllipticalTube*>(solid)) return sizeof(G4EllipticalTube);
+    if (dynamic_cast<const G4GenericTrap*>(solid)) return sizeof(G4GenericTrap);
+    if (dynamic_cast<const G4TwistedTrap*>(solid)) return sizeof(G4TwistedTrap);
+    return sizeof(G4VSolid);
+  }
+}
 
 
-Geo2G4SolidFactory::Geo2G4SolidFactory()
+Geo2G4SolidFactory::Geo2G4SolidFactory(Geo2G4ConversionContext& context):
+  m_context(context)
 {
 }
 
@@ -75,9 +129,17 @@ G4VSolid *Geo2G4SolidFactory::Build(const GeoShape* geoShape, std::string name)
 
   G4VSolid* theSolid(nullptr);
 
-  static shapesMap sharedShapes;
-  if(sharedShapes.find(geoShape)!=sharedShapes.end())
-    return sharedShapes[geoShape];
+  if((theSolid = m_context.solids().find(geoShape)))
+    return theSolid;
+
+  // Optionally, share the solid of an equal shape
+  const bool deduplicate = m_context.deduplicateSolids() && isSortable(geoShape);
+  if(deduplicate && (theSolid = m_context.findEqualSolid(geoShape)))
+    {
+      m_context.solids().insert(geoShape,theSolid);
+      m_context.countDeduplicatedSolid(solidBytes(theSolid));
+      return theSolid;
+    }
 
   // ------- Variables for boolean operations
   G4VSolid* solidA(nullptr);
@@ -516,5 +578,11 @@ G4VSolid *Geo2G4SolidFactory::Build(const GeoShape* geoShape, std::string name)
       theSolid=plugin->newG4Solid(customShape);
     }
   }
+  if(theSolid)
+    {
+      m_context.solids().insert(geoShape,theSolid);
+      m_context.countSolid();
+      if(deduplicate) m_context.insertEqualSolid(geoShape,theSolid);
+    }
   return theSolid;
 }
@@ -0,0 +1,114 @@
+// Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+
+/*
+ * DBTable.h
+ *
+ * A column-oriented, typed container for the records of a DB table.
+ *
+ * Each column is stored in a single contiguous array of its own type,
+ * instead of one std::vector<std::variant> per row as in DBRowsList:
+ * loading a table does not allocate anything per row, and the numeric data
+ * take the space of their value only. Text cells are interned in a pool
+ * shared by all the columns of the table, so that repeated strings
+ * (e.g. names or types) are stored once.
+ *
+ * SQLite does not enforce the type of a column; if the cells of a column
+ * do not all have the same type, that column falls back to the generic
+ * DBRecordEntry storage, and the accessors behave as the ones in
+ * GeoModelHelpers::variantHelper.
+ *
+ */
+
+#ifndef GEOMODELDBMANAGER_DBTABLE_H
+#define GEOMODELDBMANAGER_DBTABLE_H
+
+#include "GeoModelDBManager/definitions.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class DBTable {
+   public:
+    enum class ColumnType : unsigned char { Empty, Int, Double, Text, Mixed };
+
+    DBTable() = default;
+    /// Create an empty table with 'nColumns' columns
+    explicit DBTable(std::size_t nColumns) : m_columns(nColumns) {}
+
+    /// The index of the interned strings points into the string pool,
+    /// hence it is rebuilt when the table is copied
+    DBTable(const DBTable& other);
+    DBTable& operator=(const DBTable& other);
+    DBTable(DBTable&&) = default;
+    DBTable& operator=(DBTable&&) = default;
+
+    /// Number of rows
+    std::size_t size() const { return m_nRows; }
+    bool empty() const { return m_nRows == 0; }
+    std::size_t nColumns() const { return m_columns.size(); }
+    ColumnType columnType(std::size_t col) const { return m_columns[col].type; }
+
+    // --- methods to fill the table, one row after the other ---
+    void appendInt(std::size_t col, int value);
+    void appendDouble(std::size_t col, double value);
+    void appendText(std::size_t col, std::string_view value);
+    /// Close the current row; all the columns must have been filled
+    void finishRow() { ++m_nRows; }
+
+    // --- accessors ---
+    //! As for GeoModelHelpers::variantHelper, the accessors throw if the
+    //! stored value is not of the requested type; 'logMsg' describes the
+    //! requested item in the error message.
+    int getInt(std::size_t row, std::size_t col, std::string_view logMsg = "") const {
+        const Column& column = m_columns[col];
+        if (column.type == ColumnType::Int) return column.ints[row];
+        return getIntSlow(row, col, logMsg);
+    }
+    double getDouble(std::size_t row, std::size_t col, std::string_view logMsg = "") const {
+        const Column& column = m_columns[col];
+        if (column.type == ColumnType::Double) return column.doubles[row];
+        return getDoubleSlow(row, col, logMsg);
+    }
+    const std::string& getString(std::size_t row, std::size_t col, std::string_view logMsg = "") const {
+        const Column& column = m_columns[col];
+        if (column.type == ColumnType::Text) return m_strings[column.texts[row]];
+        return getStringSlow(row, col, logMsg);
+    }
+
+    /// Return a single cell, or a whole row, in the generic format;
+    /// meant for the clients which still work with DBRowEntry items.
+    DBRecordEntry getRecord(std::size_t row, std::size_t col) const;
+    DBRowEntry getRow(std::size_t row) const;
+
+   private:
+    struct Column {
+        ColumnType type{ColumnType::Empty};
+        std::vector<int> ints{};
+        std::vector<double> doubles{};
+        /// indices in the string pool
+        std::vector<std::uint32_t> texts{};
+        std::vector<DBRecordEntry> mixed{};
+    };
+
+    /// Move the cells of 'column' to the generic storage
+    void convertToMixed(Column& column) const;
+    std::uint32_t internString(std::string_view value);
+
+    int getIntSlow(std::size_t row, std::size_t col, std::string_view logMsg) const;
+    double getDoubleSlow(std::size_t row, std::size_t col, std::string_view logMsg) const;
+    const std::string& getStringSlow(std::size_t row, std::size_t col, std::string_view logMsg) const;
+
+    std::vector<Column> m_columns{};
+    std::size_t m_nRows{0};
+    /// The pool of the interned strings. The elements of a std::deque are
+    /// never relocated, hence they can be used as keys of the index.
+    std::deque<std::string> m_strings{};
+    std::unordered_map<std::string_view, std::uint32_t> m_stringIndex{};
+};
+
+#endif
@@ -19,6 +19,7 @@
 #define GMDBManager_H
 
 #include "GeoModelDBManager/definitions.h"
+#include "GeoModelDBManager/DBTable.h"
 
 // include C++
 #include <iostream>
@@ -46,6 +47,10 @@ class GMDBManager {
      *
      * Constructor sets up connection with db and opens it
      * @param path - absolute path to db file
+     *
+     * If 'path' is a binary snapshot written by writeSnapshot(),
+     * the file is memory-mapped and all the tables are read from it;
+     * a snapshot is read-only.
      */
     GMDBManager(const std::string &path);
     //  GMDBManagerStd(const std::string &path);
@@ -66,6 +71,21 @@ class GMDBManager {
     /// - 2 : Debug
     void setLogLevel(unsigned loglevel) { m_loglevel = loglevel; };
 
+    /// Set whether records are inserted through prepared statements,
+    /// with typed bindings and in chunks of rows (default), or through
+    /// a single 'INSERT INTO ... VALUES' text query per table.
+    /// NOTE: with prepared statements, a failed insertion throws an
+    /// exception (and rolls back the table's own transaction), where the
+    /// text query makes the add*Records* methods return false.
+    void setBulkInsert(bool enable) { m_bulkInsert = enable; };
+
+    /// Open an explicit transaction: all records added until
+    /// commitTransaction() is called are written to the DB file at once.
+    /// Without an explicit transaction, each table is inserted
+    /// within its own transaction.
+    bool beginTransaction();
+    bool commitTransaction();
+
     bool initDB();
 
     int loadGeoNodeTypesAndBuildCache();
@@ -76,6 +96,17 @@ class GMDBManager {
     //  bool isOpen() const;
     bool checkIsDBOpen() const;
 
+    /// Returns true if the input file is a binary snapshot instead of SQLite
+    bool isSnapshot() const;
+
+    /**
+     * @brief Write all the tables of the DB to a binary snapshot file,
+     * which can be memory-mapped and read without any parsing (see GMSnapshot.h).
+     * The rows are stored in the order in which they are read from the DB.
+     * Throws if the file cannot be written.
+     */
+    void writeSnapshot(const std::string& path);
+
     /**
      * @brief Print names of all GeoPhysVol objects in db
      */
@@ -286,6 +317,7 @@ class GMDBManager {
     /// methods to dump the DB
     // std::vector<std::vector<std::string>> getChildrenTable();
     DBRowsList getChildrenTable();
+    DBTable getChildrenTable_Columns();
 
     // Table names for Aux tables are of the form prefix_suffix
     // where prefix depends on the type of data in the table
@@ -309,6 +341,10 @@ class GMDBManager {
         const std::string& tableName);
     DBRowsList getTableFromTableName_VecVecData(
         const std::string& tableName);
+    //! Same as the '_VecVecData' methods, but the records are stored
+    //! column by column, in a DBTable
+    DBTable getTableFromNodeType_Columns(const std::string& nodeType);
+    DBTable getTableFromTableName_Columns(const std::string& tableName);
     // specializations
     std::vector<double> getTableFromTableName_VectorDouble(const std::string& tableName);
     std::deque<double> getTableFromTableName_DequeDouble(std::string tableName);
@@ -319,6 +355,7 @@ class GMDBManager {
     std::vector<std::vector<std::string>> getTableRecords_String(const std::string_view tableName) const;
     DBRowEntry getTableRecords_VecData(const std::string_view tableName) const;
     DBRowsList getTableRecords_VecVecData(const std::string_view tableName) const;
+    DBTable getTableRecords_Columns(const std::string_view tableName) const;
 
     //! Test if a given table exists
     //! This requires the *full* table name (i.e. prefix_suffix)
@@ -418,6 +455,9 @@ class GMDBManager {
        /// Stores the loglevel, the level of output messages
        unsigned m_loglevel;
 
+       /// Insert records through prepared statements
+       bool m_bulkInsert{true};
+
        /// stores the column names for each table
        std::unordered_map<std::string, std::vector<std::string>> m_tableNames;
 
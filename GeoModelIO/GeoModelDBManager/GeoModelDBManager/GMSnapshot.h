@@ -0,0 +1,202 @@
+// Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+
+/*
+ * GMSnapshot.h
+ *
+ * A compact, versioned binary snapshot of the tables of a GeoModel SQLite file.
+ *
+ * The snapshot stores the very same tables written by WriteGeoModel (shapes,
+ * materials, transforms, children positions, ...), with the same rows,
+ * in the same order in which GMDBManager reads them from SQLite. Each column
+ * is stored as a fixed-layout array, and all the tables and columns are
+ * reached through offset tables; thus, the file can be memory-mapped and
+ * read in place, without any parsing nor per-row allocation.
+ *
+ * File layout (native byte order, all sections aligned to 8 bytes):
+ *   FileHeader
+ *   TableRecord[nTables]             -- at FileHeader::tablesOffset
+ *   ColumnRecord[nColumns]           -- at TableRecord::columnsOffset, per table
+ *   column data                      -- at ColumnRecord::dataOffset, per column:
+ *       Int:    int32_t[nRows]
+ *       Double: double[nRows]
+ *       Text:   TextRef[nRows]
+ *       Mixed:  MixedCell[nRows]
+ *   string pool                      -- at FileHeader::stringsOffset
+ *
+ * A GMDBManager opened on a snapshot file serves the tables from the snapshot
+ * instead of SQLite, so that ReadGeoModel can read it as a regular .db file.
+ * Snapshot files are written by GMDBManager::writeSnapshot().
+ *
+ */
+
+#ifndef GEOMODELDBMANAGER_GMSNAPSHOT_H
+#define GEOMODELDBMANAGER_GMSNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class GMSnapshot {
+   public:
+    /// Version of the file layout; files with a different version are rejected
+    static constexpr std::uint32_t formatVersion = 1;
+
+    enum class ColumnType : std::uint32_t { Empty = 0, Int = 1, Double = 2, Text = 3, Mixed = 4 };
+    enum class CellType : std::uint32_t { Null = 0, Int = 1, Double = 2, Text = 3 };
+
+    // --- fixed-layout records of the file ---
+    struct FileHeader {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t byteOrder;
+        std::uint64_t nTables;
+        std::uint64_t tablesOffset;
+        std::uint64_t stringsOffset;
+        std::uint64_t stringsSize;
+        std::uint64_t fileSize;
+    };
+    struct TableRecord {
+        std::uint64_t nameOffset;
+        std::uint64_t nameSize;
+        std::uint64_t nRows;
+        std::uint64_t nColumns;
+        std::uint64_t columnsOffset;
+    };
+    struct ColumnRecord {
+        std::uint64_t nameOffset;
+        std::uint64_t nameSize;
+        ColumnType type;
+        std::uint32_t padding;
+        std::uint64_t dataOffset;
+    };
+    /// a text cell, stored in the string pool
+    struct TextRef {
+        std::uint64_t offset;
+        std::uint64_t size;
+    };
+    /// a cell of a column whose cells do not all have the same type
+    struct MixedCell {
+        CellType type;
+        std::int32_t intValue;
+        double doubleValue;
+        TextRef text;
+    };
+
+    /// Read-only view on a table of the snapshot
+    class Table {
+       public:
+        std::string_view name() const { return m_snapshot->string(m_record->nameOffset, m_record->nameSize); }
+        std::size_t nRows() const { return m_record->nRows; }
+        std::size_t nColumns() const { return m_record->nColumns; }
+        std::string_view columnName(std::size_t col) const {
+            return m_snapshot->string(m_columns[col].nameOffset, m_columns[col].nameSize);
+        }
+        ColumnType columnType(std::size_t col) const { return m_columns[col].type; }
+
+        /// Type of a single cell, the equivalent of sqlite3_column_type()
+        CellType cellType(std::size_t row, std::size_t col) const {
+            switch (m_columns[col].type) {
+                case ColumnType::Int: return CellType::Int;
+                case ColumnType::Double: return CellType::Double;
+                case ColumnType::Text: return CellType::Text;
+                case ColumnType::Mixed: return mixed(row, col).type;
+                default: return CellType::Null;
+            }
+        }
+        //! The value of a cell; the type of the cell must be the requested one
+        int getInt(std::size_t row, std::size_t col) const {
+            if (m_columns[col].type == ColumnType::Int) return data<std::int32_t>(col)[row];
+            return mixed(row, col, CellType::Int).intValue;
+        }
+        double getDouble(std::size_t row, std::size_t col) const {
+            if (m_columns[col].type == ColumnType::Double) return data<double>(col)[row];
+            return mixed(row, col, CellType::Double).doubleValue;
+        }
+        std::string_view getText(std::size_t row, std::size_t col) const {
+            const TextRef& ref = m_columns[col].type == ColumnType::Text ? data<TextRef>(col)[row]
+                                                                         : mixed(row, col, CellType::Text).text;
+            return m_snapshot->string(ref.offset, ref.size);
+        }
+
+       private:
+        friend class GMSnapshot;
+        Table(const GMSnapshot* snapshot, const TableRecord* record, const ColumnRecord* columns)
+            : m_snapshot(snapshot), m_record(record), m_columns(columns) {}
+
+        template <class T>
+        const T* data(std::size_t col) const {
+            return reinterpret_cast<const T*>(m_snapshot->m_data + m_columns[col].dataOffset);
+        }
+        const MixedCell& mixed(std::size_t row, std::size_t col) const { return data<MixedCell>(col)[row]; }
+        const MixedCell& mixed(std::size_t row, std::size_t col, CellType type) const;
+
+        const GMSnapshot* m_snapshot;
+        const TableRecord* m_record;
+        const ColumnRecord* m_columns;
+    };
+
+    /// Map the snapshot file 'path' in memory; throws if the file
+    /// is not a valid snapshot
+    explicit GMSnapshot(const std::string& path);
+    ~GMSnapshot();
+    GMSnapshot(const GMSnapshot&) = delete;
+    GMSnapshot& operator=(const GMSnapshot&) = delete;
+
+    /// Check the magic number at the beginning of the file 'path'
+    static bool isSnapshotFile(const std::string& path);
+
+    const std::vector<Table>& tables() const { return m_tables; }
+    /// Return the table 'name', or nullptr if the snapshot does not have it
+    const Table* findTable(std::string_view name) const;
+
+    /// Collects the tables, one cell after the other in row-major order,
+    /// and writes the snapshot file
+    class Writer {
+       public:
+        void beginTable(std::string_view name, const std::vector<std::string>& columnNames);
+        void addNull();
+        void addInt(int value);
+        void addDouble(double value);
+        void addText(std::string_view value);
+        void endTable();
+        /// Write all the tables to 'path'; throws on I/O errors
+        void write(const std::string& path) const;
+
+       private:
+        struct Cell {
+            CellType type{CellType::Null};
+            std::int32_t intValue{0};
+            double doubleValue{0.};
+            TextRef text{};
+        };
+        struct PendingTable {
+            TextRef name{};
+            std::vector<TextRef> columnNames{};
+            std::vector<std::vector<Cell>> columns{};
+        };
+        Cell& nextCell();
+        TextRef intern(std::string_view value);
+
+        std::vector<PendingTable> m_tables{};
+        std::size_t m_nCells{0};
+        std::string m_strings{};
+        std::unordered_map<std::string, TextRef> m_stringIndex{};
+    };
+
+   private:
+    std::string_view string(std::uint64_t offset, std::uint64_t size) const {
+        return std::string_view{m_strings + offset, size};
+    }
+
+    std::string m_path{};
+    const char* m_data{nullptr};
+    std::size_t m_size{0};
+    const char* m_strings{nullptr};
+    std::vector<Table> m_tables{};
+    std::unordered_map<std::string_view, std::size_t> m_tableIndex{};
+};
+
+#endif
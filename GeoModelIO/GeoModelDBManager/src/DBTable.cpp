@@ -0,0 +1,138 @@
+// Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+
+#include "GeoModelDBManager/DBTable.h"
+
+#include "GeoModelHelpers/variantHelpers.h"
+#include "GeoModelKernel/throwExcept.h"
+
+#include <utility>
+
+namespace {
+    std::string_view typeName(DBTable::ColumnType type) {
+        switch (type) {
+            case DBTable::ColumnType::Int: return "int";
+            case DBTable::ColumnType::Double: return "double";
+            case DBTable::ColumnType::Text: return "string";
+            case DBTable::ColumnType::Mixed: return "mixed";
+            default: return "empty";
+        }
+    }
+}
+
+DBTable::DBTable(const DBTable& other)
+    : m_columns(other.m_columns), m_nRows(other.m_nRows), m_strings(other.m_strings) {
+    m_stringIndex.reserve(m_strings.size());
+    for (std::size_t index = 0; index < m_strings.size(); ++index) {
+        m_stringIndex.emplace(m_strings[index], index);
+    }
+}
+
+DBTable& DBTable::operator=(const DBTable& other) {
+    if (this != &other) {
+        DBTable copy{other};
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+void DBTable::appendInt(std::size_t col, int value) {
+    Column& column = m_columns[col];
+    if (column.type == ColumnType::Empty) column.type = ColumnType::Int;
+    if (column.type == ColumnType::Int) {
+        column.ints.push_back(value);
+        return;
+    }
+    convertToMixed(column);
+    column.mixed.emplace_back(value);
+}
+
+void DBTable::appendDouble(std::size_t col, double value) {
+    Column& column = m_columns[col];
+    if (column.type == ColumnType::Empty) column.type = ColumnType::Double;
+    if (column.type == ColumnType::Double) {
+        column.doubles.push_back(value);
+        return;
+    }
+    convertToMixed(column);
+    column.mixed.emplace_back(value);
+}
+
+void DBTable::appendText(std::size_t col, std::string_view value) {
+    Column& column = m_columns[col];
+    if (column.type == ColumnType::Empty) column.type = ColumnType::Text;
+    if (column.type == ColumnType::Text) {
+        column.texts.push_back(internString(value));
+        return;
+    }
+    convertToMixed(column);
+    column.mixed.emplace_back(std::string{value});
+}
+
+std::uint32_t DBTable::internString(std::string_view value) {
+    auto it = m_stringIndex.find(value);
+    if (it != m_stringIndex.end()) return it->second;
+    const std::uint32_t index = m_strings.size();
+    const std::string& stored = m_strings.emplace_back(value);
+    m_stringIndex.emplace(stored, index);
+    return index;
+}
+
+void DBTable::convertToMixed(Column& column) const {
+    if (column.type == ColumnType::Mixed) return;
+    column.mixed.reserve(m_nRows + 1);
+    for (const int value : column.ints) column.mixed.emplace_back(value);
+    for (const double value : column.doubles) column.mixed.emplace_back(value);
+    for (const std::uint32_t index : column.texts) column.mixed.emplace_back(m_strings[index]);
+    column.ints = std::vector<int>{};
+    column.doubles = std::vector<double>{};
+    column.texts = std::vector<std::uint32_t>{};
+    column.type = ColumnType::Mixed;
+}
+
+DBRecordEntry DBTable::getRecord(std::size_t row, std::size_t col) const {
+    const Column& column = m_columns[col];
+    switch (column.type) {
+        case ColumnType::Int: return column.ints[row];
+        case ColumnType::Double: return column.doubles[row];
+        case ColumnType::Text: return m_strings[column.texts[row]];
+        case ColumnType::Mixed: return column.mixed[row];
+        default: break;
+    }
+    THROW_EXCEPTION("ERROR! The column " << col << " of the table has no data!");
+}
+
+DBRowEntry DBTable::getRow(std::size_t row) const {
+    DBRowEntry entry{};
+    entry.reserve(m_columns.size());
+    for (std::size_t col = 0; col < m_columns.size(); ++col) {
+        entry.push_back(getRecord(row, col));
+    }
+    return entry;
+}
+
+int DBTable::getIntSlow(std::size_t row, std::size_t col, std::string_view logMsg) const {
+    const Column& column = m_columns[col];
+    if (column.type == ColumnType::Mixed) {
+        return GeoModelHelpers::variantHelper::getFromVariant_Int(column.mixed[row], logMsg);
+    }
+    THROW_EXCEPTION("'" << logMsg << "' is not a 'int'! It's a '" << typeName(column.type) << "'.");
+}
+
+double DBTable::getDoubleSlow(std::size_t row, std::size_t col, std::string_view logMsg) const {
+    const Column& column = m_columns[col];
+    if (column.type == ColumnType::Mixed) {
+        return GeoModelHelpers::variantHelper::getFromVariant_Double(column.mixed[row], logMsg);
+    }
+    THROW_EXCEPTION("'" << logMsg << "' is not a 'double'! It's a '" << typeName(column.type) << "'.");
+}
+
+const std::string& DBTable::getStringSlow(std::size_t row, std::size_t col, std::string_view logMsg) const {
+    const Column& column = m_columns[col];
+    if (column.type == ColumnType::Mixed) {
+        const std::string* value = std::get_if<std::string>(&column.mixed[row]);
+        if (value) return *value;
+        THROW_EXCEPTION("'" << logMsg << "' is not a 'string'! It's a '"
+                        << GeoModelHelpers::variantHelper::getFromVariant_Type(column.mixed[row]) << "'.");
+    }
+    THROW_EXCEPTION("'" << logMsg << "' is not a 'string'! It's a '" << typeName(column.type) << "'.");
+}
@@ -24,6 +24,7 @@
  */
 
 #include <GeoModelDBManager/GMDBManager.h>
+#include "GeoModelDBManager/GMSnapshot.h"
 
 #include "GeoModelKernel/throwExcept.h"
 #include "GeoModelHelpers/StringUtils.h"
@@ -39,6 +40,8 @@
 // C++ includes
 #include <cstdlib> /* exit, EXIT_FAILURE */
 
+#include <algorithm>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <utility>
@@ -46,6 +49,9 @@
 static std::string dbversion =
     "1.0.0";  // New format with REAL columns for numeric values
 
+// Maximum number of rows bound to a single prepared INSERT statement
+static constexpr size_t bulkInsertChunkSize = 256;
+
 
 class GMDBManager::Imp {
    public:
@@ -62,13 +68,182 @@ class GMDBManager::Imp {
     /// Variable to store error messages from SQLite
     char* m_SQLiteErrMsg;
 
+    /// The memory-mapped snapshot, if the input file is not a SQLite DB
+    std::unique_ptr<GMSnapshot> m_snapshot{};
+
+    /// Return the table 'tableName' of the snapshot; throws if it does not exist
+    const GMSnapshot::Table& snapshotTable(const std::string_view tableName) const;
+    /// Format a cell of the snapshot as sqlite3_column_text() does
+    static std::string snapshotCellText(const GMSnapshot::Table& table,
+                                        const size_t row, const size_t col);
+    /// Throw if the DB cannot be modified, i.e. if it is a snapshot
+    void checkIsWritable() const;
+
     sqlite3_stmt* selectAllFromTable(const std::string_view tableName) const;
     sqlite3_stmt* selectAllFromTableSortBy(const std::string_view tableName,
                                            const std::string_view sortColumn = "") const;
     sqlite3_stmt* selectAllFromTableChildrenPositions() const;
     bool checkTableFromDB_imp(const std::string& tableName) const;
+
+    /// Insert 'nRows' rows into a table through prepared statements.
+    /// The 'id' column is filled with the row number, starting from 1,
+    /// while the other columns are bound by 'bindRow(stmt, param, row)',
+    /// which has to advance 'param' past the last bound parameter.
+    /// An SQLite error throws, after rolling back the transaction opened
+    /// here, if any; an exception of 'bindRow' is propagated the same way.
+    template <class RowBinder>
+    bool insertRows(const std::string& tableName,
+                    const std::vector<std::string>& colNames,
+                    const size_t nRows, RowBinder&& bindRow);
+
+    /// Bind a single value to the i-th parameter of a statement
+    static int bindRecordEntry(sqlite3_stmt* stmt, const int param,
+                               const DBRecordEntry& item);
 };
 
+const GMSnapshot::Table& GMDBManager::Imp::snapshotTable(
+    const std::string_view tableName) const {
+    const GMSnapshot::Table* table = m_snapshot->findTable(tableName);
+    if (!table) {
+        THROW_EXCEPTION("ERROR!!! Table name '" << tableName << "' does not exist in the snapshot!");
+    }
+    return *table;
+}
+
+std::string GMDBManager::Imp::snapshotCellText(const GMSnapshot::Table& table,
+                                               const size_t row, const size_t col) {
+    switch (table.cellType(row, col)) {
+        case GMSnapshot::CellType::Int:
+            return std::to_string(table.getInt(row, col));
+        case GMSnapshot::CellType::Double: {
+            // same format used by SQLite to convert REAL values to text
+            char buffer[32];
+            sqlite3_snprintf(sizeof(buffer), buffer, "%!.15g", table.getDouble(row, col));
+            return buffer;
+        }
+        case GMSnapshot::CellType::Text:
+            return std::string{table.getText(row, col)};
+        default:
+            return "NULL";
+    }
+}
+
+void GMDBManager::Imp::checkIsWritable() const {
+    if (m_snapshot) {
+        THROW_EXCEPTION("ERROR! The snapshot file '" << theManager->m_dbpath << "' is read-only!");
+    }
+    theManager->checkIsDBOpen();
+}
+
+int GMDBManager::Imp::bindRecordEntry(sqlite3_stmt* stmt, const int param,
+                                      const DBRecordEntry& item) {
+    if (std::holds_alternative<int>(item))
+        return sqlite3_bind_int(stmt, param, std::get<int>(item));
+    else if (std::holds_alternative<long>(item))
+        return sqlite3_bind_int64(stmt, param, std::get<long>(item));
+    else if (std::holds_alternative<float>(item))
+        return sqlite3_bind_double(stmt, param, std::get<float>(item));
+    else if (std::holds_alternative<double>(item))
+        return sqlite3_bind_double(stmt, param, std::get<double>(item));
+    const std::string& str = std::get<std::string>(item);
+    // NOTE: a "NULL" string is stored as the SQL's NULL value,
+    // as done when building the text query
+    if (str == "NULL") return sqlite3_bind_null(stmt, param);
+    return sqlite3_bind_text(stmt, param, str.c_str(), str.size(),
+                             SQLITE_STATIC);
+}
+
+namespace {
+    /// Finalizes a prepared statement when leaving the scope
+    struct StmtGuard {
+        sqlite3_stmt* stmt{nullptr};
+        StmtGuard() = default;
+        StmtGuard(const StmtGuard&) = delete;
+        StmtGuard& operator=(const StmtGuard&) = delete;
+        ~StmtGuard() { sqlite3_finalize(stmt); }
+    };
+
+    /// Rolls back an open transaction when leaving the scope without
+    /// having committed it
+    struct TransactionGuard {
+        sqlite3* db{nullptr};
+        explicit TransactionGuard(sqlite3* theDb) : db{theDb} {}
+        TransactionGuard(const TransactionGuard&) = delete;
+        TransactionGuard& operator=(const TransactionGuard&) = delete;
+        ~TransactionGuard() {
+            if (db) sqlite3_exec(db, "ROLLBACK TRANSACTION;", NULL, 0, NULL);
+        }
+    };
+}
+
+template <class RowBinder>
+bool GMDBManager::Imp::insertRows(const std::string& tableName,
+                                  const std::vector<std::string>& colNames,
+                                  const size_t nRows, RowBinder&& bindRow) {
+    checkIsWritable();
+    // bind as many rows as possible to a single statement, within the limit
+    // of the number of host parameters allowed by SQLite
+    const size_t nCols = colNames.size();
+    const size_t maxParams =
+        sqlite3_limit(m_dbSqlite, SQLITE_LIMIT_VARIABLE_NUMBER, -1);
+    const size_t chunkSize =
+        std::max<size_t>(1, std::min(bulkInsertChunkSize, maxParams / nCols));
+
+    const std::string rowParams =
+        "(" + GeoStrUtils::chainUp(std::vector<std::string>(nCols, "?"), ",") + ")";
+    const std::string insertStr =
+        fmt::format("INSERT INTO {0} ({1}) VALUES ", tableName,
+                    GeoStrUtils::chainUp(colNames, ", "));
+    auto prepare = [&](const size_t rowsPerStmt) {
+        std::string sql = insertStr + rowParams;
+        for (size_t r = 1; r < rowsPerStmt; ++r) sql += "," + rowParams;
+        sqlite3_stmt* st = nullptr;
+        if (sqlite3_prepare_v2(m_dbSqlite, sql.c_str(), -1, &st, NULL) != SQLITE_OK) {
+            sqlite3_finalize(st);
+            return static_cast<sqlite3_stmt*>(nullptr);
+        }
+        return st;
+    };
+
+    // If no explicit transaction is open, insert the whole table at once;
+    // the transaction is rolled back if an error is thrown before the commit
+    const bool ownTransaction = sqlite3_get_autocommit(m_dbSqlite);
+    if (ownTransaction) theManager->beginTransaction();
+    TransactionGuard transaction{ownTransaction ? m_dbSqlite : nullptr};
+
+    // one statement for the full chunks, one for the remaining rows
+    StmtGuard chunkStmt{};
+    StmtGuard rowStmt{};
+    size_t row = 0;
+    bool failed = false;
+    while (!failed && row < nRows) {
+        const size_t rowsPerStmt = (nRows - row >= chunkSize) ? chunkSize : 1;
+        sqlite3_stmt*& stmt = (rowsPerStmt == chunkSize) ? chunkStmt.stmt : rowStmt.stmt;
+        if (!stmt && !(stmt = prepare(rowsPerStmt))) {
+            failed = true;
+            break;
+        }
+        int param = 1;
+        int rc = SQLITE_OK;
+        for (size_t r = 0; r < rowsPerStmt && rc == SQLITE_OK; ++r, ++row) {
+            rc = sqlite3_bind_int64(stmt, param++, row + 1);  // id
+            if (rc == SQLITE_OK) rc = bindRow(stmt, param, row);
+        }
+        if (rc == SQLITE_OK) rc = sqlite3_step(stmt);
+        if ((failed = (rc != SQLITE_DONE))) break;
+        sqlite3_reset(stmt);
+        // no value of this chunk can be left for the next one
+        sqlite3_clear_bindings(stmt);
+    }
+    if (failed) {
+        THROW_EXCEPTION("[SQLite ERR] (" << __func__ << ") : table '" << tableName
+                        << "', Error msg: " << sqlite3_errmsg(m_dbSqlite));
+    }
+    if (!ownTransaction) return true;
+    transaction.db = nullptr;
+    return theManager->commitTransaction();
+}
+
 GMDBManager::GMDBManager(const std::string& path)
     : m_loglevel(0), 
     m_dbpath(path), 
@@ -77,11 +252,15 @@ GMDBManager::GMDBManager(const std::string& path)
     // FIXME: TODO: we should check the existence of the file, otherwise SQLite
     // will create a new file from scratch
 
+    // A binary snapshot is mapped in memory, and it replaces the SQLite connection
+    if (GMSnapshot::isSnapshotFile(path)) {
+        m_d->m_snapshot = std::make_unique<GMSnapshot>(path);
+        std::cout << "The Geometry snapshot '" << path
+                  << "' has been opened successfully!" << std::endl;
+    }
     // Save the connection result
-    int exit = sqlite3_open(path.c_str(), &m_d->m_dbSqlite);
-
-    // Test if there was an error
-    if (exit == SQLITE_OK) {
+    else if (int exit = sqlite3_open(path.c_str(), &m_d->m_dbSqlite);
+             exit == SQLITE_OK) {
         std::cout << "The Geometry Database '" << path
                   << "' has been opened successfully!" << std::endl;
     } else {
@@ -237,6 +416,17 @@ std::vector<std::vector<std::string>> GMDBManager::getTableRecords_String(
 
     // container to be returned
     std::vector<std::vector<std::string>> records;
+    if (m_d->m_snapshot) {
+        const GMSnapshot::Table& table = m_d->snapshotTable(tableName);
+        records.reserve(table.nRows());
+        for (size_t row = 0; row < table.nRows(); ++row) {
+            std::vector<std::string>& nodeParams = records.emplace_back();
+            for (size_t col = 0; col < table.nColumns(); ++col) {
+                nodeParams.push_back(Imp::snapshotCellText(table, row, col));
+            }
+        }
+        return records;
+    }
     // get the query statetement ready to be executed
     sqlite3_stmt* stmt = nullptr;
 
@@ -296,6 +486,34 @@ DBRowsList GMDBManager::getTableRecords_VecVecData(
     
     // container to be returned
     DBRowsList records;
+    if (m_d->m_snapshot)
+    {
+        const GMSnapshot::Table &table = m_d->snapshotTable(tableName);
+        records.reserve(table.nRows());
+        for (size_t row = 0; row < table.nRows(); ++row)
+        {
+            DBRowEntry &nodeParams = records.emplace_back();
+            nodeParams.reserve(table.nColumns());
+            for (size_t col = 0; col < table.nColumns(); ++col)
+            {
+                switch (table.cellType(row, col))
+                {
+                case GMSnapshot::CellType::Int:
+                    nodeParams.push_back(table.getInt(row, col));
+                    break;
+                case GMSnapshot::CellType::Double:
+                    nodeParams.push_back(table.getDouble(row, col));
+                    break;
+                case GMSnapshot::CellType::Text:
+                    nodeParams.push_back(std::string{table.getText(row, col)});
+                    break;
+                default:
+                    THROW_EXCEPTION("ERROR!!! 'NULL' format detected. Check that!");
+                }
+            }
+        }
+        return records;
+    }
     // get the query statetement ready to be executed
     sqlite3_stmt *stmt = nullptr;
 
@@ -406,6 +624,36 @@ DBRowEntry GMDBManager::getTableRecords_VecData(
     }
     // container to be returned
     DBRowEntry records;
+    if (m_d->m_snapshot)
+    {
+        const GMSnapshot::Table &table = m_d->snapshotTable(tableName);
+        if (table.nColumns() > 2)
+        {
+            THROW_EXCEPTION("ERROR! Table '" << tableName << "' is supposed to have two columns only, one for the ID and one for actual data; but it has '"
+                      << table.nColumns() << "' columns! Check that!!");
+        }
+        // we only return the 'data' column, that is column '1'
+        const size_t colData = 1;
+        records.reserve(table.nRows());
+        for (size_t row = 0; row < table.nRows(); ++row)
+        {
+            switch (table.cellType(row, colData))
+            {
+            case GMSnapshot::CellType::Int:
+                records.push_back(table.getInt(row, colData));
+                break;
+            case GMSnapshot::CellType::Double:
+                records.push_back(table.getDouble(row, colData));
+                break;
+            case GMSnapshot::CellType::Text:
+                records.push_back(std::string{table.getText(row, colData)});
+                break;
+            default:
+                std::cout << "ERROR!!! 'NULL' format detected. Check that!" << std::endl;
+            }
+        }
+        return records;
+    }
     // get the query statetement ready to be executed
     sqlite3_stmt *stmt = nullptr;
 
@@ -563,6 +811,123 @@ DBRowsList GMDBManager::getTableFromNodeType_VecVecData(
     }
     return out;
 }
+DBTable GMDBManager::getTableRecords_Columns(
+    const std::string_view tableName) const
+{
+    DBTable records{};
+    if (m_d->m_snapshot)
+    {
+        const GMSnapshot::Table &table = m_d->snapshotTable(tableName);
+        records = DBTable(table.nColumns());
+        for (size_t row = 0; row < table.nRows(); ++row)
+        {
+            for (size_t col = 0; col < table.nColumns(); ++col)
+            {
+                switch (table.cellType(row, col))
+                {
+                case GMSnapshot::CellType::Int:
+                    records.appendInt(col, table.getInt(row, col));
+                    break;
+                case GMSnapshot::CellType::Double:
+                    records.appendDouble(col, table.getDouble(row, col));
+                    break;
+                case GMSnapshot::CellType::Text:
+                    records.appendText(col, table.getText(row, col));
+                    break;
+                default:
+                    THROW_EXCEPTION("ERROR!!! 'NULL' format detected. Check that!");
+                }
+            }
+            records.finishRow();
+        }
+        return records;
+    }
+    sqlite3_stmt *stmt = nullptr;
+    if ("ChildrenPositions" == tableName)
+    {
+        stmt = m_d->selectAllFromTableChildrenPositions();
+    }
+    else
+    {
+        stmt = m_d->selectAllFromTable(tableName);
+    }
+    if (!stmt) return records;
+
+    const int ctotal = sqlite3_column_count(stmt);
+    records = DBTable(ctotal);
+    int res = 0;
+    while ((res = sqlite3_step(stmt)) == SQLITE_ROW)
+    {
+        for (int i = 0; i < ctotal; ++i)
+        {
+            const int datacode = sqlite3_column_type(stmt, i);
+            if (SQLiteColumnTypes::INT_TYPE == datacode)
+            {
+                records.appendInt(i, sqlite3_column_int(stmt, i));
+            }
+            else if (SQLiteColumnTypes::FLOAT_TYPE == datacode)
+            {
+                records.appendDouble(i, sqlite3_column_double(stmt, i));
+            }
+            else if (SQLiteColumnTypes::TEXT_TYPE == datacode)
+            {
+                const char *cc = (char *)sqlite3_column_text(stmt, i);
+                records.appendText(i, cc ? std::string_view{cc} : std::string_view{"NULL"});
+            }
+            else
+            {
+                sqlite3_finalize(stmt);
+                if (SQLiteColumnTypes::BLOB_TYPE == datacode) {
+                    THROW_EXCEPTION("ERROR!!! The 'BLOB' data format is not supported yet!!");
+                }
+                if (SQLiteColumnTypes::NULL_TYPE == datacode) {
+                    THROW_EXCEPTION("ERROR!!! 'NULL' format detected. Check that!");
+                }
+                THROW_EXCEPTION("ERROR!!! You should NOT get here!! Unsupported SQLite data typecode: " << datacode << " -- Check this!!");
+            }
+        }
+        records.finishRow();
+    }
+    if (res == SQLITE_ERROR)
+    {
+        std::string errmsg(sqlite3_errmsg(m_d->m_dbSqlite));
+        sqlite3_finalize(stmt);
+        THROW_EXCEPTION(errmsg);
+    }
+    sqlite3_finalize(stmt);
+    return records;
+}
+
+DBTable GMDBManager::getTableFromNodeType_Columns(
+    const std::string& nodeType)
+{
+    const std::string tableName = getTableNameFromNodeType(nodeType);
+    if (tableName.empty())
+    {
+        if (m_loglevel > 1)
+        {
+            std::cout << "\t ===> WARNING! The geometry input file does not contain a table for the '"
+                      << nodeType
+                      << "' nodes. That means that you are probably using an "
+                      << "old geometry file. Unless you know exactly what you are doing, "
+                      << "please expect to see incomplete geometries or crashes.\n"
+                      << std::endl;
+        }
+        return DBTable{};
+    }
+    return getTableFromTableName_Columns(tableName);
+}
+
+DBTable GMDBManager::getTableFromTableName_Columns(
+    const std::string& tableName)
+{
+    if (!checkTableFromDB(tableName))
+    {
+        THROW_EXCEPTION("ERROR!!! Table name '" + tableName + "' does not exist in the DB!");
+    }
+    return getTableRecords_Columns(tableName);
+}
+
 DBRowsList GMDBManager::getTableFromTableName_VecVecData(
     const std::string& tableName)
 {
@@ -784,6 +1149,18 @@ bool GMDBManager::addListOfRecordsToTable(
     std::cout << "Info: number of " << tableName
               << " records to dump into the DB: " << nRecords << std::endl;
 
+    if (m_bulkInsert) {
+        return m_d->insertRows(tableName, m_tableNames.at(tableName), nRecords,
+            [&records](sqlite3_stmt* stmt, int& param, size_t row) {
+                int rc = SQLITE_OK;
+                for (const std::string& item : records[row]) {
+                    if ((rc = sqlite3_bind_text(stmt, param++, item.c_str(),
+                                                item.size(), SQLITE_STATIC)) != SQLITE_OK) break;
+                }
+                return rc;
+            });
+    }
+
     // preparing the SQL query
     std::string sql =
         fmt::format("INSERT INTO {0} {1} VALUES ", tableName, tableColString);
@@ -834,6 +1211,16 @@ bool GMDBManager::addListOfRecordsToTable(
     std::cout << "Info: number of " << tableName
               << " records to dump into the DB: " << nRecords << std::endl;
 
+    if (m_bulkInsert) {
+        return m_d->insertRows(tableName, m_tableNames.at(tableName), nRecords,
+            [&records](sqlite3_stmt* stmt, int& param, size_t row) {
+                int rc = SQLITE_OK;
+                for (const DBRecordEntry& item : records[row]) {
+                    if ((rc = Imp::bindRecordEntry(stmt, param++, item)) != SQLITE_OK) break;
+                }
+                return rc;
+            });
+    }
 
     // preparing the SQL query
     std::string sql =
@@ -904,14 +1291,20 @@ bool GMDBManager::addRecordsToTable(
     std::cout << "Info: number of " << tableName
               << " records to dump into the DB: " << nRecords << std::endl;
 
+    // each record is stored in its own row
+    if (m_bulkInsert) {
+        return m_d->insertRows(tableName, m_tableNames.at(tableName), nRecords,
+            [&records](sqlite3_stmt* stmt, int& param, size_t row) {
+                return Imp::bindRecordEntry(stmt, param++, records[row]);
+            });
+    }
+
     // preparing the SQL query
     std::string sql =
         fmt::format("INSERT INTO {0} {1} VALUES ", tableName, tableColString);
     unsigned int id = 0;
     // a vector to store string-conversions of values, to build the SQL
     // query
-    // TODO: we should remove this TEXT-conversion 
-    // and we should use prepared statements instead!
     std::vector<std::string> items;
     // loop over all entries in a row/record
     for (const std::variant<int, long, float, double, std::string> &item :
@@ -995,7 +1388,7 @@ bool GMDBManager::addRootVolume(const std::pair<std::string, unsigned>& rootValu
 }
 
 void GMDBManager::addDBversion(const std::string& version) {
-    checkIsDBOpen();
+    m_d->checkIsWritable();
     sqlite3_stmt* st = nullptr;
     int rc = -1;
     std::string sql = "INSERT INTO dbversion(version) VALUES(?)";
@@ -1014,8 +1407,10 @@ void GMDBManager::addDBversion(const std::string& version) {
     return;
 }
 
+bool GMDBManager::isSnapshot() const { return m_d->m_snapshot != nullptr; }
+
 bool GMDBManager::checkIsDBOpen() const {
-    if (m_d->m_dbSqlite != nullptr) {
+    if (m_d->m_dbSqlite != nullptr || m_d->m_snapshot) {
         return true;
     } else {
         THROW_EXCEPTION("ERROR! The SQLite DB is not accessible! Exiting...");
@@ -1043,6 +1438,21 @@ std::vector<std::string> GMDBManager::getItemFromTableName(
      * Get the object from DB.
      */
     std::vector<std::string> item;
+    if (m_d->m_snapshot) {
+        const GMSnapshot::Table& table = m_d->snapshotTable(tableName);
+        for (size_t row = 0; row < table.nRows() && item.empty(); ++row) {
+            if (table.cellType(row, 0) != GMSnapshot::CellType::Int ||
+                table.getInt(row, 0) != static_cast<int>(id)) continue;
+            for (size_t col = 0; col < table.nColumns(); ++col) {
+                item.push_back(Imp::snapshotCellText(table, row, col));
+            }
+        }
+        if (item.empty()) {
+            THROW_EXCEPTION("ERROR!! Item with ID:'" << id << "' does not exist in table"
+                      << tableName << "! Exiting...");
+        }
+        return item;
+    }
     // set a SQL command string with the right table name
     std::string sql =
         fmt::format("SELECT * FROM {0} WHERE id = (?)", tableName);
@@ -1105,6 +1515,9 @@ std::vector<std::string> GMDBManager::getItemFromTableName(
 DBRowsList GMDBManager::getChildrenTable() {
     return getTableRecords_VecVecData("ChildrenPositions");
 }
+DBTable GMDBManager::getChildrenTable_Columns() {
+    return getTableRecords_Columns("ChildrenPositions");
+}
 
 unsigned int GMDBManager::getTableIdFromNodeType(const std::string_view nodeType) {
     if (m_cache_nodeType_tableID.empty()) THROW_EXCEPTION("ERROR! Cache is empty!");
@@ -1133,6 +1546,19 @@ std::string GMDBManager::getTableNameFromNodeType(const std::string& nodeType) {
 // build the GeoNodeTypes cache
 int GMDBManager::loadGeoNodeTypesAndBuildCache() {
     checkIsDBOpen();
+    if (m_d->m_snapshot) {
+        const GMSnapshot::Table& table = m_d->snapshotTable("GeoNodesTypes");
+        for (size_t row = 0; row < table.nRows(); ++row) {
+            const unsigned int id = table.getInt(row, 0);
+            const std::string nodeType{table.getText(row, 1)};
+            const std::string tableName{table.getText(row, 2)};
+            m_cache_tableId_tableName.emplace(id, tableName);
+            m_cache_tableId_nodeType.emplace(id, nodeType);
+            m_cache_nodeType_tableName.emplace(nodeType, tableName);
+            m_cache_nodeType_tableID.emplace(nodeType, id);
+        }
+        return SQLITE_DONE;
+    }
     std::string queryStr;
     sqlite3_stmt* st = nullptr;
     int rc = -1;
@@ -1225,6 +1651,7 @@ sqlite3_stmt* GMDBManager::Imp::selectAllFromTableSortBy(
 
 bool GMDBManager::Imp::checkTableFromDB_imp(const std::string& tableName) const {
     theManager->checkIsDBOpen();
+    if (m_snapshot) return m_snapshot->findTable(tableName) != nullptr;
     sqlite3_stmt* st = nullptr;  // SQLite statement to be returned
     int rc = -1;                 // SQLite return code
     // set the SQL query string
@@ -1284,6 +1711,13 @@ void GMDBManager::printAllDBTables() {
 void GMDBManager::getAllDBTables() {
     std::string tableName;
     std::set<std::string> tables;
+    if (m_d->m_snapshot) {
+        for (const GMSnapshot::Table& table : m_d->m_snapshot->tables()) {
+            tables.emplace(table.name());
+        }
+        m_cache_tables = tables;
+        return;
+    }
     // define a query string containing the necessary SQL instructions
     std::string queryStr =
         "SELECT name FROM sqlite_master WHERE type ='table' AND name NOT "
@@ -1327,6 +1761,13 @@ void GMDBManager::getAllDBTableColumns() {
     }
 
     for (const auto& tableName : m_cache_tables) {
+        if (m_d->m_snapshot) {
+            const GMSnapshot::Table& table = m_d->snapshotTable(tableName);
+            for (size_t col = 0; col < table.nColumns(); ++col) {
+                m_tableNames[tableName].emplace_back(table.columnName(col));
+            }
+            continue;
+        }
         sqlite3_stmt* stmt;
         // get the 'name' column from the PRAGMA's table's definition
         // see: https://stackoverflow.com/a/54962853/320369
@@ -2480,10 +2921,18 @@ bool GMDBManager::createTables() {
     return false;
 }
 
+bool GMDBManager::beginTransaction() {
+    return execQuery("BEGIN TRANSACTION;") == SQLITE_OK;
+}
+
+bool GMDBManager::commitTransaction() {
+    return execQuery("COMMIT TRANSACTION;") == SQLITE_OK;
+}
+
 int GMDBManager::execQuery(const std::string& queryStr) {
     if (m_loglevel > 2)
         std::cout << "queryStr to execute: " << queryStr << std::endl;  // debug
-    checkIsDBOpen();
+    m_d->checkIsWritable();
     int result = -1;
     if ((result = sqlite3_exec(m_d->m_dbSqlite, queryStr.c_str(), NULL, 0,
                                &m_d->m_SQLiteErrMsg))) {
@@ -2518,7 +2967,7 @@ bool GMDBManager::hasTableBeenCreatedInDB(const std::string_view tableName) {
 
 
 void GMDBManager::storeNodeType(const std::string& nodeType, const std::string& tableName) {
-    checkIsDBOpen();
+    m_d->checkIsWritable();
     std::string queryStr;
     sqlite3_stmt* st = nullptr;
     int rc = -1;
@@ -2586,7 +3035,7 @@ void GMDBManager::storeNodeType(const std::string& nodeType, const std::string&
 
 bool GMDBManager::storeRootVolume(const unsigned &id,
                                   const std::string_view nodeType) {
-    checkIsDBOpen();
+    m_d->checkIsWritable();
 
     std::string tableName = "RootVolume";
     const unsigned int typeId = getTableIdFromNodeType(nodeType);
@@ -2623,6 +3072,14 @@ bool GMDBManager::storeRootVolume(const unsigned &id,
 
 // std::vector<std::string> GMDBManager::getRootPhysVol() {
 std::pair<unsigned, unsigned> GMDBManager::getRootPhysVol() {
+    if (m_d->m_snapshot) {
+        const GMSnapshot::Table& table = m_d->snapshotTable("RootVolume");
+        if (!table.nRows()) return std::pair<unsigned, unsigned>{0, 0};
+        const size_t row = table.nRows() - 1;
+        return std::pair<unsigned, unsigned>{
+            static_cast<unsigned>(table.getInt(row, 2)),
+            static_cast<unsigned>(table.getInt(row, 1))};
+    }
     // get the type and ID of the ROOT vol from the table "RootVolume"
     sqlite3_stmt* stmt = m_d->selectAllFromTable("RootVolume");
     // declare the data we want to fetch
@@ -2653,6 +3110,85 @@ std::pair<unsigned, unsigned> GMDBManager::getRootPhysVol() {
 
 std::string GMDBManager::getDBFilePath() { return m_dbpath; }
 
+void GMDBManager::writeSnapshot(const std::string& path) {
+    checkIsDBOpen();
+    // reload the list of tables, which may have been created after opening the DB
+    getAllDBTables();
+    GMSnapshot::Writer writer{};
+    for (const std::string& tableName : m_cache_tables) {
+        // a snapshot can be copied to a new file as well
+        if (m_d->m_snapshot) {
+            const GMSnapshot::Table& table = m_d->snapshotTable(tableName);
+            std::vector<std::string> columnNames{};
+            for (size_t col = 0; col < table.nColumns(); ++col) {
+                columnNames.emplace_back(table.columnName(col));
+            }
+            writer.beginTable(tableName, columnNames);
+            for (size_t row = 0; row < table.nRows(); ++row) {
+                for (size_t col = 0; col < table.nColumns(); ++col) {
+                    switch (table.cellType(row, col)) {
+                        case GMSnapshot::CellType::Int: writer.addInt(table.getInt(row, col)); break;
+                        case GMSnapshot::CellType::Double: writer.addDouble(table.getDouble(row, col)); break;
+                        case GMSnapshot::CellType::Text: writer.addText(table.getText(row, col)); break;
+                        default: writer.addNull();
+                    }
+                }
+            }
+            writer.endTable();
+            continue;
+        }
+        // store the rows in the same order in which they are read from SQLite;
+        // custom tables without an 'id' column are kept in insertion order
+        sqlite3_stmt* stmt = nullptr;
+        if ("ChildrenPositions" == tableName) {
+            stmt = m_d->selectAllFromTableChildrenPositions();
+        } else if (auto cols = m_tableNames.find(tableName);
+                   cols != m_tableNames.end() &&
+                   std::find(cols->second.begin(), cols->second.end(), "id") == cols->second.end()) {
+            stmt = m_d->selectAllFromTableSortBy(tableName, "rowid");
+        } else {
+            stmt = m_d->selectAllFromTable(tableName);
+        }
+        const int ctotal = sqlite3_column_count(stmt);
+        std::vector<std::string> columnNames{};
+        for (int i = 0; i < ctotal; ++i) {
+            columnNames.emplace_back(sqlite3_column_name(stmt, i));
+        }
+        writer.beginTable(tableName, columnNames);
+        int res = 0;
+        while ((res = sqlite3_step(stmt)) == SQLITE_ROW) {
+            for (int i = 0; i < ctotal; ++i) {
+                const int datacode = sqlite3_column_type(stmt, i);
+                if (SQLiteColumnTypes::INT_TYPE == datacode) {
+                    writer.addInt(sqlite3_column_int(stmt, i));
+                } else if (SQLiteColumnTypes::FLOAT_TYPE == datacode) {
+                    writer.addDouble(sqlite3_column_double(stmt, i));
+                } else if (SQLiteColumnTypes::TEXT_TYPE == datacode) {
+                    const char* cc = (char*)sqlite3_column_text(stmt, i);
+                    writer.addText(cc ? std::string_view{cc} : std::string_view{"NULL"});
+                } else if (SQLiteColumnTypes::NULL_TYPE == datacode) {
+                    writer.addNull();
+                } else {
+                    sqlite3_finalize(stmt);
+                    THROW_EXCEPTION("ERROR!!! The 'BLOB' data format is not supported in snapshots! Table: '" << tableName << "'");
+                }
+            }
+        }
+        if (res != SQLITE_DONE) {
+            std::string errmsg(sqlite3_errmsg(m_d->m_dbSqlite));
+            sqlite3_finalize(stmt);
+            THROW_EXCEPTION(errmsg);
+        }
+        sqlite3_finalize(stmt);
+        writer.endTable();
+    }
+    writer.write(path);
+    if (m_loglevel > 0) {
+        std::cout << "GeoModelDBManager -- The snapshot of '" << m_dbpath
+                  << "' has been written to '" << path << "'" << std::endl;
+    }
+}
+
 // FIXME: TODO: move to an utility class
 int lastIndexOf(std::vector<std::string> v, const std::string& str, int pos = 0) {
     auto it = std::find(std::next(v.rbegin(), v.size() - pos), v.rend(), str);
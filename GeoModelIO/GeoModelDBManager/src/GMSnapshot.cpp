@@ -0,0 +1,334 @@
+// Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+
+#include "GeoModelDBManager/GMSnapshot.h"
+
+#include "GeoModelKernel/throwExcept.h"
+
+#include <cstring>
+#include <fstream>
+
+// POSIX includes, to map the file in memory
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+    constexpr char snapshotMagic[8] = {'G', 'M', 'S', 'N', 'A', 'P', 'S', 'H'};
+    constexpr std::uint32_t byteOrderMark = 0x01020304;
+
+    constexpr std::uint64_t align8(std::uint64_t offset) { return (offset + 7) & ~std::uint64_t{7}; }
+
+    std::uint64_t cellSize(GMSnapshot::ColumnType type) {
+        switch (type) {
+            case GMSnapshot::ColumnType::Int: return sizeof(std::int32_t);
+            case GMSnapshot::ColumnType::Double: return sizeof(double);
+            case GMSnapshot::ColumnType::Text: return sizeof(GMSnapshot::TextRef);
+            case GMSnapshot::ColumnType::Mixed: return sizeof(GMSnapshot::MixedCell);
+            default: return 0;
+        }
+    }
+
+    void writePadding(std::ofstream& out, std::uint64_t& pos) {
+        static constexpr char zeros[8] = {};
+        const std::uint64_t aligned = align8(pos);
+        out.write(zeros, aligned - pos);
+        pos = aligned;
+    }
+    template <class T>
+    void writeArray(std::ofstream& out, std::uint64_t& pos, const std::vector<T>& items) {
+        out.write(reinterpret_cast<const char*>(items.data()), items.size() * sizeof(T));
+        pos += items.size() * sizeof(T);
+    }
+}  // namespace
+
+//----------------------------------------
+// reader
+
+GMSnapshot::GMSnapshot(const std::string& path) : m_path(path) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        THROW_EXCEPTION("ERROR! Cannot open the snapshot file '" << path << "'!");
+    }
+    struct stat info {};
+    if (::fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(FileHeader))) {
+        ::close(fd);
+        THROW_EXCEPTION("ERROR! The file '" << path << "' is too small to be a GeoModel snapshot!");
+    }
+    m_size = info.st_size;
+    void* mapped = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        THROW_EXCEPTION("ERROR! Cannot map the snapshot file '" << path << "' in memory!");
+    }
+    m_data = static_cast<const char*>(mapped);
+
+    // check the header, and that all the sections lie within the file
+    const FileHeader* header = reinterpret_cast<const FileHeader*>(m_data);
+    auto inFile = [this](std::uint64_t offset, std::uint64_t size) {
+        return offset <= m_size && size <= m_size - offset;
+    };
+    std::string error{};
+    if (std::memcmp(header->magic, snapshotMagic, sizeof(snapshotMagic)) != 0) {
+        error = "not a GeoModel snapshot";
+    } else if (header->byteOrder != byteOrderMark) {
+        error = "written on a platform with a different byte order";
+    } else if (header->version != formatVersion) {
+        error = "unsupported format version " + std::to_string(header->version) +
+                " (expected " + std::to_string(formatVersion) + ")";
+    } else if (header->fileSize != m_size || !inFile(header->stringsOffset, header->stringsSize) ||
+               header->nTables > m_size / sizeof(TableRecord) ||
+               !inFile(header->tablesOffset, header->nTables * sizeof(TableRecord))) {
+        error = "the file is truncated or corrupted";
+    }
+    m_strings = m_data + header->stringsOffset;
+    auto inStrings = [header](std::uint64_t offset, std::uint64_t size) {
+        return offset <= header->stringsSize && size <= header->stringsSize - offset;
+    };
+
+    const TableRecord* records = reinterpret_cast<const TableRecord*>(m_data + header->tablesOffset);
+    for (std::uint64_t t = 0; error.empty() && t < header->nTables; ++t) {
+        const TableRecord& record = records[t];
+        if (!inStrings(record.nameOffset, record.nameSize) ||
+            record.nColumns > m_size / sizeof(ColumnRecord) ||
+            !inFile(record.columnsOffset, record.nColumns * sizeof(ColumnRecord))) {
+            error = "the table directory is corrupted";
+            break;
+        }
+        const ColumnRecord* columns = reinterpret_cast<const ColumnRecord*>(m_data + record.columnsOffset);
+        for (std::uint64_t c = 0; error.empty() && c < record.nColumns; ++c) {
+            const ColumnRecord& column = columns[c];
+            const std::uint64_t size = cellSize(column.type);
+            if (!inStrings(column.nameOffset, column.nameSize) ||
+                (column.type != ColumnType::Empty && !size) ||
+                (size && record.nRows > m_size / size) ||
+                !inFile(column.dataOffset, record.nRows * size)) {
+                error = "the column directory of the table '" +
+                        std::string{string(record.nameOffset, record.nameSize)} + "' is corrupted";
+            }
+        }
+        m_tables.push_back(Table{this, &record, columns});
+    }
+    // the text cells are the only ones pointing outside of their column
+    for (const Table& table : m_tables) {
+        for (std::size_t c = 0; error.empty() && c < table.nColumns(); ++c) {
+            const ColumnType type = table.columnType(c);
+            for (std::size_t r = 0; error.empty() && r < table.nRows(); ++r) {
+                const TextRef* ref = nullptr;
+                if (type == ColumnType::Text) {
+                    ref = &table.data<TextRef>(c)[r];
+                } else if (type == ColumnType::Mixed && table.mixed(r, c).type == CellType::Text) {
+                    ref = &table.mixed(r, c).text;
+                }
+                if (ref && !inStrings(ref->offset, ref->size)) {
+                    error = "a text cell of the table '" + std::string{table.name()} + "' is corrupted";
+                }
+            }
+        }
+    }
+    if (!error.empty()) {
+        ::munmap(const_cast<char*>(m_data), m_size);
+        m_data = nullptr;
+        THROW_EXCEPTION("ERROR! Cannot read the snapshot file '" << path << "': " << error << "!");
+    }
+    for (std::size_t t = 0; t < m_tables.size(); ++t) {
+        m_tableIndex.emplace(m_tables[t].name(), t);
+    }
+}
+
+GMSnapshot::~GMSnapshot() {
+    if (m_data) ::munmap(const_cast<char*>(m_data), m_size);
+}
+
+bool GMSnapshot::isSnapshotFile(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    char magic[sizeof(snapshotMagic)] = {};
+    if (!in.read(magic, sizeof(magic))) return false;
+    return std::memcmp(magic, snapshotMagic, sizeof(magic)) == 0;
+}
+
+const GMSnapshot::Table* GMSnapshot::findTable(std::string_view name) const {
+    auto it = m_tableIndex.find(name);
+    return it != m_tableIndex.end() ? &m_tables[it->second] : nullptr;
+}
+
+const GMSnapshot::MixedCell& GMSnapshot::Table::mixed(std::size_t row, std::size_t col, CellType type) const {
+    if (m_columns[col].type != ColumnType::Mixed || mixed(row, col).type != type) {
+        THROW_EXCEPTION("ERROR! The cell (" << row << ", " << col << ") of the snapshot table '" << name()
+                        << "' has not the requested type!");
+    }
+    return mixed(row, col);
+}
+
+//----------------------------------------
+// writer
+
+GMSnapshot::TextRef GMSnapshot::Writer::intern(std::string_view value) {
+    auto it = m_stringIndex.find(std::string{value});
+    if (it != m_stringIndex.end()) return it->second;
+    const TextRef ref{m_strings.size(), value.size()};
+    m_strings.append(value);
+    m_stringIndex.emplace(std::string{value}, ref);
+    return ref;
+}
+
+void GMSnapshot::Writer::beginTable(std::string_view name, const std::vector<std::string>& columnNames) {
+    PendingTable table{};
+    table.name = intern(name);
+    for (const std::string& column : columnNames) {
+        table.columnNames.push_back(intern(column));
+    }
+    table.columns.resize(columnNames.size());
+    m_tables.push_back(std::move(table));
+    m_nCells = 0;
+}
+
+GMSnapshot::Writer::Cell& GMSnapshot::Writer::nextCell() {
+    if (m_tables.empty() || m_tables.back().columns.empty()) {
+        THROW_EXCEPTION("ERROR! No table with columns has been started in the snapshot writer!");
+    }
+    std::vector<std::vector<Cell>>& columns = m_tables.back().columns;
+    return columns[m_nCells++ % columns.size()].emplace_back();
+}
+
+void GMSnapshot::Writer::addNull() { nextCell(); }
+void GMSnapshot::Writer::addInt(int value) {
+    Cell& cell = nextCell();
+    cell.type = CellType::Int;
+    cell.intValue = value;
+}
+void GMSnapshot::Writer::addDouble(double value) {
+    Cell& cell = nextCell();
+    cell.type = CellType::Double;
+    cell.doubleValue = value;
+}
+void GMSnapshot::Writer::addText(std::string_view value) {
+    Cell& cell = nextCell();
+    cell.type = CellType::Text;
+    cell.text = intern(value);
+}
+
+void GMSnapshot::Writer::endTable() {
+    if (m_tables.empty()) return;
+    const std::vector<std::vector<Cell>>& columns = m_tables.back().columns;
+    if (!columns.empty() && m_nCells % columns.size()) {
+        THROW_EXCEPTION("ERROR! The last row of the snapshot table is incomplete!");
+    }
+}
+
+void GMSnapshot::Writer::write(const std::string& path) const {
+    // the type of each column: typed storage if all cells have the same type
+    std::vector<std::vector<ColumnType>> types(m_tables.size());
+    for (std::size_t t = 0; t < m_tables.size(); ++t) {
+        for (const std::vector<Cell>& column : m_tables[t].columns) {
+            ColumnType type{ColumnType::Empty};
+            if (!column.empty()) {
+                const CellType first = column.front().type;
+                bool uniform = (first != CellType::Null);
+                for (const Cell& cell : column) {
+                    if (cell.type != first) {
+                        uniform = false;
+                        break;
+                    }
+                }
+                type = uniform ? static_cast<ColumnType>(first) : ColumnType::Mixed;
+            }
+            types[t].push_back(type);
+        }
+    }
+
+    // compute the layout of the file
+    FileHeader header{};
+    std::memcpy(header.magic, snapshotMagic, sizeof(snapshotMagic));
+    header.version = formatVersion;
+    header.byteOrder = byteOrderMark;
+    header.nTables = m_tables.size();
+    header.tablesOffset = align8(sizeof(FileHeader));
+    std::uint64_t pos = header.tablesOffset + m_tables.size() * sizeof(TableRecord);
+
+    std::vector<TableRecord> tableRecords{};
+    std::vector<ColumnRecord> columnRecords{};
+    for (std::size_t t = 0; t < m_tables.size(); ++t) {
+        const PendingTable& table = m_tables[t];
+        TableRecord record{};
+        record.nameOffset = table.name.offset;
+        record.nameSize = table.name.size;
+        record.nColumns = table.columns.size();
+        record.nRows = table.columns.empty() ? 0 : table.columns.front().size();
+        record.columnsOffset = pos;
+        pos += table.columns.size() * sizeof(ColumnRecord);
+        tableRecords.push_back(record);
+    }
+    for (std::size_t t = 0; t < m_tables.size(); ++t) {
+        const PendingTable& table = m_tables[t];
+        for (std::size_t c = 0; c < table.columns.size(); ++c) {
+            pos = align8(pos);
+            ColumnRecord record{};
+            record.nameOffset = table.columnNames[c].offset;
+            record.nameSize = table.columnNames[c].size;
+            record.type = types[t][c];
+            record.dataOffset = pos;
+            pos += table.columns[c].size() * cellSize(record.type);
+            columnRecords.push_back(record);
+        }
+    }
+    header.stringsOffset = align8(pos);
+    header.stringsSize = m_strings.size();
+    header.fileSize = header.stringsOffset + header.stringsSize;
+
+    // write all the sections, in the same order
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        THROW_EXCEPTION("ERROR! Cannot create the snapshot file '" << path << "'!");
+    }
+    pos = 0;
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    pos += sizeof(header);
+    writePadding(out, pos);
+    writeArray(out, pos, tableRecords);
+    writeArray(out, pos, columnRecords);
+    std::size_t columnIndex = 0;
+    for (const PendingTable& table : m_tables) {
+        for (const std::vector<Cell>& column : table.columns) {
+            writePadding(out, pos);
+            switch (columnRecords[columnIndex++].type) {
+                case ColumnType::Int: {
+                    std::vector<std::int32_t> values{};
+                    values.reserve(column.size());
+                    for (const Cell& cell : column) values.push_back(cell.intValue);
+                    writeArray(out, pos, values);
+                    break;
+                }
+                case ColumnType::Double: {
+                    std::vector<double> values{};
+                    values.reserve(column.size());
+                    for (const Cell& cell : column) values.push_back(cell.doubleValue);
+                    writeArray(out, pos, values);
+                    break;
+                }
+                case ColumnType::Text: {
+                    std::vector<TextRef> values{};
+                    values.reserve(column.size());
+                    for (const Cell& cell : column) values.push_back(cell.text);
+                    writeArray(out, pos, values);
+                    break;
+                }
+                case ColumnType::Mixed: {
+                    std::vector<MixedCell> values{};
+                    values.reserve(column.size());
+                    for (const Cell& cell : column) {
+                        values.push_back(MixedCell{cell.type, cell.intValue, cell.doubleValue, cell.text});
+                    }
+                    writeArray(out, pos, values);
+                    break;
+                }
+                default: break;
+            }
+        }
+    }
+    writePadding(out, pos);
+    out.write(m_strings.data(), m_strings.size());
+    if (!out) {
+        THROW_EXCEPTION("ERROR! Cannot write the snapshot file '" << path << "'!");
+    }
+}
@@ -0,0 +1,91 @@
+// Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+
+/*
+ * This test fills a table of a GeoModel .db file with the same records
+ * through the text query and through the prepared statements,
+ * it compares the two, printing the time taken by each,
+ * then it deletes the file.
+ *
+ */
+
+
+// GeoModel includes
+#include "GeoModelDBManager/GMDBManager.h"
+// c++ includes
+#include <chrono>
+#include <cmath>
+#include <fstream>
+
+// Fill the 'Shapes_Box' table with 'records' and return the time taken, in ms
+double fillBoxTable(GMDBManager& db, const DBRowsList& records, bool bulkInsert)
+{
+    db.execQuery("DELETE FROM Shapes_Box;");
+    db.setBulkInsert(bulkInsert);
+    const auto start = std::chrono::steady_clock::now();
+    db.addListOfRecords("GeoBox", records);
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+
+int main()
+{
+    std::string path = "test_bulk_insert.db";
+
+    std::ifstream infile(path.c_str());
+    if ( infile.good() ) {
+        std::cout << "\n\tERROR!! A '" << path << "' file exists already!! Please, remove, move, or rename it before running this program. Exiting...";
+        exit(EXIT_FAILURE);
+    }
+    infile.close();
+
+    // open the DB connection
+    GMDBManager db(path);
+    if (!db.checkIsDBOpen()) {
+        std::cout << "Database ERROR!! Exiting..." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    // create the tables and fill one of them with both insertion methods
+    db.initDB();
+    const unsigned int nRecords = 100000;
+    DBRowsList records;
+    records.reserve(nRecords);
+    for (unsigned int i = 0; i < nRecords; ++i) {
+        records.push_back({1000. + i, 10. + i / 3., 20. + i / 7., 30. + i / 11.});
+    }
+    const double msText = fillBoxTable(db, records, false);
+    const DBRowsList textRows = db.getTableRecords_VecVecData("Shapes_Box");
+    const double msBulk = fillBoxTable(db, records, true);
+    const DBRowsList bulkRows = db.getTableRecords_VecVecData("Shapes_Box");
+    std::cout << "Inserted " << nRecords << " records in " << msText
+              << " ms with the text query, in " << msBulk
+              << " ms with the prepared statements." << std::endl;
+
+    if (textRows.size() != nRecords || bulkRows.size() != nRecords) {
+        std::cout << "ERROR!! Wrong number of records in the DB: " << textRows.size()
+                  << " (text), " << bulkRows.size() << " (bulk). Exiting..." << std::endl;
+        std::remove(path.c_str());
+        exit(EXIT_FAILURE);
+    }
+    for (unsigned int i = 0; i < nRecords; ++i) {
+        for (unsigned int col = 0; col < textRows[i].size(); ++col) {
+            // compare with the precision used to write numbers as text
+            const double textVal = std::holds_alternative<double>(textRows[i][col]) ?
+                std::get<double>(textRows[i][col]) : std::get<int>(textRows[i][col]);
+            const double bulkVal = std::holds_alternative<double>(bulkRows[i][col]) ?
+                std::get<double>(bulkRows[i][col]) : std::get<int>(bulkRows[i][col]);
+            if (std::abs(textVal - bulkVal) > 1.e-12 * std::abs(textVal)) {
+                std::cout << "ERROR!! Records differ at row " << i << ", column " << col
+                          << ": " << textVal << " vs. " << bulkVal << ". Exiting..." << std::endl;
+                std::remove(path.c_str());
+                exit(EXIT_FAILURE);
+            }
+        }
+    }
+
+    std::remove(path.c_str());  // delete file
+    std::cout << "OK, the records inserted with the prepared statements are the same.\n";
+
+    return 0;
+}
@@ -0,0 +1,80 @@
+// Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+
+/*
+ * This test fills a table of a GeoModel .db file, then it checks that
+ * the columnar read of the table (DBTable) returns the same records
+ * as the row-by-row one, then it deletes the file.
+ *
+ */
+
+
+// GeoModel includes
+#include "GeoModelDBManager/GMDBManager.h"
+// c++ includes
+#include <fstream>
+
+
+int main()
+{
+    std::string path = "test_db_table.db";
+
+    std::ifstream infile(path.c_str());
+    if ( infile.good() ) {
+        std::cout << "\n\tERROR!! A '" << path << "' file exists already!! Please, remove, move, or rename it before running this program. Exiting...";
+        exit(EXIT_FAILURE);
+    }
+    infile.close();
+
+    // open the DB connection
+    GMDBManager db(path);
+    if (!db.checkIsDBOpen()) {
+        std::cout << "Database ERROR!! Exiting..." << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    // create the tables and fill one of them
+    db.initDB();
+    const unsigned int nRecords = 10000;
+    DBRowsList records;
+    records.reserve(nRecords);
+    for (unsigned int i = 0; i < nRecords; ++i) {
+        records.push_back({1000. + i, 10. + i / 3., 20. + i / 7., 30. + i / 11.});
+    }
+    db.addListOfRecords("GeoBox", records);
+    const DBRowsList rows = db.getTableRecords_VecVecData("Shapes_Box");
+    if (rows.size() != nRecords) {
+        std::cout << "ERROR!! Wrong number of records in the DB: " << rows.size() << ". Exiting..." << std::endl;
+        std::remove(path.c_str());
+        exit(EXIT_FAILURE);
+    }
+
+    // the columnar read must return the same records
+    const DBTable columns = db.getTableRecords_Columns("Shapes_Box");
+    if (columns.size() != nRecords || columns.nColumns() != rows[0].size()) {
+        std::cout << "ERROR!! Wrong size of the columnar table: " << columns.size() << " x "
+                  << columns.nColumns() << ". Exiting..." << std::endl;
+        std::remove(path.c_str());
+        exit(EXIT_FAILURE);
+    }
+    for (unsigned int i = 0; i < nRecords; ++i) {
+        for (unsigned int col = 0; col < columns.nColumns(); ++col) {
+            if (columns.getRecord(i, col) != rows[i][col]) {
+                std::cout << "ERROR!! The columnar table differs at row " << i << ", column " << col
+                          << ". Exiting..." << std::endl;
+                std::remove(path.c_str());
+                exit(EXIT_FAILURE);
+            }
+        }
+    }
+    if (columns.getInt(nRecords - 1, 0) != int(nRecords) ||
+        columns.getDouble(nRecords - 1, 2) != std::get<double>(rows[nRecords - 1][2])) {
+        std::cout << "ERROR!! Wrong values from the typed accessors of the columnar table. Exiting..." << std::endl;
+        std::remove(path.c_str());
+        exit(EXIT_FAILURE);
+    }
+
+    std::remove(path.c_str());  // delete file
+    std::cout << "OK, the columnar table holds the same records.\n";
+
+    return 0;
+}
@@ -79,7 +79,9 @@ class IO {
         return db;
     }
 
-    static const GeoVPhysVol* loadDB(const std::string path, unsigned loglevel = 0) {
+    /// If 'lazy' is true, only the root volume is built; the other volumes
+    /// are built when they are first accessed (see ReadGeoModel::buildGeoModelLazy())
+    static const GeoVPhysVol* loadDB(const std::string path, unsigned loglevel = 0, bool lazy = false) {
         // check if DB file exists. 
         // If not, print a warning message and return a nullptr.
         std::ifstream inputfile(path.c_str());
@@ -103,6 +105,13 @@ class IO {
             THROW_EXCEPTION("It was not possible to open the DB correctly!");
         }
 
+        if (lazy) {
+            // the tables are read upfront, so the DB can be closed right away
+            const GeoVPhysVol* rootVolume = GeoModelIO::ReadGeoModel::buildGeoModelLazy(db, loglevel);
+            delete db;
+            return rootVolume;
+        }
+
         /* setup the GeoModel reader */
         GeoModelIO::ReadGeoModel geoReader = GeoModelIO::ReadGeoModel(db);
         // set loglevel of read action, if > 0
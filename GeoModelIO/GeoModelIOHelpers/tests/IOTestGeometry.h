@@ -0,0 +1,108 @@
+// Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+
+/*
+ * Test geometry and tree comparison shared by the I/O tests that read
+ * a geometry back in two different ways and compare the results.
+ *
+ */
+
+#ifndef GEOMODELIOHELPERS_IOTESTGEOMETRY_H
+#define GEOMODELIOHELPERS_IOTESTGEOMETRY_H
+
+// GeoModel includes
+#include "GeoGenericFunctions/Variable.h"
+#include "GeoModelKernel/GeoBox.h"
+#include "GeoModelKernel/GeoFullPhysVol.h"
+#include "GeoModelKernel/GeoNameTag.h"
+#include "GeoModelKernel/GeoPcon.h"
+#include "GeoModelKernel/GeoPhysVol.h"
+#include "GeoModelKernel/GeoSerialDenominator.h"
+#include "GeoModelKernel/GeoSerialTransformer.h"
+#include "GeoModelKernel/GeoShapeSubtraction.h"
+#include "GeoModelKernel/GeoTransform.h"
+#include "GeoModelKernel/GeoTube.h"
+#include "GeoModelHelpers/defineWorld.h"
+
+// C++ includes
+#include <iostream>
+#include <string>
+
+namespace IOTestGeometry {
+
+    /// A small geometry with several shape types: a container made out of a
+    /// boolean shape holds a full physical volume with a Pcon shape, 10 tubes
+    /// sharing their material and a serial transformer of 8 plates.
+    inline GeoIntrusivePtr<GeoPhysVol> createGeometry() {
+        GeoIntrusivePtr<GeoPhysVol> world{createGeoWorld()};
+
+        GeoMaterial* iron = new GeoMaterial("Iron", 7.87);
+        iron->add(new GeoElement("Iron", "Fe", 26.0, 55.847), 1.0);
+        iron->lock();
+        GeoMaterial* air = new GeoMaterial("Air", 0.0012);
+        air->add(new GeoElement("Nitrogen", "N", 7.0, 14.0067), 0.8);
+        air->add(new GeoElement("Oxygen", "O", 8.0, 15.9994), 0.2);
+        air->lock();
+
+        // a container, made out of a boolean shape
+        const GeoShape* container = new GeoShapeSubtraction(new GeoBox(500., 500., 500.), new GeoTube(0., 50., 600.));
+        GeoPhysVol* containerPhys = new GeoPhysVol(new GeoLogVol("Container", container, air));
+        world->add(new GeoNameTag("Container"));
+        world->add(containerPhys);
+
+        // a few volumes with different shapes
+        GeoPcon* pcon = new GeoPcon(0., 2. * M_PI);
+        pcon->addPlane(-100., 60., 120.);
+        pcon->addPlane(0., 70., 110.);
+        pcon->addPlane(100., 60., 120.);
+        GeoFullPhysVol* pconPhys = new GeoFullPhysVol(new GeoLogVol("Pcon", pcon, iron));
+        containerPhys->add(new GeoNameTag("Pcon"));
+        containerPhys->add(new GeoTransform(GeoTrf::TranslateZ3D(-300.)));
+        containerPhys->add(pconPhys);
+        for (unsigned int k = 0; k < 10; ++k) {
+            containerPhys->add(new GeoNameTag("Tube_" + std::to_string(k)));
+            containerPhys->add(new GeoTransform(GeoTrf::TranslateX3D(-400. + 80. * k) * GeoTrf::RotateX3D(0.1 * k)));
+            containerPhys->add(new GeoPhysVol(new GeoLogVol("Tube", new GeoTube(5., 10. + k, 30.), iron)));
+        }
+
+        // a serial transformer
+        GeoGenfun::Variable i;
+        GeoXF::TRANSFUNCTION placement = GeoXF::Pow(GeoTrf::TranslateY3D(1.0), 40. * i) * GeoTrf::TranslateZ3D(300.);
+        GeoPhysVol* platePhys = new GeoPhysVol(new GeoLogVol("Plate", new GeoBox(10., 10., 1.), iron));
+        containerPhys->add(new GeoSerialDenominator("Plate_"));
+        containerPhys->add(new GeoSerialTransformer(platePhys, &placement, 8));
+        return world;
+    }
+
+    /// Compares the volumes, materials, shape types and placements of two trees;
+    /// the first mismatch is reported with 'testName' and the labels of the trees.
+    inline bool compareTrees(const GeoVPhysVol* a, const GeoVPhysVol* b, const std::string& path,
+                             const std::string& testName, const std::string& labelA, const std::string& labelB) {
+        const GeoLogVol* logA = a->getLogVol();
+        const GeoLogVol* logB = b->getLogVol();
+        if (logA->getName() != logB->getName() ||
+            logA->getMaterial()->getName() != logB->getMaterial()->getName() ||
+            logA->getMaterial()->getDensity() != logB->getMaterial()->getDensity() ||
+            logA->getShape()->type() != logB->getShape()->type()) {
+            std::cerr << testName << " -- ERROR: LogVol mismatch for volume " << path << std::endl;
+            return false;
+        }
+        if (a->getNChildVols() != b->getNChildVols()) {
+            std::cerr << testName << " -- ERROR: wrong number of children for volume " << path << ", "
+                      << a->getNChildVols() << " (" << labelA << ") vs. "
+                      << b->getNChildVols() << " (" << labelB << ")" << std::endl;
+            return false;
+        }
+        for (unsigned int k = 0; k < a->getNChildVols(); ++k) {
+            const std::string childPath = path + "/" + a->getNameOfChildVol(k);
+            if (a->getNameOfChildVol(k) != b->getNameOfChildVol(k) ||
+                !a->getXToChildVol(k).isApprox(b->getXToChildVol(k))) {
+                std::cerr << testName << " -- ERROR: Placement mismatch for volume " << childPath << std::endl;
+                return false;
+            }
+            if (!compareTrees(a->getChildVol(k), b->getChildVol(k), childPath, testName, labelA, labelB)) return false;
+        }
+        return true;
+    }
+}
+
+#endif
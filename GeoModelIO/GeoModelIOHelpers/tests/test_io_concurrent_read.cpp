@@ -0,0 +1,94 @@
+// Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+
+/*
+ * This test checks that the concurrent build of the GeoModel nodes
+ * gives the same tree as the serial one.
+ *
+ * It creates a world volume with several thousands of daughter volumes,
+ * each one with its own Box shape and LogVol, so that the largest tables
+ * are split in chunks of rows built by different threads.
+ * Then, it reads the tree back from the DB, serially and with several threads,
+ * and it compares the two trees.
+ *
+ */
+
+// GeoModel includes
+#include "GeoModelDBManager/GMDBManager.h"
+#include "GeoModelIOHelpers/GMIO.h"
+#include "GeoModelKernel/GeoBox.h"
+#include "GeoModelKernel/GeoNameTag.h"
+#include "GeoModelKernel/GeoPhysVol.h"
+#include "GeoModelKernel/GeoTransform.h"
+#include "GeoModelHelpers/defineWorld.h"
+
+// C++ includes
+#include <cmath>
+#include <cstdlib>  // EXIT_FAILURE, setenv
+#include <iostream>
+
+namespace {
+    const GeoVPhysVol* readWithThreads(const std::string& path, const std::string& nThreads) {
+        setenv("GEOMODEL_ENV_IO_NTHREADS", nThreads.c_str(), 1);
+        return GeoModelIO::IO::loadDB(path);
+    }
+}
+
+int main() {
+    GeoIntrusivePtr<GeoPhysVol> world{createGeoWorld()};
+
+    GeoMaterial* iron = new GeoMaterial("Iron", 7.87);
+    iron->add(new GeoElement("Iron", "Fe", 26.0, 55.847), 1.0);
+    iron->lock();
+
+    constexpr unsigned int nVolumes = 5000;
+    for (unsigned int k = 0; k < nVolumes; ++k) {
+        const double size = 1. + 0.001 * k;
+        GeoLogVol* logVol = new GeoLogVol("Box_" + std::to_string(k), new GeoBox(size, 2. * size, 3. * size), iron);
+        world->add(new GeoNameTag("Volume_" + std::to_string(k)));
+        world->add(new GeoTransform(GeoTrf::TranslateX3D(10. * k)));
+        world->add(new GeoPhysVol(logVol));
+    }
+
+    const std::string path = "test_io_concurrent_read.db";
+    GeoModelIO::IO::saveToDB(world, path, 0, true);
+
+    GeoIntrusivePtr<const GeoVPhysVol> serial{readWithThreads(path, "0")};
+    GeoIntrusivePtr<const GeoVPhysVol> concurrent{readWithThreads(path, "4")};
+    if (!serial || !concurrent) {
+        std::cerr << "test_io_concurrent_read -- ERROR: the geometry could not be read back!" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (serial->getNChildVols() != nVolumes || concurrent->getNChildVols() != nVolumes) {
+        std::cerr << "test_io_concurrent_read -- ERROR: wrong number of children, "
+                  << serial->getNChildVols() << " (serial) vs. " << concurrent->getNChildVols()
+                  << " (concurrent), expected " << nVolumes << std::endl;
+        return EXIT_FAILURE;
+    }
+    for (unsigned int k = 0; k < nVolumes; ++k) {
+        const GeoLogVol* serialLog = serial->getChildVol(k)->getLogVol();
+        const GeoLogVol* concurrentLog = concurrent->getChildVol(k)->getLogVol();
+        const GeoBox* serialBox = dynamic_cast<const GeoBox*>(serialLog->getShape());
+        const GeoBox* concurrentBox = dynamic_cast<const GeoBox*>(concurrentLog->getShape());
+        if (serialLog->getName() != concurrentLog->getName() ||
+            serialLog->getName() != "Box_" + std::to_string(k)) {
+            std::cerr << "test_io_concurrent_read -- ERROR: LogVol mismatch for child " << k << std::endl;
+            return EXIT_FAILURE;
+        }
+        if (!serialBox || !concurrentBox ||
+            serialBox->getXHalfLength() != concurrentBox->getXHalfLength() ||
+            serialBox->getYHalfLength() != concurrentBox->getYHalfLength() ||
+            serialBox->getZHalfLength() != concurrentBox->getZHalfLength() ||
+            std::abs(serialBox->getXHalfLength() - (1. + 0.001 * k)) > 1.e-9) {
+            std::cerr << "test_io_concurrent_read -- ERROR: Shape mismatch for child " << k << std::endl;
+            return EXIT_FAILURE;
+        }
+        if (serial->getNameOfChildVol(k) != concurrent->getNameOfChildVol(k) ||
+            !serial->getXToChildVol(k).isApprox(concurrent->getXToChildVol(k))) {
+            std::cerr << "test_io_concurrent_read -- ERROR: Placement mismatch for child " << k << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    std::cout << "test_io_concurrent_read -- OK: the serial and the concurrent reads agree." << std::endl;
+    return 0;
+}
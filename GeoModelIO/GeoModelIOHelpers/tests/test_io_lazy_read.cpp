@@ -0,0 +1,68 @@
+// Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+
+/*
+ * This test checks the on-demand loading of the geometry tree.
+ *
+ * It creates a small geometry with several shape types, a boolean shape,
+ * a serial transformer and a full physical volume, and it saves it to a .db file.
+ * Then, it reads back the geometry both in the standard way and lazily,
+ * it compares the two trees, and it checks that the nodes shared in the
+ * original tree are shared in the lazy one as well.
+ *
+ */
+
+// GeoModel includes
+#include "GeoModelDBManager/GMDBManager.h"
+#include "GeoModelIOHelpers/GMIO.h"
+#include "IOTestGeometry.h"
+
+// C++ includes
+#include <cstdlib>  // EXIT_FAILURE
+#include <iostream>
+
+int main() {
+    GeoIntrusivePtr<GeoPhysVol> world{IOTestGeometry::createGeometry()};
+
+    const std::string dbPath = "test_io_lazy_read.db";
+    GeoModelIO::IO::saveToDB(world, dbPath, 0, true);
+
+    GeoIntrusivePtr<const GeoVPhysVol> eager{GeoModelIO::IO::loadDB(dbPath)};
+    GeoIntrusivePtr<const GeoVPhysVol> lazy{GeoModelIO::IO::loadDB(dbPath, 0, true)};
+    if (!eager || !lazy) {
+        std::cerr << "test_io_lazy_read -- ERROR: the geometry could not be read back!" << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (!IOTestGeometry::compareTrees(eager, lazy, "World", "test_io_lazy_read", "eager", "lazy")) return EXIT_FAILURE;
+
+    // the tubes share the same material, and they must do so in the lazy tree too
+    const GeoVPhysVol* lazyContainer = lazy->getChildVol(0);
+    if (lazyContainer->getChildVol(1)->getLogVol()->getMaterial() !=
+        lazyContainer->getChildVol(2)->getLogVol()->getMaterial()) {
+        std::cerr << "test_io_lazy_read -- ERROR: the shared material has been built twice!" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // a subtree can outlive its root, and it can still be expanded
+    GeoIntrusivePtr<const GeoVPhysVol> subtree{GeoModelIO::IO::loadDB(dbPath, 0, true)};
+    subtree = subtree->getChildVol(0);
+    if (subtree->getNChildVols() != world->getChildVol(0)->getNChildVols()) {
+        std::cerr << "test_io_lazy_read -- ERROR: wrong number of children for the detached subtree!" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // a child added before any access comes after the persisted ones
+    GeoIntrusivePtr<GeoPhysVol> extended{
+        const_cast<GeoPhysVol*>(dynamic_cast<const GeoPhysVol*>(GeoModelIO::IO::loadDB(dbPath, 0, true)))};
+    extended->add(new GeoNameTag("Extra"));
+    extended->add(new GeoPhysVol(world->getChildVol(0)->getLogVol()));
+    const unsigned int nPersisted = world->getNChildVols();
+    if (extended->getNChildVols() != nPersisted + 1 ||
+        extended->getNameOfChildVol(nPersisted) != "Extra" ||
+        extended->getNameOfChildVol(0) != world->getNameOfChildVol(0)) {
+        std::cerr << "test_io_lazy_read -- ERROR: the added child is not after the persisted ones!" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "test_io_lazy_read -- OK: the geometry loaded on demand is the same as the one loaded upfront." << std::endl;
+    return 0;
+}
@@ -0,0 +1,63 @@
+// Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+
+/*
+ * This test checks the round trip through the binary snapshot format.
+ *
+ * It creates a small geometry with several shape types, a boolean shape,
+ * a serial transformer and a full physical volume,
+ * and it saves it to a .db file. Then, it writes the snapshot of the .db file,
+ * it reads back the geometry from both files, and it compares the two trees.
+ *
+ */
+
+// GeoModel includes
+#include "GeoModelDBManager/GMDBManager.h"
+#include "GeoModelIOHelpers/GMIO.h"
+#include "IOTestGeometry.h"
+
+// C++ includes
+#include <cstdlib>  // EXIT_FAILURE
+#include <iostream>
+
+int main() {
+    GeoIntrusivePtr<GeoPhysVol> world{IOTestGeometry::createGeometry()};
+
+    const std::string dbPath = "test_io_snapshot.db";
+    const std::string snapshotPath = "test_io_snapshot.gmsnap";
+    GeoModelIO::IO::saveToDB(world, dbPath, 0, true);
+    {
+        GMDBManager db(dbPath);
+        db.writeSnapshot(snapshotPath);
+    }
+
+    // the tables must be served identically by both files
+    {
+        GMDBManager db(dbPath);
+        GMDBManager snapshot(snapshotPath);
+        if (db.isSnapshot() || !snapshot.isSnapshot()) {
+            std::cerr << "test_io_snapshot -- ERROR: the snapshot file has not been recognized!" << std::endl;
+            return EXIT_FAILURE;
+        }
+        if (GeoModelIO::IO::countNodesFromDB(db) != GeoModelIO::IO::countNodesFromDB(snapshot)) {
+            std::cerr << "test_io_snapshot -- ERROR: the number of nodes in the two files differs!" << std::endl;
+            return EXIT_FAILURE;
+        }
+        for (const std::string table : {"Materials", "Shapes_Pcon_Data", "ChildrenPositions", "Transforms", "RootVolume"}) {
+            if (db.getTableRecords_String(table) != snapshot.getTableRecords_String(table)) {
+                std::cerr << "test_io_snapshot -- ERROR: the table '" << table << "' differs!" << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    GeoIntrusivePtr<const GeoVPhysVol> fromDB{GeoModelIO::IO::loadDB(dbPath)};
+    GeoIntrusivePtr<const GeoVPhysVol> fromSnapshot{GeoModelIO::IO::loadDB(snapshotPath)};
+    if (!fromDB || !fromSnapshot) {
+        std::cerr << "test_io_snapshot -- ERROR: the geometry could not be read back!" << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (!IOTestGeometry::compareTrees(fromDB, fromSnapshot, "World", "test_io_snapshot", "db", "snapshot")) return EXIT_FAILURE;
+
+    std::cout << "test_io_snapshot -- OK: the geometry read from the snapshot is the same as from the DB." << std::endl;
+    return 0;
+}
@@ -40,12 +40,15 @@
 #include "GeoModelKernel/PersistifierFwd.h"
 #include "GeoModelDBManager/GMDBManager.h"
 #include "GeoModelDBManager/definitions.h"
+#include "GeoModelDBManager/DBTable.h"
 
+#include "GeoModelKernel/GeoIntrusivePtr.h"
 #include "GeoModelKernel/GeoXF.h"
 
 // C++ includes
 #include <deque>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <tuple>
@@ -79,6 +82,7 @@ class GeoShapeSubtraction;
 class GeoBox;
 class GeoEllipticalTube;
 
+class BuildGeoShapes;
 class BuildGeoShapes_Box;
 class BuildGeoShapes_EllipticalTube;
 class BuildGeoShapes_Tube;
@@ -119,6 +123,14 @@ class ReadGeoModel {
 
     const GeoVPhysVol* buildGeoModel();
 
+    /// Build the root volume only, and create all the other nodes on demand:
+    /// the daughters of a physical volume are built from the ChildrenPositions
+    /// table the first time they are accessed, together with the shapes,
+    /// materials and logical volumes they need. The tables read from the DB
+    /// are kept in memory until all the volumes of the tree have been deleted;
+    /// the GMDBManager is not used anymore, and it can be closed.
+    static const GeoVPhysVol* buildGeoModelLazy(GMDBManager* db, unsigned loglevel = 0);
+
     /// Set the 'loglevel', that is the level of output messages.
     /// The loglevel is set to 0 by default, but it can be set
     /// to a larger value.
@@ -192,7 +204,10 @@ class ReadGeoModel {
 
    private:
     void buildAllShapes(); // TODO: OLD METHOD, TO BE REMOVED WHEN READY
-    void buildAllShapes_Box();
+    /// The Box shapes and the PhysVols are the largest tables, they are
+    /// prepared first and then built in concurrent chunks of rows
+    void prepareShapes_Box();
+    void buildShapes_Box(size_t firstRow, size_t lastRow);
     void buildAllShapes_EllipticalTube();
     void buildAllShapes_Tube();
     void buildAllShapes_Cons();
@@ -213,7 +228,8 @@ class ReadGeoModel {
     void buildAllElements();
     void buildAllMaterials();
     void buildAllLogVols();
-    void buildAllPhysVols();
+    void preparePhysVols();
+    void buildPhysVols(size_t firstRow, size_t lastRow);
     void buildAllFullPhysVols();
     //  void buildAllFunctions(); // FIXME:
     void buildAllTransforms();
@@ -230,15 +246,34 @@ class ReadGeoModel {
 
     GeoVPhysVol* buildGeoModelPrivate();
 
+    // --- methods for the lazy mode, see buildGeoModelLazy() ---
+    // They build the nodes in any order, hence they use their own caches,
+    // in m_lazy, all protected by the same mutex.
+    class LazyDaughterLoader;
+    void prepareLazyBuild();
+    GeoVPhysVol* buildVPhysVolLazy(const unsigned id, const unsigned tableId,
+                                   const std::shared_ptr<ReadGeoModel>& self);
+    std::vector<GeoIntrusivePtr<GeoGraphNode>> loadDaughtersLazy(const unsigned id, const unsigned tableId,
+                                                                 const std::shared_ptr<ReadGeoModel>& self);
+    void releaseVPhysVolLazy(const unsigned id, const unsigned tableId, const GeoVPhysVol* vol);
+    GeoGraphNode* buildNodeLazy(const std::string& nodeType, const unsigned id,
+                                const std::shared_ptr<ReadGeoModel>& self);
+    GeoLogVol* buildLogVolLazy(const unsigned id);
+    GeoShape* buildShapeLazy(const std::string_view shapeType, const unsigned id);
+    GeoMaterial* buildMaterialLazy(const unsigned id);
+    GeoElement* buildElementLazy(const unsigned id);
+    GeoVSurface* buildVSurfaceLazy(const unsigned id);
+    BuildGeoShapes* getShapeBuilderLazy(const std::string_view shapeType, const DBTable*& shapes);
+
     GeoBox* buildDummyShape();
 
     // void loopOverAllChildrenInBunches_String(); // OLD
     void loopOverAllChildrenInBunches_VecVecData();
     // void loopOverAllChildrenRecords(
     //     std::vector<std::vector<std::string>> records);
-    void loopOverAllChildrenRecords(const DBRowsList& records);
+    void loopOverAllChildrenRecords(const DBTable& records, size_t firstRow, size_t lastRow);
     void processParentChild(const std::vector<std::string>& parentchild);
-    void processParentChild(const DBRowEntry& parentchild);
+    void processParentChild(const DBTable& records, size_t row);
 
     GeoVPhysVol* getRootVolume();
 
@@ -353,11 +388,11 @@ class ReadGeoModel {
     // int id); // TODO: implement this
 
     bool isBuiltPhysVol(const unsigned int id);
-    void storeBuiltPhysVol(GeoPhysVol* nodePtr);
+    void storeBuiltPhysVol(const unsigned int id, GeoPhysVol* nodePtr);
     GeoPhysVol* getBuiltPhysVol(const unsigned int id);
 
     bool isBuiltFullPhysVol(const unsigned int id);
-    void storeBuiltFullPhysVol(GeoFullPhysVol* nodePtr);
+    void storeBuiltFullPhysVol(const unsigned int id, GeoFullPhysVol* nodePtr);
     GeoFullPhysVol* getBuiltFullPhysVol(const unsigned int id);
 
     bool isBuiltSerialDenominator(const unsigned int id);
@@ -442,7 +477,7 @@ class ReadGeoModel {
     DBRowsList m_materials;
     DBRowsList m_materials_Data;
     DBRowsList m_logVols;
-    DBRowsList m_allchildren;
+    DBTable m_allchildren;
 
     // containers to store virtual surfaces
     DBRowsList m_rectangle_surface;  // For Virtual Surface Shape
@@ -452,28 +487,28 @@ class ReadGeoModel {
     DBRowsList m_VSurface;           // For Virtual Surface Abstract Class
 
     // containers to store shapes' parameters
-    DBRowsList m_shapes_Box;
-    DBRowsList m_shapes_EllipticalTube;
-    DBRowsList m_shapes_Tube;
-    DBRowsList m_shapes_Cons;
-    DBRowsList m_shapes_Para;
-    DBRowsList m_shapes_Trap;
-    DBRowsList m_shapes_Trd;
-    DBRowsList m_shapes_Tubs;
-    DBRowsList m_shapes_Torus;
-    DBRowsList m_shapes_TwistedTrap;
-    DBRowsList m_shapes_Pcon;
-    DBRowsList m_shapes_Pgon;
-    DBRowsList m_shapes_SimplePolygonBrep;
-    DBRowsList m_shapes_GenericTrap;
-    DBRowsList m_shapes_UnidentifiedShape;
+    DBTable m_shapes_Box;
+    DBTable m_shapes_EllipticalTube;
+    DBTable m_shapes_Tube;
+    DBTable m_shapes_Cons;
+    DBTable m_shapes_Para;
+    DBTable m_shapes_Trap;
+    DBTable m_shapes_Trd;
+    DBTable m_shapes_Tubs;
+    DBTable m_shapes_Torus;
+    DBTable m_shapes_TwistedTrap;
+    DBTable m_shapes_Pcon;
+    DBTable m_shapes_Pgon;
+    DBTable m_shapes_SimplePolygonBrep;
+    DBTable m_shapes_GenericTrap;
+    DBTable m_shapes_UnidentifiedShape;
     
     // containers to store shapes' data, 
     // for those shapes with a variable number of build parameters
-    DBRowsList m_shapes_Pcon_data;
-    DBRowsList m_shapes_Pgon_data;
-    DBRowsList m_shapes_SimplePolygonBrep_data;
-    DBRowsList m_shapes_GenericTrap_data;
+    DBTable m_shapes_Pcon_data;
+    DBTable m_shapes_Pgon_data;
+    DBTable m_shapes_SimplePolygonBrep_data;
+    DBTable m_shapes_GenericTrap_data;
 
     // containers to store shape operators / boolean shapes
     DBRowsList m_shapes_Shift;
@@ -531,6 +566,10 @@ class ReadGeoModel {
 
     /// Stores the loglevel, the level of output messages
     unsigned m_loglevel;
+
+    //! lazy mode: the caches of the nodes built on demand
+    struct LazyCache;
+    std::shared_ptr<LazyCache> m_lazy;
 };
 
 } /* namespace GeoModelIO */
@@ -20,18 +20,31 @@ BuildGeoShapes::BuildGeoShapes(std::string_view shapeType, const unsigned size)
     m_memMapShapes.reserve(size);
 }
 
-BuildGeoShapes::BuildGeoShapes(std::string_view shapeType, const unsigned size, const DBRowsList& shapeData)
+BuildGeoShapes::BuildGeoShapes(std::string_view shapeType, const unsigned size, const DBTable& shapeData)
 {
     m_shapeType = shapeType;
     m_memMapShapes.reserve(size);
-    m_shape_data = shapeData;
+    m_shape_data = &shapeData;
+}
+
+void BuildGeoShapes::registerShapeIds(const DBTable& shapesData) {
+    for (size_t row = 0; row < shapesData.size(); ++row) {
+        m_memMapShapes.emplace(shapesData.getInt(row, 0, m_shapeType + ":shapeID"), nullptr);
+    }
 }
 
 bool BuildGeoShapes::isBuiltShape(const unsigned id) {
-    return (!(m_memMapShapes.find(id) == m_memMapShapes.end()));
+    auto it = m_memMapShapes.find(id);
+    return (it != m_memMapShapes.end() && it->second);
 }
 void BuildGeoShapes::storeBuiltShape(const unsigned id, GeoShape* nodePtr) {
-    m_memMapShapes[id] = nodePtr;
+    // registered IDs are updated in place, without modifying the map itself
+    auto it = m_memMapShapes.find(id);
+    if (it != m_memMapShapes.end()) {
+        it->second = nodePtr;
+    } else {
+        m_memMapShapes[id] = nodePtr;
+    }
 }
 GeoShape* BuildGeoShapes::getBuiltShape(const unsigned id) {
     if (!m_memMapShapes.size()) return nullptr;
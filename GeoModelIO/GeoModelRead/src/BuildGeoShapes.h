@@ -13,7 +13,7 @@
 #ifndef GEOMODELREAD_BUILDGEOSHAPES_H
 #define GEOMODELREAD_BUILDGEOSHAPES_H
 
-#include "GeoModelDBManager/definitions.h"
+#include "GeoModelDBManager/DBTable.h"
 
 #include <vector>
 #include <variant>
@@ -27,16 +27,22 @@ class BuildGeoShapes
 protected:
   std::unordered_map<unsigned, GeoShape *> m_memMapShapes{};
   std::string m_shapeType;
-  DBRowsList m_shape_data;
+  //! the table with the additional data of the shapes (e.g., the Z planes of Pcon);
+  //! it is owned by the client, and must outlive the builder
+  const DBTable* m_shape_data{nullptr};
 
 public:
   //! contructors
   BuildGeoShapes(std::string_view shapeType, const unsigned size);
-  BuildGeoShapes(std::string_view shapeType, const unsigned size, const DBRowsList& shapesData);
+  BuildGeoShapes(std::string_view shapeType, const unsigned size, const DBTable& shapesData);
 
-  virtual void buildShape(const DBRowEntry row) = 0;
+  //! build the shape stored in the row 'row' of the table 'shapes'
+  virtual void buildShape(const DBTable& shapes, const size_t row) = 0;
 
   // --- methods for caching GeoShape nodes ---
+  //! insert an empty entry for the ID of each row of 'shapesData' (their first column);
+  //! afterwards, the shapes can be stored concurrently
+  void registerShapeIds(const DBTable& shapesData);
   void storeBuiltShape(const unsigned id, GeoShape *nodePtr);
   bool isBuiltShape(const unsigned id);
   GeoShape *getBuiltShape(const unsigned id);
@@ -15,17 +15,17 @@
 #include <vector>
 #include <iostream>
 
-void BuildGeoShapes_Box::buildShape(const DBRowEntry row)
+void BuildGeoShapes_Box::buildShape(const DBTable& shapes, const size_t row)
 {
     // === get shape numeric data from the DB row
     // shape ID
-    const unsigned shapeId = GeoModelHelpers::variantHelper::getFromVariant_Int(row[0], "Box:shapeID");
+    const unsigned shapeId = shapes.getInt(row, 0, "Box:shapeID");
     // shape volume
-    const double shapeVolume = GeoModelHelpers::variantHelper::getFromVariant_Double(row[1], "Box:shapeVolume");
+    const double shapeVolume = shapes.getDouble(row, 1, "Box:shapeVolume");
     // shape parameters
-    const double XHalfLength = GeoModelHelpers::variantHelper::getFromVariant_Double(row[2], "Box:XHalfLength");
-    const double YHalfLength = GeoModelHelpers::variantHelper::getFromVariant_Double(row[3], "Box:YHalfLength");
-    const double ZHalfLength = GeoModelHelpers::variantHelper::getFromVariant_Double(row[4], "Box:ZHalfLength");
+    const double XHalfLength = shapes.getDouble(row, 2, "Box:XHalfLength");
+    const double YHalfLength = shapes.getDouble(row, 3, "Box:YHalfLength");
+    const double ZHalfLength = shapes.getDouble(row, 4, "Box:ZHalfLength");
 
     GeoBox *shape = new GeoBox(XHalfLength, YHalfLength, ZHalfLength);
 
@@ -22,7 +22,7 @@ class BuildGeoShapes_Box : public BuildGeoShapes
 {
 public:
   BuildGeoShapes_Box(const unsigned size):BuildGeoShapes("Box", size){};
-  void buildShape(const DBRowEntry row) override;
+  void buildShape(const DBTable& shapes, const size_t row) override;
 };
 
 #endif
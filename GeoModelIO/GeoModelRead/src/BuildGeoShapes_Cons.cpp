@@ -15,21 +15,21 @@
 #include <vector>
 #include <iostream>
 
-void BuildGeoShapes_Cons::buildShape(const DBRowEntry row)
+void BuildGeoShapes_Cons::buildShape(const DBTable& shapes, const size_t row)
 {
     // === get shape numeric data from the DB row
     // shape ID
-    const int shapeId = GeoModelHelpers::variantHelper::getFromVariant_Int(row[0], "Cons:shapeID");
+    const int shapeId = shapes.getInt(row, 0, "Cons:shapeID");
     // shape volume
-    const double shapeVolume = GeoModelHelpers::variantHelper::getFromVariant_Double(row[1], "Cons:shapeVolume");
+    const double shapeVolume = shapes.getDouble(row, 1, "Cons:shapeVolume");
     // shape parameters
-    const double RMin1 = GeoModelHelpers::variantHelper::getFromVariant_Double(row[2], "Cons:RMin1");
-    const double RMin2 = GeoModelHelpers::variantHelper::getFromVariant_Double(row[3], "Cons:RMin2");
-    const double RMax1 = GeoModelHelpers::variantHelper::getFromVariant_Double(row[4], "Cons:RMax1");
-    const double RMax2 = GeoModelHelpers::variantHelper::getFromVariant_Double(row[5], "Cons:RMax2");
-    const double DZ = GeoModelHelpers::variantHelper::getFromVariant_Double(row[6], "Cons:DZ");
-    const double SPhi = GeoModelHelpers::variantHelper::getFromVariant_Double(row[7], "Cons:SPhi");
-    const double DPhi = GeoModelHelpers::variantHelper::getFromVariant_Double(row[8], "Cons:DPhi");
+    const double RMin1 = shapes.getDouble(row, 2, "Cons:RMin1");
+    const double RMin2 = shapes.getDouble(row, 3, "Cons:RMin2");
+    const double RMax1 = shapes.getDouble(row, 4, "Cons:RMax1");
+    const double RMax2 = shapes.getDouble(row, 5, "Cons:RMax2");
+    const double DZ = shapes.getDouble(row, 6, "Cons:DZ");
+    const double SPhi = shapes.getDouble(row, 7, "Cons:SPhi");
+    const double DPhi = shapes.getDouble(row, 8, "Cons:DPhi");
 
     GeoCons *shape = new GeoCons(RMin1, RMin2, RMax1, RMax2, DZ, SPhi, DPhi);
 
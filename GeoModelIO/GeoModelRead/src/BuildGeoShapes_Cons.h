@@ -23,7 +23,7 @@ class BuildGeoShapes_Cons : public BuildGeoShapes
 {
 public:
   BuildGeoShapes_Cons(const unsigned size):BuildGeoShapes("Cons", size){};
-  void buildShape(const DBRowEntry row) override;
+  void buildShape(const DBTable& shapes, const size_t row) override;
 };
 
 #endif
@@ -15,17 +15,17 @@
 #include <vector>
 #include <iostream>
 
-void BuildGeoShapes_EllipticalTube::buildShape(const DBRowEntry row)
+void BuildGeoShapes_EllipticalTube::buildShape(const DBTable& shapes, const size_t row)
 {
     // === get shape numeric data from the DB row
     // shape ID
-    const unsigned shapeId = GeoModelHelpers::variantHelper::getFromVariant_Int(row[0], "EllipticalTube:shapeID");
+    const unsigned shapeId = shapes.getInt(row, 0, "EllipticalTube:shapeID");
     // shape volume
-    const double shapeVolume = GeoModelHelpers::variantHelper::getFromVariant_Double(row[1], "EllipticalTube:shapeVolume");
+    const double shapeVolume = shapes.getDouble(row, 1, "EllipticalTube:shapeVolume");
     // shape parameters
-    const double XHalfLength = GeoModelHelpers::variantHelper::getFromVariant_Double(row[2], "EllipticalTube:XHalfLength");
-    const double YHalfLength = GeoModelHelpers::variantHelper::getFromVariant_Double(row[3], "EllipticalTube:YHalfLength");
-    const double ZHalfLength = GeoModelHelpers::variantHelper::getFromVariant_Double(row[4], "EllipticalTube:ZHalfLength");
+    const double XHalfLength = shapes.getDouble(row, 2, "EllipticalTube:XHalfLength");
+    const double YHalfLength = shapes.getDouble(row, 3, "EllipticalTube:YHalfLength");
+    const double ZHalfLength = shapes.getDouble(row, 4, "EllipticalTube:ZHalfLength");
 
     GeoEllipticalTube *shape = new GeoEllipticalTube(XHalfLength, YHalfLength, ZHalfLength);
 
@@ -22,7 +22,7 @@ class BuildGeoShapes_EllipticalTube : public BuildGeoShapes
 {
 public:
   BuildGeoShapes_EllipticalTube(const unsigned size):BuildGeoShapes("EllipticalTube", size){};
-  void buildShape(const DBRowEntry row) override;
+  void buildShape(const DBTable& shapes, const size_t row) override;
 };
 
 #endif
@@ -10,30 +10,30 @@
 #include "BuildGeoShapes_GenericTrap.h"
 
 #include "GeoModelKernel/GeoGenericTrap.h"
-#include "GeoModelHelpers/variantHelpers.h"
 #include "GeoModelKernel/throwExcept.h"
 
+#include <algorithm>
 #include <vector>
 #include <iostream>
 
-void BuildGeoShapes_GenericTrap::buildShape(const DBRowEntry row)
+void BuildGeoShapes_GenericTrap::buildShape(const DBTable& shapes, const size_t row)
 {
-    if (!(m_shape_data.size()))
+    if (!m_shape_data || m_shape_data->empty())
     {
         THROW_EXCEPTION("ERROR! GeoGenericTrap shape has no ZPlanes data!! [m_shape_data.size() == 0]");
     }
 
     // === get shape numeric data from the DB row
     // shape ID
-    const int shapeId = GeoModelHelpers::variantHelper::getFromVariant_Int(row[0], "GenericTrap:shapeID");
+    const int shapeId = shapes.getInt(row, 0, "GenericTrap:shapeID");
     // shape volume
-    const double shapeVolume = GeoModelHelpers::variantHelper::getFromVariant_Double(row[1], "GenericTrap:shapeVolume");
+    const double shapeVolume = shapes.getDouble(row, 1, "GenericTrap:shapeVolume");
     // shape parameters
-    const double zHalfLength = GeoModelHelpers::variantHelper::getFromVariant_Double(row[2], "GenericTrap:ZHalfLength");
-    const unsigned int NVertices = GeoModelHelpers::variantHelper::getFromVariant_Int(row[3], "GenericTrap:NVertices");
+    const double zHalfLength = shapes.getDouble(row, 2, "GenericTrap:ZHalfLength");
+    const unsigned int NVertices = shapes.getInt(row, 3, "GenericTrap:NVertices");
     // pointers to variable shape data stored in a separate table
-    const int dataStart = GeoModelHelpers::variantHelper::getFromVariant_Int(row[4], "GenericTrap:dataStart");
-    const int dataEnd = GeoModelHelpers::variantHelper::getFromVariant_Int(row[5], "GenericTrap:dataEnd");
+    const int dataStart = shapes.getInt(row, 4, "GenericTrap:dataStart");
+    const int dataEnd = shapes.getInt(row, 5, "GenericTrap:dataEnd");
 
     // and now loop over the additional shape's data,
     // to get the parameters of all vertices
@@ -41,26 +41,25 @@ void BuildGeoShapes_GenericTrap::buildShape(const DBRowEntry row)
     //container for GenericTrap vertices
     GeoGenericTrapVertices vertices; 
 
-    // extract subvector
+    // the shape's data are stored in the rows [dataStart-1, dataEnd) of the data table
     // NOTE: we use (dataStart-1) to cope with the difference between the DB rows starting from '1',
-    //       which is what the 'dataStart' stores, and the vector items, which start '0';
-    //       also, the constructor of the sub-vector takes the element from 'begin+dataStart-1' included
-    //       and 'begin+dataEnd' excluded.
-    const DBRowsList thisShapeData(m_shape_data.begin() + (dataStart - 1),
-                                   m_shape_data.begin() + (dataEnd));
-    if (!(thisShapeData.size()))
+    //       which is what the 'dataStart' stores, and the table rows, which start '0'.
+    const size_t firstDataRow = dataStart > 0 ? dataStart - 1 : 0;
+    const size_t endDataRow = dataEnd > 0 ? std::min<size_t>(dataEnd, m_shape_data->size()) : 0;
+    const size_t nDataRows = endDataRow > firstDataRow ? endDataRow - firstDataRow : 0;
+    if (!nDataRows)
     {
         THROW_EXCEPTION("ERROR! GeoGenericTrap shape ZPlanes data have not been retrieved!!");
     }
-    if (!(NVertices == thisShapeData.size()))
+    if (!(NVertices == nDataRows))
     {
         THROW_EXCEPTION("ERROR! GeoGenericTrap shape : size of ZPlanes data does not correspond to the number of ZPlanes declared!!");
     }
     // loop over the data defining the ZPlanes
-    for (const DBRowEntry &dataRow : thisShapeData)
+    for (size_t dataRow = firstDataRow; dataRow < endDataRow; ++dataRow)
     {
-        const double xV = GeoModelHelpers::variantHelper::getFromVariant_Double(dataRow[1], "GenericTrap:data_xV");
-        const double yV = GeoModelHelpers::variantHelper::getFromVariant_Double(dataRow[2], "GenericTrap:data_yV");
+        const double xV = m_shape_data->getDouble(dataRow, 1, "GenericTrap:data_xV");
+        const double yV = m_shape_data->getDouble(dataRow, 2, "GenericTrap:data_yV");
         // add a vertex to the collection of all GeoGenericTrap vertices
         vertices.push_back(GeoTwoVector(xV, yV));
     }
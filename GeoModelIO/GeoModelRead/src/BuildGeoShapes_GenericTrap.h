@@ -23,8 +23,8 @@
 class BuildGeoShapes_GenericTrap : public BuildGeoShapes
 {
 public:
-  BuildGeoShapes_GenericTrap(const unsigned size, DBRowsList shapeData):BuildGeoShapes("GenericTrap", size, shapeData){};
-  void buildShape(const DBRowEntry row) override;
+  BuildGeoShapes_GenericTrap(const unsigned size, const DBTable& shapeData):BuildGeoShapes("GenericTrap", size, shapeData){};
+  void buildShape(const DBTable& shapes, const size_t row) override;
 };
 
 #endif
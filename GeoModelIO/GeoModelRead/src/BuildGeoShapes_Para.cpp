@@ -15,21 +15,21 @@
 #include <vector>
 #include <iostream>
 
-void BuildGeoShapes_Para::buildShape(const DBRowEntry row)
+void BuildGeoShapes_Para::buildShape(const DBTable& shapes, const size_t row)
 {
   // === get shape numeric data from the DB row
   // shape ID
-  const int shapeId = GeoModelHelpers::variantHelper::getFromVariant_Int(row[0], "Para:shapeID");
+  const int shapeId = shapes.getInt(row, 0, "Para:shapeID");
   // shape volume
-  const double shapeVolume = GeoModelHelpers::variantHelper::getFromVariant_Double(row[1], "Para:shapeVolume");
+  const double shapeVolume = shapes.getDouble(row, 1, "Para:shapeVolume");
 
   // shape parameters
-  const double XHalfLength = GeoModelHelpers::variantHelper::getFromVariant_Double(row[2], "Para:XHalfLength");
-  const double YHalfLength = GeoModelHelpers::variantHelper::getFromVariant_Double(row[3], "Para:YHalfLength");
-  const double ZHalfLength = GeoModelHelpers::variantHelper::getFromVariant_Double(row[4], "Para:ZHalfLength");
-  const double Alpha = GeoModelHelpers::variantHelper::getFromVariant_Double(row[5], "Para:Alpha");
-  const double Theta = GeoModelHelpers::variantHelper::getFromVariant_Double(row[6], "Para:Theta");
-  const double Phi = GeoModelHelpers::variantHelper::getFromVariant_Double(row[7], "Para:Phi");
+  const double XHalfLength = shapes.getDouble(row, 2, "Para:XHalfLength");
+  const double YHalfLength = shapes.getDouble(row, 3, "Para:YHalfLength");
+  const double ZHalfLength = shapes.getDouble(row, 4, "Para:ZHalfLength");
+  const double Alpha = shapes.getDouble(row, 5, "Para:Alpha");
+  const double Theta = shapes.getDouble(row, 6, "Para:Theta");
+  const double Phi = shapes.getDouble(row, 7, "Para:Phi");
 
   GeoPara *shape = new GeoPara(XHalfLength, YHalfLength, ZHalfLength, Alpha, Theta,
                                Phi);
@@ -23,7 +23,7 @@ class BuildGeoShapes_Para : public BuildGeoShapes
 {
 public:
   BuildGeoShapes_Para(const unsigned size):BuildGeoShapes("Para", size){};
-  void buildShape(const DBRowEntry row) override;
+  void buildShape(const DBTable& shapes, const size_t row) override;
 };
 
 #endif
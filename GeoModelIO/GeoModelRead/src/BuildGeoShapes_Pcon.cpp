@@ -10,30 +10,30 @@
 #include "BuildGeoShapes_Pcon.h"
 
 #include "GeoModelKernel/GeoPcon.h"
-#include "GeoModelHelpers/variantHelpers.h"
 #include "GeoModelKernel/throwExcept.h"
 
+#include <algorithm>
 #include <vector>
 #include <iostream>
 
-void BuildGeoShapes_Pcon::buildShape(const DBRowEntry row)
+void BuildGeoShapes_Pcon::buildShape(const DBTable& shapes, const size_t row)
 {
-    if (!(m_shape_data.size())) {
+    if (!m_shape_data || m_shape_data->empty()) {
         THROW_EXCEPTION("ERROR! GeoPcon shape has no ZPlanes data!! [m_shape_data.size() == 0]");
     }
 
     // === get shape numeric data from the DB row
     // shape ID
-    const int shapeId = GeoModelHelpers::variantHelper::getFromVariant_Int(row[0], "Pcon:shapeID");
+    const int shapeId = shapes.getInt(row, 0, "Pcon:shapeID");
     // shape volume
-    const double shapeVolume = GeoModelHelpers::variantHelper::getFromVariant_Double(row[1], "Pcon:shapeVolume");
+    const double shapeVolume = shapes.getDouble(row, 1, "Pcon:shapeVolume");
     // shape parameters
-    const double SPhi = GeoModelHelpers::variantHelper::getFromVariant_Double(row[2], "Pcon:SPhi");
-    const double DPhi = GeoModelHelpers::variantHelper::getFromVariant_Double(row[3], "Pcon:DPhi");
-    const int NZPlanes = GeoModelHelpers::variantHelper::getFromVariant_Int(row[4], "Pcon:NZPlanes");
+    const double SPhi = shapes.getDouble(row, 2, "Pcon:SPhi");
+    const double DPhi = shapes.getDouble(row, 3, "Pcon:DPhi");
+    const int NZPlanes = shapes.getInt(row, 4, "Pcon:NZPlanes");
     // pointers to variable shape data stored in a separate table
-    const int dataStart = GeoModelHelpers::variantHelper::getFromVariant_Int(row[5], "Pcon:dataStart");
-    const int dataEnd = GeoModelHelpers::variantHelper::getFromVariant_Int(row[6], "Pcon:dataEnd");
+    const int dataStart = shapes.getInt(row, 5, "Pcon:dataStart");
+    const int dataEnd = shapes.getInt(row, 6, "Pcon:dataEnd");
 
     // build the basic GeoPcon shape
     GeoPcon *pcon = new GeoPcon(SPhi, DPhi);
@@ -41,25 +41,24 @@ void BuildGeoShapes_Pcon::buildShape(const DBRowEntry row)
     // and now loop over the additional shape's data, 
     // to get the parameters of all Z planes
 
-    // get ZPlanes' data, extract subvector
-    // NOTE: we use (dataStart-1) to cope with the difference between the DB rows starting from '1', 
-    //       which is what the 'dataStart' stores, and the vector items, which start '0'; 
-    //       also, the constructor of the sub-vector takes the element from 'begin+dataStart-1' included
-    //       and 'begin+dataEnd' excluded.
-    const DBRowsList zplanesData(m_shape_data.begin() + (dataStart-1),
-                                 m_shape_data.begin() + (dataEnd) );
-    if (!(zplanesData.size())) {
+    // the shape's data are stored in the rows [dataStart-1, dataEnd) of the data table
+    // NOTE: we use (dataStart-1) to cope with the difference between the DB rows starting from '1',
+    //       which is what the 'dataStart' stores, and the table rows, which start '0'.
+    const size_t firstDataRow = dataStart > 0 ? dataStart - 1 : 0;
+    const size_t endDataRow = dataEnd > 0 ? std::min<size_t>(dataEnd, m_shape_data->size()) : 0;
+    const size_t nDataRows = endDataRow > firstDataRow ? endDataRow - firstDataRow : 0;
+    if (!nDataRows) {
         THROW_EXCEPTION("ERROR! GeoPcon shape ZPlanes data have not been retrieved!!");
     }
-    if (!( NZPlanes == zplanesData.size())) {
+    if (!( NZPlanes == nDataRows)) {
         THROW_EXCEPTION("ERROR! GeoPcon shape : size of ZPlanes data does not correspond to the number of ZPlanes declared!!");
     }
     // loop over the data defining the ZPlanes
-    for (const DBRowEntry &dataRow : zplanesData)
+    for (size_t dataRow = firstDataRow; dataRow < endDataRow; ++dataRow)
     {
-        const double zpos = GeoModelHelpers::variantHelper::getFromVariant_Double(dataRow[1], "Pcon:data_ZPos");
-        const double rmin = GeoModelHelpers::variantHelper::getFromVariant_Double(dataRow[2], "Pcon:data_RMin");
-        const double rmax = GeoModelHelpers::variantHelper::getFromVariant_Double(dataRow[3], "Pcon:data_RMax");
+        const double zpos = m_shape_data->getDouble(dataRow, 1, "Pcon:data_ZPos");
+        const double rmin = m_shape_data->getDouble(dataRow, 2, "Pcon:data_RMin");
+        const double rmax = m_shape_data->getDouble(dataRow, 3, "Pcon:data_RMax");
         // add a Z plane to the GeoPcon
         pcon->addPlane(zpos, rmin, rmax);
     }
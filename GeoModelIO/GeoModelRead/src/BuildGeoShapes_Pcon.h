@@ -23,8 +23,8 @@
 class BuildGeoShapes_Pcon : public BuildGeoShapes
 {
 public:
-  BuildGeoShapes_Pcon(const unsigned size, DBRowsList shapeData):BuildGeoShapes("Pcon", size, shapeData){};
-  void buildShape(const DBRowEntry row) override;
+  BuildGeoShapes_Pcon(const unsigned size, const DBTable& shapeData):BuildGeoShapes("Pcon", size, shapeData){};
+  void buildShape(const DBTable& shapes, const size_t row) override;
 };
 
 #endif
@@ -10,31 +10,31 @@
 #include "BuildGeoShapes_Pgon.h"
 
 #include "GeoModelKernel/GeoPgon.h"
-#include "GeoModelHelpers/variantHelpers.h"
 #include "GeoModelKernel/throwExcept.h"
 
+#include <algorithm>
 #include <vector>
 #include <iostream>
 
-void BuildGeoShapes_Pgon::buildShape(const DBRowEntry row)
+void BuildGeoShapes_Pgon::buildShape(const DBTable& shapes, const size_t row)
 {
-    if (!(m_shape_data.size())) {
+    if (!m_shape_data || m_shape_data->empty()) {
         THROW_EXCEPTION("ERROR! GeoPgon shape has no ZPlanes data!! [m_shape_data.size() == 0]");
     }
 
     // === get shape numeric data from the DB row
     // shape ID
-    const int shapeId = GeoModelHelpers::variantHelper::getFromVariant_Int(row[0], "Pgon:shapeID");
+    const int shapeId = shapes.getInt(row, 0, "Pgon:shapeID");
     // shape volume
-    const double shapeVolume = GeoModelHelpers::variantHelper::getFromVariant_Double(row[1], "Pgon:shapeVolume");
+    const double shapeVolume = shapes.getDouble(row, 1, "Pgon:shapeVolume");
     // shape parameters
-    const double SPhi = GeoModelHelpers::variantHelper::getFromVariant_Double(row[2], "Pgon:SPhi");
-    const double DPhi = GeoModelHelpers::variantHelper::getFromVariant_Double(row[3], "Pgon:DPhi");
-    const int NSides = GeoModelHelpers::variantHelper::getFromVariant_Int(row[4], "Pgon:NSides");
-    const int NZPlanes = GeoModelHelpers::variantHelper::getFromVariant_Int(row[5], "Pgon:NZPlanes");
+    const double SPhi = shapes.getDouble(row, 2, "Pgon:SPhi");
+    const double DPhi = shapes.getDouble(row, 3, "Pgon:DPhi");
+    const int NSides = shapes.getInt(row, 4, "Pgon:NSides");
+    const int NZPlanes = shapes.getInt(row, 5, "Pgon:NZPlanes");
     // pointers to variable shape data stored in a separate table
-    const int dataStart = GeoModelHelpers::variantHelper::getFromVariant_Int(row[6], "Pgon:dataStart");
-    const int dataEnd = GeoModelHelpers::variantHelper::getFromVariant_Int(row[7], "Pgon:dataEnd");
+    const int dataStart = shapes.getInt(row, 6, "Pgon:dataStart");
+    const int dataEnd = shapes.getInt(row, 7, "Pgon:dataEnd");
 
     // build the basic GeoPgon shape
     GeoPgon *shape = new GeoPgon(SPhi, DPhi, NSides);
@@ -42,25 +42,24 @@ void BuildGeoShapes_Pgon::buildShape(const DBRowEntry row)
     // and now loop over the additional shape's data, 
     // to get the parameters of all Z planes
 
-    // extract subvector
-    // NOTE: we use (dataStart-1) to cope with the difference between the DB rows starting from '1', 
-    //       which is what the 'dataStart' stores, and the vector items, which start '0'; 
-    //       also, the constructor of the sub-vector takes the element from 'begin+dataStart-1' included
-    //       and 'begin+dataEnd' excluded.
-    const DBRowsList zplanesData(m_shape_data.begin() + (dataStart-1),
-                                 m_shape_data.begin() + (dataEnd) );
-    if (!(zplanesData.size())) {
+    // the shape's data are stored in the rows [dataStart-1, dataEnd) of the data table
+    // NOTE: we use (dataStart-1) to cope with the difference between the DB rows starting from '1',
+    //       which is what the 'dataStart' stores, and the table rows, which start '0'.
+    const size_t firstDataRow = dataStart > 0 ? dataStart - 1 : 0;
+    const size_t endDataRow = dataEnd > 0 ? std::min<size_t>(dataEnd, m_shape_data->size()) : 0;
+    const size_t nDataRows = endDataRow > firstDataRow ? endDataRow - firstDataRow : 0;
+    if (!nDataRows) {
         THROW_EXCEPTION("ERROR! GeoPgon shape ZPlanes data have not been retrieved!!");
     }
-    if (!( NZPlanes == zplanesData.size())) {
+    if (!( NZPlanes == nDataRows)) {
         THROW_EXCEPTION("ERROR! GeoPgon shape : size of ZPlanes data does not correspond to the number of ZPlanes declared!!");
     }
     // loop over the data defining the ZPlanes
-    for (const DBRowEntry &dataRow : zplanesData)
+    for (size_t dataRow = firstDataRow; dataRow < endDataRow; ++dataRow)
     {
-        const double zpos = GeoModelHelpers::variantHelper::getFromVariant_Double(dataRow[1], "Pgon:data_ZPos");
-        const double rmin = GeoModelHelpers::variantHelper::getFromVariant_Double(dataRow[2], "Pgon:data_ZRMin");
-        const double rmax = GeoModelHelpers::variantHelper::getFromVariant_Double(dataRow[3], "Pgon:data_ZRMax");
+        const double zpos = m_shape_data->getDouble(dataRow, 1, "Pgon:data_ZPos");
+        const double rmin = m_shape_data->getDouble(dataRow, 2, "Pgon:data_ZRMin");
+        const double rmax = m_shape_data->getDouble(dataRow, 3, "Pgon:data_ZRMax");
         // add a Z plane to the GeoPgon
         shape->addPlane(zpos, rmin, rmax);
     }
@@ -23,8 +23,8 @@
 class BuildGeoShapes_Pgon : public BuildGeoShapes
 {
 public:
-  BuildGeoShapes_Pgon(const unsigned size, DBRowsList shapeData):BuildGeoShapes("Pgon", size, shapeData){};
-  void buildShape(const DBRowEntry row) override;
+  BuildGeoShapes_Pgon(const unsigned size, const DBTable& shapeData):BuildGeoShapes("Pgon", size, shapeData){};
+  void buildShape(const DBTable& shapes, const size_t row) override;
 };
 
 #endif
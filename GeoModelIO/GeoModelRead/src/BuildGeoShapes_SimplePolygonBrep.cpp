@@ -10,30 +10,30 @@
 #include "BuildGeoShapes_SimplePolygonBrep.h"
 
 #include "GeoModelKernel/GeoSimplePolygonBrep.h"
-#include "GeoModelHelpers/variantHelpers.h"
 #include "GeoModelKernel/throwExcept.h"
 
+#include <algorithm>
 #include <vector>
 #include <iostream>
 
-void BuildGeoShapes_SimplePolygonBrep::buildShape(const DBRowEntry row)
+void BuildGeoShapes_SimplePolygonBrep::buildShape(const DBTable& shapes, const size_t row)
 {
-    if (!(m_shape_data.size()))
+    if (!m_shape_data || m_shape_data->empty())
     {
         THROW_EXCEPTION("ERROR! GeoSimplePolygonBrep shape has no ZPlanes data!! [m_shape_data.size() == 0]");
     }
 
     // === get shape numeric data from the DB row
     // shape ID
-    const int shapeId = GeoModelHelpers::variantHelper::getFromVariant_Int(row[0], "SimplePolygonBrep:shapeID");
+    const int shapeId = shapes.getInt(row, 0, "SimplePolygonBrep:shapeID");
     // shape volume
-    const double shapeVolume = GeoModelHelpers::variantHelper::getFromVariant_Double(row[1], "SimplePolygonBrep:shapeVolume");
+    const double shapeVolume = shapes.getDouble(row, 1, "SimplePolygonBrep:shapeVolume");
     // shape parameters
-    const double DZ = GeoModelHelpers::variantHelper::getFromVariant_Double(row[2], "SimplePolygonBrep:DZ");
-    const unsigned int NVertices = GeoModelHelpers::variantHelper::getFromVariant_Int(row[3], "SimplePolygonBrep:NVertices");
+    const double DZ = shapes.getDouble(row, 2, "SimplePolygonBrep:DZ");
+    const unsigned int NVertices = shapes.getInt(row, 3, "SimplePolygonBrep:NVertices");
     // pointers to variable shape data stored in a separate table
-    const int dataStart = GeoModelHelpers::variantHelper::getFromVariant_Int(row[4], "SimplePolygonBrep:dataStart");
-    const int dataEnd = GeoModelHelpers::variantHelper::getFromVariant_Int(row[5], "SimplePolygonBrep:dataEnd");
+    const int dataStart = shapes.getInt(row, 4, "SimplePolygonBrep:dataStart");
+    const int dataEnd = shapes.getInt(row, 5, "SimplePolygonBrep:dataEnd");
 
     // build the basic GeoSimplePolygonBrep shape
     GeoSimplePolygonBrep *shape = new GeoSimplePolygonBrep(DZ);
@@ -41,26 +41,25 @@ void BuildGeoShapes_SimplePolygonBrep::buildShape(const DBRowEntry row)
     // and now loop over the additional shape's data,
     // to get the parameters of all vertices
 
-    // extract subvector
+    // the shape's data are stored in the rows [dataStart-1, dataEnd) of the data table
     // NOTE: we use (dataStart-1) to cope with the difference between the DB rows starting from '1',
-    //       which is what the 'dataStart' stores, and the vector items, which start '0';
-    //       also, the constructor of the sub-vector takes the element from 'begin+dataStart-1' included
-    //       and 'begin+dataEnd' excluded.
-    const DBRowsList thisShapeData(m_shape_data.begin() + (dataStart - 1),
-                                   m_shape_data.begin() + (dataEnd));
-    if (!(thisShapeData.size()))
+    //       which is what the 'dataStart' stores, and the table rows, which start '0'.
+    const size_t firstDataRow = dataStart > 0 ? dataStart - 1 : 0;
+    const size_t endDataRow = dataEnd > 0 ? std::min<size_t>(dataEnd, m_shape_data->size()) : 0;
+    const size_t nDataRows = endDataRow > firstDataRow ? endDataRow - firstDataRow : 0;
+    if (!nDataRows)
     {
         THROW_EXCEPTION("ERROR! GeoSimplePolygonBrep shape ZPlanes data have not been retrieved!!");
     }
-    if (!(NVertices == thisShapeData.size()))
+    if (!(NVertices == nDataRows))
     {
         THROW_EXCEPTION("ERROR! GeoSimplePolygonBrep shape : size of ZPlanes data does not correspond to the number of ZPlanes declared!!");
     }
     // loop over the data defining the ZPlanes
-    for (const DBRowEntry &dataRow : thisShapeData)
+    for (size_t dataRow = firstDataRow; dataRow < endDataRow; ++dataRow)
     {
-        const double xV = GeoModelHelpers::variantHelper::getFromVariant_Double(dataRow[1], "SimplePolygonBrep:data_xV");
-        const double yV = GeoModelHelpers::variantHelper::getFromVariant_Double(dataRow[2], "SimplePolygonBrep:data_yV");
+        const double xV = m_shape_data->getDouble(dataRow, 1, "SimplePolygonBrep:data_xV");
+        const double yV = m_shape_data->getDouble(dataRow, 2, "SimplePolygonBrep:data_yV");
         // add a vertex to the GeoSimplePolygonBrep
         shape->addVertex(xV, yV);
     }
@@ -23,8 +23,8 @@
 class BuildGeoShapes_SimplePolygonBrep : public BuildGeoShapes
 {
 public:
-  BuildGeoShapes_SimplePolygonBrep(const unsigned size, DBRowsList shapeData):BuildGeoShapes("SimplePolygonBrep", size, shapeData){};
-  void buildShape(const DBRowEntry row) override;
+  BuildGeoShapes_SimplePolygonBrep(const unsigned size, const DBTable& shapeData):BuildGeoShapes("SimplePolygonBrep", size, shapeData){};
+  void buildShape(const DBTable& shapes, const size_t row) override;
 };
 
 #endif
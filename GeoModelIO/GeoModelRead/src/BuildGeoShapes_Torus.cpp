@@ -15,19 +15,19 @@
 #include <vector>
 #include <iostream>
 
-void BuildGeoShapes_Torus::buildShape(const DBRowEntry row)
+void BuildGeoShapes_Torus::buildShape(const DBTable& shapes, const size_t row)
 {
   // === get shape numeric data from the DB row
   // shape ID
-  const int shapeId = GeoModelHelpers::variantHelper::getFromVariant_Int(row[0], "Torus:shapeID");
+  const int shapeId = shapes.getInt(row, 0, "Torus:shapeID");
   // shape volume
-  const double shapeVolume = GeoModelHelpers::variantHelper::getFromVariant_Double(row[1], "Torus:shapeVolume");
+  const double shapeVolume = shapes.getDouble(row, 1, "Torus:shapeVolume");
   // shape parameters
-  const double RMin = GeoModelHelpers::variantHelper::getFromVariant_Double(row[2], "Torus:RMin");
-  const double RMax = GeoModelHelpers::variantHelper::getFromVariant_Double(row[3], "Torus:RMax");
-  const double RTor = GeoModelHelpers::variantHelper::getFromVariant_Double(row[4], "Torus:RTor");
-  const double SPhi = GeoModelHelpers::variantHelper::getFromVariant_Double(row[5], "Torus:SPhi");
-  const double DPhi = GeoModelHelpers::variantHelper::getFromVariant_Double(row[6], "Torus:DPhi");
+  const double RMin = shapes.getDouble(row, 2, "Torus:RMin");
+  const double RMax = shapes.getDouble(row, 3, "Torus:RMax");
+  const double RTor = shapes.getDouble(row, 4, "Torus:RTor");
+  const double SPhi = shapes.getDouble(row, 5, "Torus:SPhi");
+  const double DPhi = shapes.getDouble(row, 6, "Torus:DPhi");
   
   GeoShape *shape = new GeoTorus(RMin, RMax, RTor, SPhi, DPhi);
 
@@ -22,7 +22,7 @@ class BuildGeoShapes_Torus : public BuildGeoShapes
 {
 public:
   BuildGeoShapes_Torus(const unsigned size):BuildGeoShapes("Torus", size){};
-  void buildShape(const DBRowEntry row) override;
+  void buildShape(const DBTable& shapes, const size_t row) override;
 };
 
 #endif
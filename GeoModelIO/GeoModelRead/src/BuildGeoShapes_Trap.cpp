@@ -15,25 +15,25 @@
 #include <vector>
 #include <iostream>
 
-void BuildGeoShapes_Trap::buildShape(const DBRowEntry row)
+void BuildGeoShapes_Trap::buildShape(const DBTable& shapes, const size_t row)
 {
   // === get shape numeric data from the DB row
   // shape ID
-  const int shapeId = GeoModelHelpers::variantHelper::getFromVariant_Int(row[0], "Trap:shapeID");
+  const int shapeId = shapes.getInt(row, 0, "Trap:shapeID");
   // shape volume
-  const double shapeVolume = GeoModelHelpers::variantHelper::getFromVariant_Double(row[1], "Trap:shapeVolume");
+  const double shapeVolume = shapes.getDouble(row, 1, "Trap:shapeVolume");
   // shape parameters
-  const double ZHalfLength = GeoModelHelpers::variantHelper::getFromVariant_Double(row[2], "Trap:ZHalfLength");
-  const double Theta = GeoModelHelpers::variantHelper::getFromVariant_Double(row[3], "Trap:Theta");
-  const double Phi = GeoModelHelpers::variantHelper::getFromVariant_Double(row[4], "Trap:Phi");
-  const double Dydzn = GeoModelHelpers::variantHelper::getFromVariant_Double(row[5], "Trap:Dydzn");
-  const double Dxdyndzn = GeoModelHelpers::variantHelper::getFromVariant_Double(row[6], "Trap:Dxdyndzn");
-  const double Dxdypdzn = GeoModelHelpers::variantHelper::getFromVariant_Double(row[7], "Trap:Dxdypdzn");
-  const double Angleydzn = GeoModelHelpers::variantHelper::getFromVariant_Double(row[8], "Trap:Angleydzn");
-  const double Dydzp = GeoModelHelpers::variantHelper::getFromVariant_Double(row[9], "Trap:Dydzp");
-  const double Dxdyndzp = GeoModelHelpers::variantHelper::getFromVariant_Double(row[10], "Trap:Dxdyndzp");
-  const double Dxdypdzp = GeoModelHelpers::variantHelper::getFromVariant_Double(row[11], "Trap:Dxdypdzp");
-  const double Angleydzp = GeoModelHelpers::variantHelper::getFromVariant_Double(row[12], "Trap:Angleydzp");
+  const double ZHalfLength = shapes.getDouble(row, 2, "Trap:ZHalfLength");
+  const double Theta = shapes.getDouble(row, 3, "Trap:Theta");
+  const double Phi = shapes.getDouble(row, 4, "Trap:Phi");
+  const double Dydzn = shapes.getDouble(row, 5, "Trap:Dydzn");
+  const double Dxdyndzn = shapes.getDouble(row, 6, "Trap:Dxdyndzn");
+  const double Dxdypdzn = shapes.getDouble(row, 7, "Trap:Dxdypdzn");
+  const double Angleydzn = shapes.getDouble(row, 8, "Trap:Angleydzn");
+  const double Dydzp = shapes.getDouble(row, 9, "Trap:Dydzp");
+  const double Dxdyndzp = shapes.getDouble(row, 10, "Trap:Dxdyndzp");
+  const double Dxdypdzp = shapes.getDouble(row, 11, "Trap:Dxdypdzp");
+  const double Angleydzp = shapes.getDouble(row, 12, "Trap:Angleydzp");
 
   GeoShape *shape = new GeoTrap(ZHalfLength, Theta, Phi, Dydzn, Dxdyndzn, Dxdypdzn,
                                 Angleydzn, Dydzp, Dxdyndzp, Dxdypdzp, Angleydzp);
@@ -23,7 +23,7 @@ class BuildGeoShapes_Trap : public BuildGeoShapes
 {
 public:
   BuildGeoShapes_Trap(const unsigned size):BuildGeoShapes("Trap", size){};
-  void buildShape(const DBRowEntry row) override;
+  void buildShape(const DBTable& shapes, const size_t row) override;
 };
 
 #endif
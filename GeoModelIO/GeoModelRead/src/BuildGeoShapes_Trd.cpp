@@ -15,19 +15,19 @@
 #include <vector>
 #include <iostream>
 
-void BuildGeoShapes_Trd::buildShape(const DBRowEntry row)
+void BuildGeoShapes_Trd::buildShape(const DBTable& shapes, const size_t row)
 {
   // === get shape numeric data from the DB row
   // shape ID
-  const int shapeId = GeoModelHelpers::variantHelper::getFromVariant_Int(row[0], "Trd:shapeID");
+  const int shapeId = shapes.getInt(row, 0, "Trd:shapeID");
   // shape volume
-  const double shapeVolume = GeoModelHelpers::variantHelper::getFromVariant_Double(row[1], "Trd:shapeVolume");
+  const double shapeVolume = shapes.getDouble(row, 1, "Trd:shapeVolume");
   // shape parameters
-  const double XHalfLength1 = GeoModelHelpers::variantHelper::getFromVariant_Double(row[2], "Trd:XHalfLength1");
-  const double XHalfLength2 = GeoModelHelpers::variantHelper::getFromVariant_Double(row[3], "Trd:XHalfLength2");
-  const double YHalfLength1 = GeoModelHelpers::variantHelper::getFromVariant_Double(row[4], "Trd:YHalfLength1");
-  const double YHalfLength2 = GeoModelHelpers::variantHelper::getFromVariant_Double(row[5], "Trd:YHalfLength2");
-  const double ZHalfLength = GeoModelHelpers::variantHelper::getFromVariant_Double(row[6], "Trd:ZHalfLength");
+  const double XHalfLength1 = shapes.getDouble(row, 2, "Trd:XHalfLength1");
+  const double XHalfLength2 = shapes.getDouble(row, 3, "Trd:XHalfLength2");
+  const double YHalfLength1 = shapes.getDouble(row, 4, "Trd:YHalfLength1");
+  const double YHalfLength2 = shapes.getDouble(row, 5, "Trd:YHalfLength2");
+  const double ZHalfLength = shapes.getDouble(row, 6, "Trd:ZHalfLength");
   
   GeoShape *shape = new GeoTrd(XHalfLength1, XHalfLength2, YHalfLength1, YHalfLength2, ZHalfLength);
 
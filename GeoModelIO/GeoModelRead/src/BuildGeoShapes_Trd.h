@@ -23,7 +23,7 @@ class BuildGeoShapes_Trd : public BuildGeoShapes
 {
 public:
   BuildGeoShapes_Trd(const unsigned size):BuildGeoShapes("Trd", size){};
-  void buildShape(const DBRowEntry row) override;
+  void buildShape(const DBTable& shapes, const size_t row) override;
 };
 
 #endif
@@ -15,17 +15,17 @@
 #include <vector>
 #include <iostream>
 
-void BuildGeoShapes_Tube::buildShape(const DBRowEntry row)
+void BuildGeoShapes_Tube::buildShape(const DBTable& shapes, const size_t row)
 {
     // === get shape numeric data from the DB row
     // shape ID
-    const int shapeId = GeoModelHelpers::variantHelper::getFromVariant_Int(row[0], "Tube:shapeID");
+    const int shapeId = shapes.getInt(row, 0, "Tube:shapeID");
     // shape volume
-    const double shapeVolume = GeoModelHelpers::variantHelper::getFromVariant_Double(row[1], "Tube:shapeVolume");
+    const double shapeVolume = shapes.getDouble(row, 1, "Tube:shapeVolume");
     // shape parameters
-    const double RMin = GeoModelHelpers::variantHelper::getFromVariant_Double(row[2], "Tube:RMin");
-    const double RMax = GeoModelHelpers::variantHelper::getFromVariant_Double(row[3], "Tube:RMax");
-    const double ZHalfLength = GeoModelHelpers::variantHelper::getFromVariant_Double(row[4], "Tube:ZHalfLength");
+    const double RMin = shapes.getDouble(row, 2, "Tube:RMin");
+    const double RMax = shapes.getDouble(row, 3, "Tube:RMax");
+    const double ZHalfLength = shapes.getDouble(row, 4, "Tube:ZHalfLength");
 
     GeoTube *shape = new GeoTube(RMin, RMax, ZHalfLength);
 
@@ -22,7 +22,7 @@ class BuildGeoShapes_Tube : public BuildGeoShapes
 {
 public:
   BuildGeoShapes_Tube(const unsigned size):BuildGeoShapes("Tube", size){};
-  void buildShape(const DBRowEntry row) override;
+  void buildShape(const DBTable& shapes, const size_t row) override;
 };
 
 #endif
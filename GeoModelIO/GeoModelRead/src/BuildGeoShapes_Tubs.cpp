@@ -15,19 +15,19 @@
 #include <vector>
 #include <iostream>
 
-void BuildGeoShapes_Tubs::buildShape(const DBRowEntry row)
+void BuildGeoShapes_Tubs::buildShape(const DBTable& shapes, const size_t row)
 {
   // === get shape numeric data from the DB row
   // shape ID
-  const int shapeId = GeoModelHelpers::variantHelper::getFromVariant_Int(row[0], "Tubs:shapeID");
+  const int shapeId = shapes.getInt(row, 0, "Tubs:shapeID");
   // shape volume
-  const double shapeVolume = GeoModelHelpers::variantHelper::getFromVariant_Double(row[1], "Tubs:shapeVolume");
+  const double shapeVolume = shapes.getDouble(row, 1, "Tubs:shapeVolume");
   // shape parameters
-  const double RMin = GeoModelHelpers::variantHelper::getFromVariant_Double(row[2], "Tubs:RMin");
-  const double RMax = GeoModelHelpers::variantHelper::getFromVariant_Double(row[3], "Tubs:RMax");
-  const double ZHalfLength = GeoModelHelpers::variantHelper::getFromVariant_Double(row[4], "Tubs:ZHalfLength");
-  const double SPhi = GeoModelHelpers::variantHelper::getFromVariant_Double(row[5], "Tubs:SPhi");
-  const double DPhi = GeoModelHelpers::variantHelper::getFromVariant_Double(row[6], "Tubs:DPhi");
+  const double RMin = shapes.getDouble(row, 2, "Tubs:RMin");
+  const double RMax = shapes.getDouble(row, 3, "Tubs:RMax");
+  const double ZHalfLength = shapes.getDouble(row, 4, "Tubs:ZHalfLength");
+  const double SPhi = shapes.getDouble(row, 5, "Tubs:SPhi");
+  const double DPhi = shapes.getDouble(row, 6, "Tubs:DPhi");
   
   GeoShape *shape = new GeoTubs(RMin, RMax, ZHalfLength, SPhi, DPhi);
 
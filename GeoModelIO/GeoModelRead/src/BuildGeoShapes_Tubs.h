@@ -22,7 +22,7 @@ class BuildGeoShapes_Tubs : public BuildGeoShapes
 {
 public:
   BuildGeoShapes_Tubs(const unsigned size):BuildGeoShapes("Tubs", size){};
-  void buildShape(const DBRowEntry row) override;
+  void buildShape(const DBTable& shapes, const size_t row) override;
 };
 
 #endif
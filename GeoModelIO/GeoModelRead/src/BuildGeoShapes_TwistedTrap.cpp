@@ -15,25 +15,25 @@
 #include <vector>
 #include <iostream>
 
-void BuildGeoShapes_TwistedTrap::buildShape(const DBRowEntry row)
+void BuildGeoShapes_TwistedTrap::buildShape(const DBTable& shapes, const size_t row)
 {
   // === get shape numeric data from the DB row
   // shape ID
-  const int shapeId = GeoModelHelpers::variantHelper::getFromVariant_Int(row[0], "TwistedTrap:shapeID");
+  const int shapeId = shapes.getInt(row, 0, "TwistedTrap:shapeID");
   // shape volume
-  const double shapeVolume = GeoModelHelpers::variantHelper::getFromVariant_Double(row[1], "TwistedTrap:shapeVolume");
+  const double shapeVolume = shapes.getDouble(row, 1, "TwistedTrap:shapeVolume");
   // shape parameters
-  const double PhiTwist = GeoModelHelpers::variantHelper::getFromVariant_Double(row[2], "TwistedTrap:PhiTwist");
-  const double ZHalfLength = GeoModelHelpers::variantHelper::getFromVariant_Double(row[3], "TwistedTrap:ZHalfLength");
-  const double Theta = GeoModelHelpers::variantHelper::getFromVariant_Double(row[4], "TwistedTrap:Theta");
-  const double Phi = GeoModelHelpers::variantHelper::getFromVariant_Double(row[5], "TwistedTrap:Phi");
-  const double DY1HalfLength = GeoModelHelpers::variantHelper::getFromVariant_Double(row[6], "TwistedTrap:DY1HalfLength");
-  const double DX1HalfLength = GeoModelHelpers::variantHelper::getFromVariant_Double(row[7], "TwistedTrap:DX1HalfLength");
-  const double DX2HalfLength = GeoModelHelpers::variantHelper::getFromVariant_Double(row[8], "TwistedTrap:DX2HalfLength");
-  const double DY2HalfLength = GeoModelHelpers::variantHelper::getFromVariant_Double(row[9], "TwistedTrap:DY2HalfLength");
-  const double DX3HalfLength = GeoModelHelpers::variantHelper::getFromVariant_Double(row[10], "TwistedTrap:DX3HalfLength");
-  const double DX4HalfLength = GeoModelHelpers::variantHelper::getFromVariant_Double(row[11], "TwistedTrap:DX4HalfLength");
-  const double DTiltAngleAlpha = GeoModelHelpers::variantHelper::getFromVariant_Double(row[12], "TwistedTrap:DTiltAngleAlpha");
+  const double PhiTwist = shapes.getDouble(row, 2, "TwistedTrap:PhiTwist");
+  const double ZHalfLength = shapes.getDouble(row, 3, "TwistedTrap:ZHalfLength");
+  const double Theta = shapes.getDouble(row, 4, "TwistedTrap:Theta");
+  const double Phi = shapes.getDouble(row, 5, "TwistedTrap:Phi");
+  const double DY1HalfLength = shapes.getDouble(row, 6, "TwistedTrap:DY1HalfLength");
+  const double DX1HalfLength = shapes.getDouble(row, 7, "TwistedTrap:DX1HalfLength");
+  const double DX2HalfLength = shapes.getDouble(row, 8, "TwistedTrap:DX2HalfLength");
+  const double DY2HalfLength = shapes.getDouble(row, 9, "TwistedTrap:DY2HalfLength");
+  const double DX3HalfLength = shapes.getDouble(row, 10, "TwistedTrap:DX3HalfLength");
+  const double DX4HalfLength = shapes.getDouble(row, 11, "TwistedTrap:DX4HalfLength");
+  const double DTiltAngleAlpha = shapes.getDouble(row, 12, "TwistedTrap:DTiltAngleAlpha");
 
   GeoShape *shape =
       new GeoTwistedTrap(PhiTwist, ZHalfLength, Theta, Phi, DY1HalfLength,
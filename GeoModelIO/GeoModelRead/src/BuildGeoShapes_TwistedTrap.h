@@ -22,7 +22,7 @@ class BuildGeoShapes_TwistedTrap : public BuildGeoShapes
 {
 public:
   BuildGeoShapes_TwistedTrap(const unsigned size):BuildGeoShapes("TwistedTrap", size){};
-  void buildShape(const DBRowEntry row) override;
+  void buildShape(const DBTable& shapes, const size_t row) override;
 };
 
 #endif
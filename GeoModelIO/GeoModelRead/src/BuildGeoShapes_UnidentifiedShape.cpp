@@ -15,16 +15,16 @@
 #include <vector>
 #include <iostream>
 
-void BuildGeoShapes_UnidentifiedShape::buildShape(const DBRowEntry row)
+void BuildGeoShapes_UnidentifiedShape::buildShape(const DBTable& shapes, const size_t row)
 {
     // === get shape numeric data from the DB row
     // shape ID
-    const unsigned shapeId = GeoModelHelpers::variantHelper::getFromVariant_Int(row[0], "UnidentifiedShape:shapeID");
+    const unsigned shapeId = shapes.getInt(row, 0, "UnidentifiedShape:shapeID");
     // shape volume
-    const double shapeVolume = GeoModelHelpers::variantHelper::getFromVariant_Double(row[1], "UnidentifiedShape:shapeVolume");
+    const double shapeVolume = shapes.getDouble(row, 1, "UnidentifiedShape:shapeVolume");
     // shape parameters
-    const std::string name = GeoModelHelpers::variantHelper::getFromVariant_String(row[2], "UnidentifiedShape:name");
-    const std::string asciiData = GeoModelHelpers::variantHelper::getFromVariant_String(row[3], "UnidentifiedShape:asciiData");
+    const std::string name = shapes.getString(row, 2, "UnidentifiedShape:name");
+    const std::string asciiData = shapes.getString(row, 3, "UnidentifiedShape:asciiData");
 
     GeoUnidentifiedShape *shape = new GeoUnidentifiedShape(name, asciiData);
 
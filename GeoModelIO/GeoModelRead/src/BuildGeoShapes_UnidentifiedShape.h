@@ -22,7 +22,7 @@ class BuildGeoShapes_UnidentifiedShape : public BuildGeoShapes
 {
 public:
   BuildGeoShapes_UnidentifiedShape(const unsigned size):BuildGeoShapes("UnidentifiedShape", size){};
-  void buildShape(const DBRowEntry row) override;
+  void buildShape(const DBTable& shapes, const size_t row) override;
 };
 
 #endif
@@ -33,6 +33,7 @@
  */
 
 // local includes
+#include "TaskGraph.h"
 #include "BuildGeoShapes_Box.h"
 #include "BuildGeoShapes_EllipticalTube.h"
 #include "BuildGeoShapes_Tube.h"
@@ -118,10 +119,12 @@
 // #include "VP1Base/VP1Msg.h"
 
 // C++ includes
+#include <algorithm>
 #include <cstdlib> /* exit, EXIT_FAILURE */
 
 #include <chrono>  /* system_clock */
 #include <ctime>   /* std::time */
+#include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
@@ -322,29 +325,29 @@ void ReadGeoModel::loadDB() {
     m_materials_Data = m_dbManager->getTableFromTableName_VecVecData("Materials_Data");
 
     // shapes from the new DB schema
-    m_shapes_Box = m_dbManager->getTableFromNodeType_VecVecData("GeoBox");
-    m_shapes_EllipticalTube = m_dbManager->getTableFromNodeType_VecVecData("GeoEllipticalTube");
-    m_shapes_Tube = m_dbManager->getTableFromNodeType_VecVecData("GeoTube");
-    m_shapes_Cons = m_dbManager->getTableFromNodeType_VecVecData("GeoCons");
-    m_shapes_Para = m_dbManager->getTableFromNodeType_VecVecData("GeoPara");
-    m_shapes_Trap = m_dbManager->getTableFromNodeType_VecVecData("GeoTrap");
-    m_shapes_Trd = m_dbManager->getTableFromNodeType_VecVecData("GeoTrd");
-    m_shapes_Tubs = m_dbManager->getTableFromNodeType_VecVecData("GeoTubs");
-    m_shapes_Torus = m_dbManager->getTableFromNodeType_VecVecData("GeoTorus");
-    m_shapes_TwistedTrap = m_dbManager->getTableFromNodeType_VecVecData("GeoTwistedTrap");
-    m_shapes_UnidentifiedShape = m_dbManager->getTableFromNodeType_VecVecData("GeoUnidentifiedShape");
+    m_shapes_Box = m_dbManager->getTableFromNodeType_Columns("GeoBox");
+    m_shapes_EllipticalTube = m_dbManager->getTableFromNodeType_Columns("GeoEllipticalTube");
+    m_shapes_Tube = m_dbManager->getTableFromNodeType_Columns("GeoTube");
+    m_shapes_Cons = m_dbManager->getTableFromNodeType_Columns("GeoCons");
+    m_shapes_Para = m_dbManager->getTableFromNodeType_Columns("GeoPara");
+    m_shapes_Trap = m_dbManager->getTableFromNodeType_Columns("GeoTrap");
+    m_shapes_Trd = m_dbManager->getTableFromNodeType_Columns("GeoTrd");
+    m_shapes_Tubs = m_dbManager->getTableFromNodeType_Columns("GeoTubs");
+    m_shapes_Torus = m_dbManager->getTableFromNodeType_Columns("GeoTorus");
+    m_shapes_TwistedTrap = m_dbManager->getTableFromNodeType_Columns("GeoTwistedTrap");
+    m_shapes_UnidentifiedShape = m_dbManager->getTableFromNodeType_Columns("GeoUnidentifiedShape");
     
     // shapes with variable build parameters stored in a separate table
-    m_shapes_Pcon = m_dbManager->getTableFromNodeType_VecVecData("GeoPcon");
-    m_shapes_Pgon = m_dbManager->getTableFromNodeType_VecVecData("GeoPgon");
-    m_shapes_SimplePolygonBrep = m_dbManager->getTableFromNodeType_VecVecData("GeoSimplePolygonBrep");
-    m_shapes_GenericTrap = m_dbManager->getTableFromNodeType_VecVecData("GeoGenericTrap");
+    m_shapes_Pcon = m_dbManager->getTableFromNodeType_Columns("GeoPcon");
+    m_shapes_Pgon = m_dbManager->getTableFromNodeType_Columns("GeoPgon");
+    m_shapes_SimplePolygonBrep = m_dbManager->getTableFromNodeType_Columns("GeoSimplePolygonBrep");
+    m_shapes_GenericTrap = m_dbManager->getTableFromNodeType_Columns("GeoGenericTrap");
 
     // shapes' data, when needed by shapes that have variable numbers of build parameters
-    m_shapes_Pcon_data = m_dbManager->getTableFromTableName_VecVecData("Shapes_Pcon_Data");
-    m_shapes_Pgon_data = m_dbManager->getTableFromTableName_VecVecData("Shapes_Pgon_Data");
-    m_shapes_SimplePolygonBrep_data = m_dbManager->getTableFromTableName_VecVecData("Shapes_SimplePolygonBrep_Data");
-    m_shapes_GenericTrap_data = m_dbManager->getTableFromTableName_VecVecData("Shapes_GenericTrap_Data");
+    m_shapes_Pcon_data = m_dbManager->getTableFromTableName_Columns("Shapes_Pcon_Data");
+    m_shapes_Pgon_data = m_dbManager->getTableFromTableName_Columns("Shapes_Pgon_Data");
+    m_shapes_SimplePolygonBrep_data = m_dbManager->getTableFromTableName_Columns("Shapes_SimplePolygonBrep_Data");
+    m_shapes_GenericTrap_data = m_dbManager->getTableFromTableName_Columns("Shapes_GenericTrap_Data");
 
     // shape operators & boolean shapes
     m_shapes_Shift = m_dbManager->getTableFromNodeType_VecVecData("GeoShapeShift");
@@ -364,7 +367,7 @@ void ReadGeoModel::loadDB() {
     m_VSurface = m_dbManager->getTableFromNodeType_VecVecData("GeoVSurface");
 
     // get the children table from DB
-    m_allchildren = m_dbManager->getChildrenTable();
+    m_allchildren = m_dbManager->getChildrenTable_Columns();
     // get the root volume data
     m_root_vol_data = m_dbManager->getRootPhysVol();
     // get DB metadata
@@ -384,128 +387,96 @@ GeoVPhysVol* ReadGeoModel::buildGeoModelPrivate() {
     // *** build all nodes ***
     std::chrono::system_clock::time_point start =
         std::chrono::system_clock::now();  // timing: get start time
-    // parallel mode:
+    // set the number of worker threads; with none, all nodes are built serially
+    unsigned int nThreads = 0;
     if (m_runMultithreaded) {
+        if (m_runMultithreaded_nThreads > 0)
+            nThreads = m_runMultithreaded_nThreads;
+        else
+            nThreads = std::max(1u, std::thread::hardware_concurrency());
         if (m_loglevel >= 1)
-            std::cout << "Building nodes concurrently..." << std::endl;
-        std::thread t2(&ReadGeoModel::buildAllElements, this);
-        //  std::thread t7(&ReadGeoModel::buildAllFunctions, this); //
-        //  FIXME: implement cache for Functions
-
-        std::thread t8(&ReadGeoModel::buildAllTransforms, this);
-        std::thread t9(&ReadGeoModel::buildAllAlignableTransforms, this);
-        std::thread t10(&ReadGeoModel::buildAllSerialDenominators, this);
-        std::thread t13(&ReadGeoModel::buildAllSerialIdentifiers, this);
-        std::thread t14(&ReadGeoModel::buildAllIdentifierTags, this);
-        std::thread t11(&ReadGeoModel::buildAllNameTags, this);
-
-        t8.join();  // ok, all Transforms have been built
-        t9.join();  // ok, all AlignableTransforms have been built
-        
-        // needs Transforms and AlignableTransforms for Shift boolean shapes
-        // std::thread t1(&ReadGeoModel::buildAllShapes, this); // TODO: old, to be removed 
-        std::thread t15(&ReadGeoModel::buildAllShapes_Box, this);
-        std::thread t16(&ReadGeoModel::buildAllShapes_Tube, this);
-        std::thread t17(&ReadGeoModel::buildAllShapes_Pcon, this);
-        std::thread t18(&ReadGeoModel::buildAllShapes_Cons, this);
-        std::thread t19(&ReadGeoModel::buildAllShapes_Para, this);
-        std::thread t20(&ReadGeoModel::buildAllShapes_Pgon, this);
-        std::thread t21(&ReadGeoModel::buildAllShapes_Trap, this);
-        std::thread t22(&ReadGeoModel::buildAllShapes_Trd, this);
-        std::thread t23(&ReadGeoModel::buildAllShapes_Tubs, this);
-        std::thread t24(&ReadGeoModel::buildAllShapes_TwistedTrap, this);
-        std::thread t25(&ReadGeoModel::buildAllShapes_SimplePolygonBrep, this);
-        std::thread t26(&ReadGeoModel::buildAllShapes_UnidentifiedShape, this);
-        std::thread t27(&ReadGeoModel::buildAllShapes_Torus, this);
-        std::thread t28(&ReadGeoModel::buildAllShapes_GenericTrap, this);
-        std::thread t29(&ReadGeoModel::buildAllShapes_EllipticalTube, this);
-        
+            std::cout << "Building nodes concurrently, with " << nThreads
+                      << " threads..." << std::endl;
+    } else if (m_loglevel >= 1) {
+        std::cout << "Building nodes serially..." << std::endl;
+    }
+
+    // Each table of nodes is built by a task, which is started as soon as the
+    // tables it depends on have been built. In serial mode, tasks are run in
+    // the order they are added here.
+    using TaskId = TaskGraph::TaskId;
+    using BuildMethod = void (ReadGeoModel::*)();
+    TaskGraph graph{nThreads};
+    auto addTask = [this, &graph](const std::string& name, BuildMethod build,
+                                  const std::vector<TaskId>& deps = {}) {
+        return graph.addTask(name, [this, build]() { (this->*build)(); }, deps);
+    };
+    // minimum number of rows processed by a chunk of the largest tables
+    constexpr size_t minRowsPerChunk = 1024;
+
+    const TaskId elements = addTask("Elements", &ReadGeoModel::buildAllElements);
+    // FIXME: implement cache for Functions
+    // addTask("Functions", &ReadGeoModel::buildAllFunctions);
+    const TaskId transforms = addTask("Transforms", &ReadGeoModel::buildAllTransforms);
+    const TaskId alignableTransforms = addTask("AlignableTransforms", &ReadGeoModel::buildAllAlignableTransforms);
+    addTask("SerialDenominators", &ReadGeoModel::buildAllSerialDenominators);
+    addTask("SerialIdentifiers", &ReadGeoModel::buildAllSerialIdentifiers);
+    addTask("IdentifierTags", &ReadGeoModel::buildAllIdentifierTags);
+    addTask("NameTags", &ReadGeoModel::buildAllNameTags);
+
+    // shapes do not depend on other nodes
+    std::vector<TaskId> shapes{};
+    shapes.push_back(graph.addRangeTask(
+        "Shapes_Box", m_shapes_Box.size(), minRowsPerChunk,
+        [this]() { prepareShapes_Box(); },
+        [this](size_t first, size_t last) { buildShapes_Box(first, last); },
+        [this]() {
+            if (m_shapes_Box.size() > 0) {
+                std::cout << "All " << m_shapes_Box.size() << " Shapes-Box have been built!\n";
+            }
+        }));
+    const std::vector<std::pair<std::string, BuildMethod>> shapeTasks{
+        {"Shapes_EllipticalTube", &ReadGeoModel::buildAllShapes_EllipticalTube},
+        {"Shapes_Tube", &ReadGeoModel::buildAllShapes_Tube},
+        {"Shapes_Pcon", &ReadGeoModel::buildAllShapes_Pcon},
+        {"Shapes_Pgon", &ReadGeoModel::buildAllShapes_Pgon},
+        {"Shapes_SimplePolygonBrep", &ReadGeoModel::buildAllShapes_SimplePolygonBrep},
+        {"Shapes_GenericTrap", &ReadGeoModel::buildAllShapes_GenericTrap},
+        {"Shapes_UnidentifiedShape", &ReadGeoModel::buildAllShapes_UnidentifiedShape},
+        {"Shapes_Cons", &ReadGeoModel::buildAllShapes_Cons},
+        {"Shapes_Para", &ReadGeoModel::buildAllShapes_Para},
+        {"Shapes_Trap", &ReadGeoModel::buildAllShapes_Trap},
+        {"Shapes_Trd", &ReadGeoModel::buildAllShapes_Trd},
+        {"Shapes_Tubs", &ReadGeoModel::buildAllShapes_Tubs},
+        {"Shapes_Torus", &ReadGeoModel::buildAllShapes_Torus},
+        {"Shapes_TwistedTrap", &ReadGeoModel::buildAllShapes_TwistedTrap}};
+    for (const auto& [name, build] : shapeTasks) {
+        shapes.push_back(addTask(name, build));
+    }
+    // boolean shapes and shape operators need all shapes, and the transforms
+    // used by the Shift operators
+    std::vector<TaskId> operatorDeps{shapes};
+    operatorDeps.push_back(transforms);
+    operatorDeps.push_back(alignableTransforms);
+    const TaskId shapeOperators = addTask("Shapes_Operators", &ReadGeoModel::buildAllShapes_Operators, operatorDeps);
+
+    const TaskId materials = addTask("Materials", &ReadGeoModel::buildAllMaterials, {elements});
+    const TaskId logVols = addTask("LogVols", &ReadGeoModel::buildAllLogVols, {shapeOperators, materials});
+    const TaskId physVols = graph.addRangeTask(
+        "PhysVols", m_physVols.size(), minRowsPerChunk,
+        [this]() { preparePhysVols(); },
+        [this](size_t first, size_t last) { buildPhysVols(first, last); },
+        [this]() {
+            std::cout << "All " << m_physVols.size() << " PhysVols have been built!\n";
+        },
+        {logVols});
+    const TaskId fullPhysVols = addTask("FullPhysVols", &ReadGeoModel::buildAllFullPhysVols, {logVols});
+    addTask("SerialTransformers", &ReadGeoModel::buildAllSerialTransformers, {physVols, fullPhysVols});
+    addTask("VSurfaces", &ReadGeoModel::buildAllVSurfaces);  // Virtual Surface!
+
+    graph.run();
+    if (m_timing) graph.printTimings(std::cout);
 
-        t2.join();  // ok, all Elements have been built
-        // This below needs Elements to be built
-        std::thread t3(&ReadGeoModel::buildAllMaterials, this);
-
-        // t1.join();  // ok, all Shapes have been built
-        t15.join();  // ok, all Shapes-Box have been built
-        t16.join();  // ok, all Shapes-Tube have been built
-        t17.join();  // ok, all Shapes-Pcon have been built
-        t18.join();  // ok, all Shapes-Cons have been built
-        t19.join();  // ok, all Shapes-Para have been built
-        t20.join();  // ok, all Shapes-Pgon have been built
-        t21.join();  // ok, all Shapes-Trap have been built
-        t22.join();  // ok, all Shapes-Trd have been built
-        t23.join();  // ok, all Shapes-Tubs have been built
-        t24.join();  // ok, all Shapes-TwistedTrap have been built
-        t25.join();  // ok, all Shapes-SimplePolygonBrep have been built
-        t26.join();  // ok, all Shapes-UnidentifiedShape have been built
-        t27.join();  // ok, all Shapes-Torus have been built
-        t28.join();  // ok, all Shapes-GenericTrap have been built
-        t29.join();  // ok, all Shapes-EllipticalTube have been built
-
-	    // Build boolean shapes and shape operators,
-        // this needs Shapes to be built
-        std::thread t99(&ReadGeoModel::buildAllShapes_Operators, this);
-        t99.join();  // ok, all Shapes-Operators have been built
-        
-        t3.join();  // ok, all Materials have been built
-        // needs Shapes and Materials
-        std::thread t4(&ReadGeoModel::buildAllLogVols, this);
-
-        t4.join();  // ok, all LogVols have been built
-        // needs LogVols
-        std::thread t5(&ReadGeoModel::buildAllPhysVols, this);
-        std::thread t6(&ReadGeoModel::buildAllFullPhysVols, this);
-        std::thread t50(&ReadGeoModel::buildAllVSurfaces, this);
-        
-        t5.join();  // ok, all PhysVols have been built
-        t6.join();  // ok, all FullPhysVols have been built
-        t50.join();        
-        //  t7.join(); // ok, all Functions have been built
-        // needs Functions, PhysVols, FullPhysVols
-        std::thread t12(&ReadGeoModel::buildAllSerialTransformers, this);
-
-        t10.join();  // ok, all SerialDenominators have been built
-        t11.join();  // ok, all NameTags have been built
-        t12.join();  // ok, all SerialTransformers have been built
-        t13.join();  // ok, all SerialIdentifiers have been built
-        t14.join();  // ok, all IdentifierTags have been built
-    }
-    // serial mode:
-    else {
-        if (m_loglevel >= 1)
-            std::cout << "Building nodes serially..." << std::endl;
-        buildAllElements();
-        // buildAllFunctions();
-        buildAllTransforms();
-        buildAllAlignableTransforms();
-        buildAllSerialDenominators();
-        buildAllSerialIdentifiers();
-        buildAllIdentifierTags();
-        buildAllNameTags();
-        // buildAllShapes();
-        buildAllShapes_Box();
-        buildAllShapes_EllipticalTube();
-        buildAllShapes_Tube();
-        buildAllShapes_Pcon();
-        buildAllShapes_Pgon();
-        buildAllShapes_SimplePolygonBrep();
-        buildAllShapes_GenericTrap();
-        buildAllShapes_UnidentifiedShape();
-        buildAllShapes_Cons();
-        buildAllShapes_Para();
-        buildAllShapes_Trap();
-        buildAllShapes_Trd();
-        buildAllShapes_Tubs();
-        buildAllShapes_Torus();
-        buildAllShapes_TwistedTrap();
-        buildAllShapes_Operators();
-        buildAllMaterials();
-        buildAllLogVols();
-        buildAllPhysVols();
-        buildAllFullPhysVols();
-        buildAllSerialTransformers();
-        buildAllVSurfaces();          // Virtual Surface!
-    }
     auto end = std::chrono::system_clock::now();  // timing: get end time
     auto diff =
         std::chrono::duration_cast<std::chrono::seconds>(end - start).count();
@@ -533,8 +504,8 @@ GeoVPhysVol* ReadGeoModel::buildGeoModelPrivate() {
 //----------------------------------------
 // loop over parent-child relationship data
 void ReadGeoModel::loopOverAllChildrenRecords(
-    const DBRowsList& records) {
-    int nChildrenRecords = records.size();
+    const DBTable& records, size_t firstRow, size_t lastRow) {
+    int nChildrenRecords = lastRow - firstRow;
 
     if (m_loglevel >= 1) {
         muxCout.lock();
@@ -543,8 +514,8 @@ void ReadGeoModel::loopOverAllChildrenRecords(
                   << nChildrenRecords << " keys..." << std::endl;
         muxCout.unlock();
     }
-    for (const auto& record : records) {
-        processParentChild(record);
+    for (size_t row = firstRow; row < lastRow; ++row) {
+        processParentChild(records, row);
     }
 }
 
@@ -640,9 +611,9 @@ void ReadGeoModel::buildAllShapes_Operators()
     createBooleanShapeOperands(&shapes_info_sub);
 }
 
-//! Iterate over the list of GeoBox shape nodes, build them all, 
-//! and store their pointers
-void ReadGeoModel::buildAllShapes_Box()
+//! Create the builder of the GeoBox shape nodes, and register the IDs of all
+//! shapes, so that the shapes can then be built and stored concurrently
+void ReadGeoModel::prepareShapes_Box()
 {
     if (m_loglevel >= 1) {
         std::cout << "Building all shapes -- Box ...\n";
@@ -651,16 +622,17 @@ void ReadGeoModel::buildAllShapes_Box()
     // create a builder and reserve size of memory map
     size_t nSize = m_shapes_Box.size();
     m_builderShape_Box = new BuildGeoShapes_Box(nSize);
-
+    m_builderShape_Box->registerShapeIds(m_shapes_Box);
+}
+//! Iterate over a range of the list of GeoBox shape nodes, build them all, 
+//! and store their pointers
+void ReadGeoModel::buildShapes_Box(size_t firstRow, size_t lastRow)
+{
     // loop over the DB rows and build the shapes
-    for (const auto &row : m_shapes_Box)
+    for (size_t ii = firstRow; ii < lastRow; ++ii)
     {
-        // GeoModelIO::CppHelper::printStdVectorVariants(row); // DEBUG MSG
-        m_builderShape_Box->buildShape(row);
-    }
-    // m_builderShape_Box->printBuiltShapes(); // DEBUG MSG
-    if (nSize > 0) {
-        std::cout << "All " << nSize << " Shapes-Box have been built!\n";
+        // GeoModelIO::CppHelper::printStdVectorVariants(m_shapes_Box.getRow(ii)); // DEBUG MSG
+        m_builderShape_Box->buildShape(m_shapes_Box, ii);
     }
 }
 //! Iterate over the list of GeoEllipticalTube shape nodes, build them all, 
@@ -676,10 +648,10 @@ void ReadGeoModel::buildAllShapes_EllipticalTube()
     m_builderShape_EllipticalTube = new BuildGeoShapes_EllipticalTube(nSize);
 
     // loop over the DB rows and build the shapes
-    for (const auto &row : m_shapes_EllipticalTube)
+    for (size_t row = 0; row < m_shapes_EllipticalTube.size(); ++row)
     {
-        // GeoModelIO::CppHelper::printStdVectorVariants(row); // DEBUG MSG
-        m_builderShape_EllipticalTube->buildShape(row);
+        // GeoModelIO::CppHelper::printStdVectorVariants(m_shapes_EllipticalTube.getRow(row)); // DEBUG MSG
+        m_builderShape_EllipticalTube->buildShape(m_shapes_EllipticalTube, row);
     }
     // m_builderShape_EllipticalTube->printBuiltShapes(); // DEBUG MSG
     if (nSize > 0) {
@@ -694,10 +666,10 @@ void ReadGeoModel::buildAllShapes_Tube()
     size_t nSize = m_shapes_Tube.size();
     m_builderShape_Tube = new BuildGeoShapes_Tube(nSize);
     // loop over the DB rows and build the shapes
-    for (const auto &row : m_shapes_Tube)
+    for (size_t row = 0; row < m_shapes_Tube.size(); ++row)
     {
-        // GeoModelIO::CppHelper::printStdVectorVariants(row); // DEBUG MSG
-        m_builderShape_Tube->buildShape(row);
+        // GeoModelIO::CppHelper::printStdVectorVariants(m_shapes_Tube.getRow(row)); // DEBUG MSG
+        m_builderShape_Tube->buildShape(m_shapes_Tube, row);
     }
     // m_builderShape_Tube->printBuiltShapes(); // DEBUG MSG
     if (nSize > 0) {
@@ -713,10 +685,10 @@ void ReadGeoModel::buildAllShapes_Cons()
     size_t nSize = m_shapes_Cons.size();
     m_builderShape_Cons = new BuildGeoShapes_Cons(nSize);
     // loop over the DB rows and build the shapes
-    for (const auto &row : m_shapes_Cons)
+    for (size_t row = 0; row < m_shapes_Cons.size(); ++row)
     {
-        // GeoModelIO::CppHelper::printStdVectorVariants(row); // DEBUG MSG
-        m_builderShape_Cons->buildShape(row);
+        // GeoModelIO::CppHelper::printStdVectorVariants(m_shapes_Cons.getRow(row)); // DEBUG MSG
+        m_builderShape_Cons->buildShape(m_shapes_Cons, row);
     }
     // m_builderShape_Cons->printBuiltShapes(); // DEBUG MSG
     if (nSize > 0) {
@@ -731,10 +703,10 @@ void ReadGeoModel::buildAllShapes_Para()
     size_t nSize = m_shapes_Para.size();
     m_builderShape_Para = new BuildGeoShapes_Para(nSize);
     // loop over the DB rows and build the shapes
-    for (const auto &row : m_shapes_Para)
+    for (size_t row = 0; row < m_shapes_Para.size(); ++row)
     {
-        // GeoModelIO::CppHelper::printStdVectorVariants(row); // DEBUG MSG
-        m_builderShape_Para->buildShape(row);
+        // GeoModelIO::CppHelper::printStdVectorVariants(m_shapes_Para.getRow(row)); // DEBUG MSG
+        m_builderShape_Para->buildShape(m_shapes_Para, row);
     }
     // m_builderShape_Para->printBuiltShapes(); // DEBUG MSG
     if (nSize > 0) {
@@ -749,10 +721,10 @@ void ReadGeoModel::buildAllShapes_Trap()
     size_t nSize = m_shapes_Trap.size();
     m_builderShape_Trap = new BuildGeoShapes_Trap(nSize);
     // loop over the DB rows and build the shapes
-    for (const auto &row : m_shapes_Trap)
+    for (size_t row = 0; row < m_shapes_Trap.size(); ++row)
     {
-        // GeoModelIO::CppHelper::printStdVectorVariants(row); // DEBUG MSG
-        m_builderShape_Trap->buildShape(row);
+        // GeoModelIO::CppHelper::printStdVectorVariants(m_shapes_Trap.getRow(row)); // DEBUG MSG
+        m_builderShape_Trap->buildShape(m_shapes_Trap, row);
     }
     // m_builderShape_Trap->printBuiltShapes(); // DEBUG MSG
     if (nSize > 0) {
@@ -767,10 +739,10 @@ void ReadGeoModel::buildAllShapes_Trd()
     size_t nSize = m_shapes_Trd.size();
     m_builderShape_Trd = new BuildGeoShapes_Trd(nSize);
     // loop over the DB rows and build the shapes
-    for (const auto &row : m_shapes_Trd)
+    for (size_t row = 0; row < m_shapes_Trd.size(); ++row)
     {
-        // GeoModelIO::CppHelper::printStdVectorVariants(row); // DEBUG MSG
-        m_builderShape_Trd->buildShape(row);
+        // GeoModelIO::CppHelper::printStdVectorVariants(m_shapes_Trd.getRow(row)); // DEBUG MSG
+        m_builderShape_Trd->buildShape(m_shapes_Trd, row);
     }
     // m_builderShape_Trd->printBuiltShapes(); // DEBUG MSG
     if (nSize > 0) {
@@ -785,10 +757,10 @@ void ReadGeoModel::buildAllShapes_Tubs()
     size_t nSize = m_shapes_Tubs.size();
     m_builderShape_Tubs = new BuildGeoShapes_Tubs(nSize);
     // loop over the DB rows and build the shapes
-    for (const auto &row : m_shapes_Tubs)
+    for (size_t row = 0; row < m_shapes_Tubs.size(); ++row)
     {
-        // GeoModelIO::CppHelper::printStdVectorVariants(row); // DEBUG MSG
-        m_builderShape_Tubs->buildShape(row);
+        // GeoModelIO::CppHelper::printStdVectorVariants(m_shapes_Tubs.getRow(row)); // DEBUG MSG
+        m_builderShape_Tubs->buildShape(m_shapes_Tubs, row);
     }
     // m_builderShape_Tubs->printBuiltShapes(); // DEBUG MSG
     if (nSize > 0) {
@@ -803,10 +775,10 @@ void ReadGeoModel::buildAllShapes_Torus()
     size_t nSize = m_shapes_Torus.size();
     m_builderShape_Torus = new BuildGeoShapes_Torus(nSize);
     // loop over the DB rows and build the shapes
-    for (const auto &row : m_shapes_Torus)
+    for (size_t row = 0; row < m_shapes_Torus.size(); ++row)
     {
-        // GeoModelIO::CppHelper::printStdVectorVariants(row); // DEBUG MSG
-        m_builderShape_Torus->buildShape(row);
+        // GeoModelIO::CppHelper::printStdVectorVariants(m_shapes_Torus.getRow(row)); // DEBUG MSG
+        m_builderShape_Torus->buildShape(m_shapes_Torus, row);
     }
     // m_builderShape_Torus->printBuiltShapes(); // DEBUG MSG
     if (nSize > 0) {
@@ -821,10 +793,10 @@ void ReadGeoModel::buildAllShapes_TwistedTrap()
     size_t nSize = m_shapes_TwistedTrap.size();
     m_builderShape_TwistedTrap = new BuildGeoShapes_TwistedTrap(nSize);
     // loop over the DB rows and build the shapes
-    for (const auto &row : m_shapes_TwistedTrap)
+    for (size_t row = 0; row < m_shapes_TwistedTrap.size(); ++row)
     {
-        // GeoModelIO::CppHelper::printStdVectorVariants(row); // DEBUG MSG
-        m_builderShape_TwistedTrap->buildShape(row);
+        // GeoModelIO::CppHelper::printStdVectorVariants(m_shapes_TwistedTrap.getRow(row)); // DEBUG MSG
+        m_builderShape_TwistedTrap->buildShape(m_shapes_TwistedTrap, row);
     }
     // m_builderShape_TwistedTrap->printBuiltShapes(); // DEBUG MSG
     if (nSize > 0) {
@@ -839,10 +811,10 @@ void ReadGeoModel::buildAllShapes_Pcon()
     size_t nSize = m_shapes_Pcon.size();
     m_builderShape_Pcon = new BuildGeoShapes_Pcon(nSize, m_shapes_Pcon_data);
     // loop over the DB rows and build the shapes
-    for (const auto &row : m_shapes_Pcon)
+    for (size_t row = 0; row < m_shapes_Pcon.size(); ++row)
     {
-        // GeoModelIO::CppHelper::printStdVectorVariants(row); // DEBUG MSG
-        m_builderShape_Pcon->buildShape(row);
+        // GeoModelIO::CppHelper::printStdVectorVariants(m_shapes_Pcon.getRow(row)); // DEBUG MSG
+        m_builderShape_Pcon->buildShape(m_shapes_Pcon, row);
     }
     // m_builderShape_Pcon->printBuiltShapes(); // DEBUG MSG
     if (nSize > 0) {
@@ -857,10 +829,10 @@ void ReadGeoModel::buildAllShapes_Pgon()
     size_t nSize = m_shapes_Pgon.size();
     m_builderShape_Pgon = new BuildGeoShapes_Pgon(nSize, m_shapes_Pgon_data);
     // loop over the DB rows and build the shapes
-    for (const auto &row : m_shapes_Pgon)
+    for (size_t row = 0; row < m_shapes_Pgon.size(); ++row)
     {
-        // GeoModelIO::CppHelper::printStdVectorVariants(row); // DEBUG MSG
-        m_builderShape_Pgon->buildShape(row);
+        // GeoModelIO::CppHelper::printStdVectorVariants(m_shapes_Pgon.getRow(row)); // DEBUG MSG
+        m_builderShape_Pgon->buildShape(m_shapes_Pgon, row);
     }
     // m_builderShape_Pgon->printBuiltShapes(); // DEBUG MSG
     if (nSize > 0) {
@@ -875,10 +847,10 @@ void ReadGeoModel::buildAllShapes_SimplePolygonBrep()
     size_t nSize = m_shapes_SimplePolygonBrep.size();
     m_builderShape_SimplePolygonBrep = new BuildGeoShapes_SimplePolygonBrep(nSize, m_shapes_SimplePolygonBrep_data);
     // loop over the DB rows and build the shapes
-    for (const auto &row : m_shapes_SimplePolygonBrep)
+    for (size_t row = 0; row < m_shapes_SimplePolygonBrep.size(); ++row)
     {
-        // GeoModelIO::CppHelper::printStdVectorVariants(row); // DEBUG MSG
-        m_builderShape_SimplePolygonBrep->buildShape(row);
+        // GeoModelIO::CppHelper::printStdVectorVariants(m_shapes_SimplePolygonBrep.getRow(row)); // DEBUG MSG
+        m_builderShape_SimplePolygonBrep->buildShape(m_shapes_SimplePolygonBrep, row);
     }
     // m_builderShape_SimplePolygonBrep->printBuiltShapes(); // DEBUG MSG
     if (nSize > 0) {
@@ -894,10 +866,10 @@ void ReadGeoModel::buildAllShapes_GenericTrap()
     size_t nSize = m_shapes_GenericTrap.size();
     m_builderShape_GenericTrap = new BuildGeoShapes_GenericTrap(nSize, m_shapes_GenericTrap_data);
     // loop over the DB rows and build the shapes
-    for (const auto &row : m_shapes_GenericTrap)
+    for (size_t row = 0; row < m_shapes_GenericTrap.size(); ++row)
     {
-        // GeoModelIO::CppHelper::printStdVectorVariants(row); // DEBUG MSG
-        m_builderShape_GenericTrap->buildShape(row);
+        // GeoModelIO::CppHelper::printStdVectorVariants(m_shapes_GenericTrap.getRow(row)); // DEBUG MSG
+        m_builderShape_GenericTrap->buildShape(m_shapes_GenericTrap, row);
     }
     // m_builderShape_GenericTrap->printBuiltShapes(); // DEBUG MSG
     if (nSize > 0) {
@@ -913,10 +885,10 @@ void ReadGeoModel::buildAllShapes_UnidentifiedShape()
     size_t nSize = m_shapes_UnidentifiedShape.size();
     m_builderShape_UnidentifiedShape = new BuildGeoShapes_UnidentifiedShape(nSize);
     // loop over the DB rows and build the shapes
-    for (const auto &row : m_shapes_UnidentifiedShape)
+    for (size_t row = 0; row < m_shapes_UnidentifiedShape.size(); ++row)
     {
-        // GeoModelIO::CppHelper::printStdVectorVariants(row); // DEBUG MSG
-        m_builderShape_UnidentifiedShape->buildShape(row);
+        // GeoModelIO::CppHelper::printStdVectorVariants(m_shapes_UnidentifiedShape.getRow(row)); // DEBUG MSG
+        m_builderShape_UnidentifiedShape->buildShape(m_shapes_UnidentifiedShape, row);
     }
     // m_builderShape_UnidentifiedShape->printBuiltShapes(); // DEBUG MSG
     if (nSize > 0) {
@@ -1078,26 +1050,28 @@ void ReadGeoModel::buildAllLogVols()
 //   }
 // }
 
-//! Iterate over the list of nodes, build them all, and store their pointers
-void ReadGeoModel::buildAllPhysVols() {
+//! Reserve the cache of the PhysVols, so that they can be built concurrently
+void ReadGeoModel::preparePhysVols() {
     if (m_debug) std::cout << "Building all PhysVols...\n";
     if (m_physVols.size() == 0) {
         std::cout << "ERROR!!! No input PhysVols found! Exiting..."
                   << std::endl;
         exit(EXIT_FAILURE);
     }
-    const unsigned int tableID = m_tableName_toTableID["GeoPhysVol"];
-    size_t nSize = m_physVols.size();
-    m_memMapPhysVols.reserve(nSize);
-    for (unsigned int ii = 0; ii < nSize; ++ii) {
+    m_memMapPhysVols.assign(m_physVols.size(), nullptr);
+}
+
+//! Iterate over a range of the list of nodes, build them all, and store their
+//! pointers
+void ReadGeoModel::buildPhysVols(size_t firstRow, size_t lastRow) {
+    const unsigned int tableID = m_tableName_toTableID.at("GeoPhysVol");
+    for (size_t ii = firstRow; ii < lastRow; ++ii) {
         const unsigned int volID = std::stoi(m_physVols[ii][0]);
         const unsigned int logVolID = std::stoi(m_physVols[ii][1]);
         // std::cout << "building PhysVol n. " << volID << " (logVol: " <<
         // logVolID << ")" << std::endl;
         buildVPhysVol(volID, tableID, logVolID);
     }
-    if (nSize > 0)
-        std::cout << "All " << nSize << " PhysVols have been built!\n";
 }
 
 //! Iterate over the list of nodes, build them all, and store their pointers
@@ -1105,7 +1079,7 @@ void ReadGeoModel::buildAllFullPhysVols() {
     if (m_debug) std::cout << "Building all FullPhysVols...\n";
     const unsigned int tableID = m_tableName_toTableID["GeoFullPhysVol"];
     size_t nSize = m_fullPhysVols.size();
-    m_memMapFullPhysVols.reserve(nSize);
+    m_memMapFullPhysVols.assign(nSize, nullptr);
     for (unsigned int ii = 0; ii < nSize; ++ii) {
         const unsigned int volID = std::stoi(m_fullPhysVols[ii][0]);
         const unsigned int logVolID = std::stoi(m_fullPhysVols[ii][1]);
@@ -1195,7 +1169,7 @@ void ReadGeoModel::loopOverAllChildrenInBunches_VecVecData() {
                // test if you can optimize, then revert to if()...else()
     {
         // std::cout << "Running serially...\n";
-        loopOverAllChildrenRecords(m_allchildren);
+        loopOverAllChildrenRecords(m_allchildren, 0, m_allchildren.size());
     }
     // ...otherwise, let's spawn some threads to process them in bunches,
     // parallelly!
@@ -1233,22 +1207,10 @@ void ReadGeoModel::loopOverAllChildrenInBunches_VecVecData() {
         std::vector<std::future<void>> futures;
 
         for (unsigned int bb = 0; bb < nThreads; ++bb) {
-            DBRowsList bunch;
-
-            unsigned int start = nBunches * bb;
+            const unsigned int start = nBunches * bb;
             int len = nBunches;
-            const unsigned int stop = start + len;
-            DBRowsList::const_iterator first =
-                m_allchildren.begin() + start;
-            DBRowsList::const_iterator last =
-                m_allchildren.begin() + stop;
-            DBRowsList::const_iterator end =
-                m_allchildren.end();
-            if (bb == (nThreads - 1)) {  // last bunch
-                bunch = DBRowsList(first, end);
-            } else {  // all bunches but last one
-                bunch = DBRowsList(first, last);
-            }
+            // the last bunch takes all the remaining items
+            const size_t stop = (bb == (nThreads - 1)) ? m_allchildren.size() : start + len;
 
             if (m_loglevel >= 1) {
                 muxCout.lock();
@@ -1260,13 +1222,13 @@ void ReadGeoModel::loopOverAllChildrenInBunches_VecVecData() {
 
             if (m_loglevel >= 1) {
                 muxCout.lock();
-                std::cout << "'bunch' size: " << bunch.size() << std::endl;
+                std::cout << "'bunch' size: " << stop - start << std::endl;
                 muxCout.unlock();
             }
 
             futures.push_back(std::async(
                 std::launch::async, &ReadGeoModel::loopOverAllChildrenRecords,
-                this, bunch));
+                this, std::cref(m_allchildren), start, stop));
         }
 
         // wait for all async calls to complete
@@ -1395,7 +1357,7 @@ void ReadGeoModel::processParentChild(
     }
 }
 void ReadGeoModel::processParentChild(
-    const DBRowEntry& parentchild) {
+    const DBTable& records, size_t row) {
     
     // if (m_loglevel >= 2) {
     //     muxCout.lock();
@@ -1405,7 +1367,7 @@ void ReadGeoModel::processParentChild(
     //     muxCout.unlock();
     // }
     // safety check
-    if (parentchild.size() < 8) {
+    if (records.nColumns() < 8) {
         std::cout << "ERROR!!! Probably you are using an old geometry file. "
                      "Please, get a new one. Exiting..."
                   << std::endl;
@@ -1413,17 +1375,17 @@ void ReadGeoModel::processParentChild(
     }
 
     // get the parent's details
-    const unsigned int parentId = GeoModelHelpers::variantHelper::getFromVariant_Int(parentchild[1], "ParentChild:parentID");
-    const unsigned int parentTableId = GeoModelHelpers::variantHelper::getFromVariant_Int(parentchild[2], "ParentChild:parentID"); 
-    const unsigned int parentCopyN = GeoModelHelpers::variantHelper::getFromVariant_Int(parentchild[3], "ParentChild:parentID"); 
+    const unsigned int parentId = records.getInt(row, 1, "ParentChild:parentID");
+    const unsigned int parentTableId = records.getInt(row, 2, "ParentChild:parentID"); 
+    const unsigned int parentCopyN = records.getInt(row, 3, "ParentChild:parentID"); 
 
     // get the child's position in the parent's children list
-    // const unsigned int position = parentchild[4]; // unused, at the moment
+    // const unsigned int position = records.getInt(row, 4); // unused, at the moment
 
     // get the child's details
-    const unsigned int childTableId = GeoModelHelpers::variantHelper::getFromVariant_Int(parentchild[5], "ParentChild:parentID"); 
-    const unsigned int childId = GeoModelHelpers::variantHelper::getFromVariant_Int(parentchild[6], "ParentChild:parentID"); 
-    const unsigned int childCopyN = GeoModelHelpers::variantHelper::getFromVariant_Int(parentchild[7], "ParentChild:parentID"); 
+    const unsigned int childTableId = records.getInt(row, 5, "ParentChild:parentID"); 
+    const unsigned int childId = records.getInt(row, 6, "ParentChild:parentID"); 
+    const unsigned int childCopyN = records.getInt(row, 7, "ParentChild:parentID"); 
 
     //    std::string childNodeType =
     //    m_tableID_toTableName[childTableId].toStdString();
@@ -1625,7 +1587,10 @@ GeoVPhysVol* ReadGeoModel::buildVPhysVol(
         muxCout.unlock();
     }
 
-    std::string nodeType = m_tableID_toTableName[tableId];
+    // NOTE: 'find()' does not modify the map, and it is safe to call
+    // concurrently, while 'operator[]' is not
+    const auto typeItr = m_tableID_toTableName.find(tableId);
+    const std::string nodeType = typeItr != m_tableID_toTableName.end() ? typeItr->second : "";
 
     bool errorType = false;
 
@@ -1680,11 +1645,11 @@ GeoVPhysVol* ReadGeoModel::buildVPhysVol(
     // BUILD THE PHYSVOL OR THE FULLPHYSVOL
     if (nodeType == "GeoPhysVol") {
         GeoPhysVol* pVol = new GeoPhysVol(logVol);
-        storeBuiltPhysVol(pVol);
+        storeBuiltPhysVol(id, pVol);
         vol = pVol;
     } else if (nodeType == "GeoFullPhysVol") {
         GeoFullPhysVol* fpVol = new GeoFullPhysVol(logVol);
-        storeBuiltFullPhysVol(fpVol);
+        storeBuiltFullPhysVol(id, fpVol);
         vol = fpVol;
     } else
         errorType = true;
@@ -3660,14 +3625,13 @@ GeoLogVol* ReadGeoModel::getBuiltLog(const unsigned int id) {
 }
 
 // --- methods for caching GeoPhysVol nodes ---
+// NOTE: the cache is sized beforehand, so that volumes can be stored
+// concurrently at the position given by their IDs
 bool ReadGeoModel::isBuiltPhysVol(const unsigned int id) {
-    return (id <=
-            m_memMapPhysVols.size());  // vector: we exploit the fact that we
-                                       // built the vols ordered by their IDs
+    return (id > 0 && id <= m_memMapPhysVols.size() && m_memMapPhysVols[id - 1]);
 }
-void ReadGeoModel::storeBuiltPhysVol(GeoPhysVol* nodePtr) {
-    m_memMapPhysVols.push_back(nodePtr);  // vector: we exploit the fact that we
-                                          // built the vols ordered by their IDs
+void ReadGeoModel::storeBuiltPhysVol(const unsigned int id, GeoPhysVol* nodePtr) {
+    m_memMapPhysVols[id - 1] = nodePtr;  // nodes' IDs start from 1
 }
 GeoPhysVol* ReadGeoModel::getBuiltPhysVol(const unsigned int id) {
     return m_memMapPhysVols[id - 1];  // nodes' IDs start from 1
@@ -3675,14 +3639,10 @@ GeoPhysVol* ReadGeoModel::getBuiltPhysVol(const unsigned int id) {
 
 // --- methods for caching GeoFullPhysVol nodes ---
 bool ReadGeoModel::isBuiltFullPhysVol(const unsigned int id) {
-    return (
-        id <=
-        m_memMapFullPhysVols.size());  // vector: we exploit the fact that we
-                                       // built the vols ordered by their IDs
+    return (id > 0 && id <= m_memMapFullPhysVols.size() && m_memMapFullPhysVols[id - 1]);
 }
-void ReadGeoModel::storeBuiltFullPhysVol(GeoFullPhysVol* nodePtr) {
-    m_memMapFullPhysVols.push_back(
-        nodePtr);  // vector, we store them in the order of IDs
+void ReadGeoModel::storeBuiltFullPhysVol(const unsigned int id, GeoFullPhysVol* nodePtr) {
+    m_memMapFullPhysVols[id - 1] = nodePtr;  // nodes' IDs start from 1
 }
 GeoFullPhysVol* ReadGeoModel::getBuiltFullPhysVol(const unsigned int id) {
     return m_memMapFullPhysVols[id - 1];  // nodes' IDs start from 1
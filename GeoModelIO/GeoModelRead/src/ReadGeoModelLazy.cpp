@@ -0,0 +1,527 @@
+/*
+  Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+*/
+
+/*
+ * ReadGeoModelLazy.cpp
+ *
+ * The lazy mode of ReadGeoModel: only the root volume is built upfront,
+ * the other nodes are built from the in-memory tables when the daughters
+ * of their parent volume are accessed for the first time.
+ *
+ * The nodes are built in any order, hence they are not stored in the caches
+ * used by buildGeoModel(), which rely on the nodes being built by ID order;
+ * they are kept in the LazyCache, instead, together with an index of the
+ * ChildrenPositions table by parent volume.
+ *
+ */
+
+#include "GeoModelRead/ReadGeoModel.h"
+
+// local includes
+#include "BuildGeoShapes_Box.h"
+#include "BuildGeoShapes_EllipticalTube.h"
+#include "BuildGeoShapes_Tube.h"
+#include "BuildGeoShapes_Cons.h"
+#include "BuildGeoShapes_Para.h"
+#include "BuildGeoShapes_Pcon.h"
+#include "BuildGeoShapes_Pgon.h"
+#include "BuildGeoShapes_Trap.h"
+#include "BuildGeoShapes_Trd.h"
+#include "BuildGeoShapes_Tubs.h"
+#include "BuildGeoShapes_Torus.h"
+#include "BuildGeoShapes_TwistedTrap.h"
+#include "BuildGeoShapes_SimplePolygonBrep.h"
+#include "BuildGeoShapes_GenericTrap.h"
+#include "BuildGeoShapes_UnidentifiedShape.h"
+#include "BuildGeoVSurface.h"
+
+// GeoModelKernel includes
+#include "GeoModelKernel/GeoAlignableTransform.h"
+#include "GeoModelKernel/GeoElement.h"
+#include "GeoModelKernel/GeoFullPhysVol.h"
+#include "GeoModelKernel/GeoIdentifierTag.h"
+#include "GeoModelKernel/GeoLogVol.h"
+#include "GeoModelKernel/GeoMaterial.h"
+#include "GeoModelKernel/GeoNameTag.h"
+#include "GeoModelKernel/GeoPhysVol.h"
+#include "GeoModelKernel/GeoSerialDenominator.h"
+#include "GeoModelKernel/GeoSerialIdentifier.h"
+#include "GeoModelKernel/GeoSerialTransformer.h"
+#include "GeoModelKernel/GeoShapeIntersection.h"
+#include "GeoModelKernel/GeoShapeShift.h"
+#include "GeoModelKernel/GeoShapeSubtraction.h"
+#include "GeoModelKernel/GeoShapeUnion.h"
+#include "GeoModelKernel/GeoTransform.h"
+#include "GeoModelKernel/GeoVSurface.h"
+#include "GeoModelKernel/throwExcept.h"
+
+#include "GeoModelHelpers/variantHelpers.h"
+
+// C++ includes
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    /// The kinds of the nodes kept in the LazyCache; each shape type has
+    /// its own kind, starting from 'Shape'
+    enum LazyKind : std::uint32_t {
+        LogVol, Material, Element, Transform, AlignableTransform,
+        SerialDenominator, SerialIdentifier, IdentifierTag, NameTag,
+        VSurface, Shape
+    };
+    const std::vector<std::string_view> lazyShapeTypes{
+        "Box", "EllipticalTube", "Tube", "Cons", "Para", "Trap", "Trd", "Tubs",
+        "Torus", "TwistedTrap", "Pcon", "Pgon", "SimplePolygonBrep", "GenericTrap",
+        "UnidentifiedShape", "Shift", "Subtraction", "Intersection", "Union"};
+
+    std::uint64_t lazyKey(const std::uint32_t high, const unsigned id) {
+        return (static_cast<std::uint64_t>(high) << 32) | id;
+    }
+
+    /// Return the row of the node 'id' from one of the tables of nodes
+    template <class Rows>
+    const typename Rows::value_type& rowOfNode(const Rows& rows, const unsigned id,
+                                                const std::string& nodeType) {
+        if (id == 0 || id > rows.size()) {
+            THROW_EXCEPTION("ERROR!! The " + nodeType + " node of ID " + std::to_string(id) +
+                            " is not in the DB!");
+        }
+        return rows[id - 1];  // nodes' IDs start from 1
+    }
+
+    /// Convert the 12 matrix elements of a Transform or AlignableTransform
+    /// row, which follow the node's ID, to a transformation
+    GeoTrf::Transform3D toTransform3D(const std::vector<std::string>& values) {
+        GeoTrf::Transform3D txf;
+        for (unsigned ii = 0; ii < 3; ++ii) {
+            for (unsigned jj = 0; jj < 3; ++jj) {
+                txf(ii, jj) = std::stod(values[1 + 3 * ii + jj]);
+            }
+            txf(ii, 3) = std::stod(values[10 + ii]);
+        }
+        return txf;
+    }
+}  // namespace
+
+namespace GeoModelIO {
+
+struct ReadGeoModel::LazyCache {
+    std::recursive_mutex mutex{};
+    /// The rows of m_allchildren, grouped by parent volume, in their order
+    std::vector<std::uint32_t> childrenRows{};
+    /// The range in 'childrenRows' of each parent, keyed by (table ID, volume ID)
+    std::unordered_map<std::uint64_t, std::pair<std::size_t, std::size_t>> childrenRanges{};
+    /// The nodes built so far, keyed by (kind, ID); they are shared by all
+    /// the volumes referencing them, and kept alive as long as the cache
+    std::unordered_map<std::uint64_t, GeoIntrusivePtr<RCBase>> nodes{};
+    /// The volume instances which are alive, keyed by (table ID, volume ID);
+    /// each volume removes itself when it is deleted
+    std::unordered_map<std::uint64_t, GeoVPhysVol*> volumes{};
+    BuildGeoVSurface surfaceBuilder{};
+
+    template <class NodeType>
+    NodeType* find(const std::uint32_t kind, const unsigned id) const {
+        auto it = nodes.find(lazyKey(kind, id));
+        return it != nodes.end() ? static_cast<NodeType*>(it->second.get()) : nullptr;
+    }
+    template <class NodeType>
+    NodeType* store(const std::uint32_t kind, const unsigned id, NodeType* node) {
+        nodes.emplace(lazyKey(kind, id), node);
+        return node;
+    }
+};
+
+/// Builds the daughters of a volume when they are first accessed. The loader
+/// keeps the reader alive, and it removes the volume from the reader's cache
+/// when the volume is deleted.
+class ReadGeoModel::LazyDaughterLoader : public GeoVPhysVol::DaughterLoader {
+   public:
+    LazyDaughterLoader(std::shared_ptr<ReadGeoModel> reader, const unsigned id,
+                       const unsigned tableId, const GeoVPhysVol* vol)
+        : m_reader(std::move(reader)), m_id(id), m_tableId(tableId), m_vol(vol) {}
+    ~LazyDaughterLoader() override {
+        m_reader->releaseVPhysVolLazy(m_id, m_tableId, m_vol);
+    }
+    void loadDaughters(GeoVPhysVol& volume) override {
+        for (const GeoIntrusivePtr<GeoGraphNode>& child : m_reader->loadDaughtersLazy(m_id, m_tableId, m_reader)) {
+            appendDaughter(volume, child);
+        }
+    }
+
+   private:
+    std::shared_ptr<ReadGeoModel> m_reader;
+    unsigned m_id;
+    unsigned m_tableId;
+    const GeoVPhysVol* m_vol;
+};
+
+const GeoVPhysVol* ReadGeoModel::buildGeoModelLazy(GMDBManager* db, unsigned loglevel) {
+    // the reader is owned by the volumes built from it
+    std::shared_ptr<ReadGeoModel> reader = std::make_shared<ReadGeoModel>(db);
+    if (loglevel > 0) {
+        reader->setLogLevel(loglevel);
+    }
+    if (reader->m_loglevel >= 1) {
+        std::cout << "ReadGeoModel::buildGeoModelLazy() - the nodes will be built on demand"
+                  << std::endl;
+    }
+    reader->prepareLazyBuild();
+
+    std::lock_guard<std::recursive_mutex> lk(reader->m_lazy->mutex);
+    const unsigned tableId = reader->m_root_vol_data.first;
+    const unsigned id = reader->m_root_vol_data.second;
+    return reader->buildVPhysVolLazy(id, tableId, reader);
+}
+
+void ReadGeoModel::prepareLazyBuild() {
+    // safety check
+    if (m_allchildren.size() > 0 && m_allchildren.nColumns() < 8) {
+        THROW_EXCEPTION("ERROR!!! Probably you are using an old geometry file. Please, get a new one.");
+    }
+    m_lazy = std::make_shared<LazyCache>();
+
+    // Group the rows of the children table by parent volume. Rows are
+    // usually sorted by parent already; if not, a stable sort keeps the
+    // children of each parent in their order.
+    const size_t nRows = m_allchildren.size();
+    std::vector<std::uint64_t> parents(nRows);
+    for (size_t row = 0; row < nRows; ++row) {
+        parents[row] = lazyKey(m_allchildren.getInt(row, 2, "ParentChild:parentTable"),
+                               m_allchildren.getInt(row, 1, "ParentChild:parentID"));
+    }
+    std::vector<std::uint32_t>& rows = m_lazy->childrenRows;
+    rows.resize(nRows);
+    std::iota(rows.begin(), rows.end(), 0);
+    if (!std::is_sorted(parents.begin(), parents.end())) {
+        std::stable_sort(rows.begin(), rows.end(), [&parents](std::uint32_t a, std::uint32_t b) {
+            return parents[a] < parents[b];
+        });
+    }
+    for (size_t first = 0; first < nRows;) {
+        const std::uint64_t parent = parents[rows[first]];
+        size_t last = first + 1;
+        while (last < nRows && parents[rows[last]] == parent) ++last;
+        m_lazy->childrenRanges.emplace(parent, std::make_pair(first, last));
+        first = last;
+    }
+}
+
+GeoVPhysVol* ReadGeoModel::buildVPhysVolLazy(const unsigned id, const unsigned tableId,
+                                             const std::shared_ptr<ReadGeoModel>& self) {
+    const std::uint64_t key = lazyKey(tableId, id);
+    auto volItr = m_lazy->volumes.find(key);
+    if (volItr != m_lazy->volumes.end()) {
+        return volItr->second;
+    }
+
+    const auto typeItr = m_tableID_toTableName.find(tableId);
+    const std::string nodeType = typeItr != m_tableID_toTableName.end() ? typeItr->second : "";
+    const bool isFullPhysVol = (nodeType == "GeoFullPhysVol");
+    if (!isFullPhysVol && nodeType != "GeoPhysVol") {
+        THROW_EXCEPTION("ERROR!! The volume of ID " + std::to_string(id) + " has type '" + nodeType +
+                        "', while only GeoPhysVol and GeoFullPhysVol are handled!");
+    }
+    const std::vector<std::string>& values =
+        rowOfNode(isFullPhysVol ? m_fullPhysVols : m_physVols, id, nodeType);
+    GeoLogVol* logVol = buildLogVolLazy(std::stoi(values[1]));
+
+    GeoVPhysVol* vol = nullptr;
+    if (isFullPhysVol) {
+        vol = new GeoFullPhysVol(logVol);
+    } else {
+        vol = new GeoPhysVol(logVol);
+    }
+    vol->setDaughterLoader(std::make_unique<LazyDaughterLoader>(self, id, tableId, vol));
+    m_lazy->volumes.emplace(key, vol);
+    if (m_loglevel >= 3) {
+        std::cout << "ReadGeoModel::buildVPhysVolLazy() - built " << nodeType << " " << id
+                  << " -- logvol: " << logVol->getName() << std::endl;
+    }
+    return vol;
+}
+
+std::vector<GeoIntrusivePtr<GeoGraphNode>> ReadGeoModel::loadDaughtersLazy(
+    const unsigned id, const unsigned tableId, const std::shared_ptr<ReadGeoModel>& self) {
+    std::lock_guard<std::recursive_mutex> lk(m_lazy->mutex);
+    std::vector<GeoIntrusivePtr<GeoGraphNode>> children{};
+    const auto rangeItr = m_lazy->childrenRanges.find(lazyKey(tableId, id));
+    if (rangeItr == m_lazy->childrenRanges.end()) {
+        return children;  // a leaf volume
+    }
+    children.reserve(rangeItr->second.second - rangeItr->second.first);
+    // As in buildGeoModel(), the children of all the copies of the
+    // parent are added to its single instance
+    for (size_t kk = rangeItr->second.first; kk < rangeItr->second.second; ++kk) {
+        const size_t row = m_lazy->childrenRows[kk];
+        const unsigned childTableId = m_allchildren.getInt(row, 5, "ParentChild:childTable");
+        const unsigned childId = m_allchildren.getInt(row, 6, "ParentChild:childId");
+        const auto typeItr = m_tableID_toTableName.find(childTableId);
+        if (typeItr == m_tableID_toTableName.end()) {
+            THROW_EXCEPTION("ERROR!!! Unknown table ID for a child node: " + std::to_string(childTableId));
+        }
+        const std::string& childType = typeItr->second;
+        GeoGraphNode* child = nullptr;
+        if (childType == "GeoPhysVol" || childType == "GeoFullPhysVol") {
+            child = buildVPhysVolLazy(childId, childTableId, self);
+        } else {
+            child = buildNodeLazy(childType, childId, self);
+        }
+        children.emplace_back(child);
+    }
+    return children;
+}
+
+void ReadGeoModel::releaseVPhysVolLazy(const unsigned id, const unsigned tableId,
+                                       const GeoVPhysVol* vol) {
+    std::lock_guard<std::recursive_mutex> lk(m_lazy->mutex);
+    auto volItr = m_lazy->volumes.find(lazyKey(tableId, id));
+    if (volItr != m_lazy->volumes.end() && volItr->second == vol) {
+        m_lazy->volumes.erase(volItr);
+    }
+}
+
+GeoGraphNode* ReadGeoModel::buildNodeLazy(const std::string& nodeType, const unsigned id,
+                                          const std::shared_ptr<ReadGeoModel>& self) {
+    LazyCache& cache = *m_lazy;
+    if ("GeoTransform" == nodeType) {
+        if (GeoTransform* node = cache.find<GeoTransform>(Transform, id)) return node;
+        return cache.store(Transform, id, new GeoTransform(toTransform3D(rowOfNode(m_transforms, id, nodeType))));
+    } else if ("GeoAlignableTransform" == nodeType) {
+        if (GeoAlignableTransform* node = cache.find<GeoAlignableTransform>(AlignableTransform, id)) return node;
+        return cache.store(AlignableTransform, id,
+                           new GeoAlignableTransform(toTransform3D(rowOfNode(m_alignableTransforms, id, nodeType))));
+    } else if ("GeoNameTag" == nodeType) {
+        if (GeoNameTag* node = cache.find<GeoNameTag>(NameTag, id)) return node;
+        return cache.store(NameTag, id, new GeoNameTag(rowOfNode(m_nameTags, id, nodeType)[1]));
+    } else if ("GeoSerialDenominator" == nodeType) {
+        if (GeoSerialDenominator* node = cache.find<GeoSerialDenominator>(SerialDenominator, id)) return node;
+        return cache.store(SerialDenominator, id,
+                           new GeoSerialDenominator(rowOfNode(m_serialDenominators, id, nodeType)[1]));
+    } else if ("GeoSerialIdentifier" == nodeType) {
+        if (GeoSerialIdentifier* node = cache.find<GeoSerialIdentifier>(SerialIdentifier, id)) return node;
+        return cache.store(SerialIdentifier, id,
+                           new GeoSerialIdentifier(std::stoi(rowOfNode(m_serialIdentifiers, id, nodeType)[1])));
+    } else if ("GeoIdentifierTag" == nodeType) {
+        if (GeoIdentifierTag* node = cache.find<GeoIdentifierTag>(IdentifierTag, id)) return node;
+        return cache.store(IdentifierTag, id,
+                           new GeoIdentifierTag(std::stoi(rowOfNode(m_identifierTags, id, nodeType)[1])));
+    } else if ("GeoVSurface" == nodeType) {
+        return buildVSurfaceLazy(id);
+    } else if ("GeoSerialTransformer" == nodeType) {
+        // Serial transformers are not cached: they hold their volume, and
+        // through its daughter loader, the reader itself.
+        const std::vector<std::string>& values = rowOfNode(m_serialTransformers, id, nodeType);
+        const unsigned functionId = std::stoi(values[1]);
+        const unsigned physVolId = std::stoi(values[2]);
+        const unsigned physVolTableId = std::stoi(values[3]);
+        const unsigned copies = std::stoi(values[4]);
+        TRANSFUNCTION func = buildFunction(functionId);
+        GeoSerialTransformer* node =
+            new GeoSerialTransformer(buildVPhysVolLazy(physVolId, physVolTableId, self), &func, copies);
+        delete &func;  // the serial transformer stores a clone of the function
+        return node;
+    }
+    THROW_EXCEPTION("[" + nodeType + "] ==> ERROR!!! - The conversion for this type of child node needs to be implemented.");
+}
+
+GeoLogVol* ReadGeoModel::buildLogVolLazy(const unsigned id) {
+    if (GeoLogVol* logVol = m_lazy->find<GeoLogVol>(LogVol, id)) {
+        return logVol;
+    }
+    const DBRowEntry& values = rowOfNode(m_logVols, id, "GeoLogVol");
+    const std::string logVolName = GeoModelHelpers::variantHelper::getFromVariant_String(values[1], "LogVol_name");
+    const int shapeId = GeoModelHelpers::variantHelper::getFromVariant_Int(values[2], "LogVol_shapeID");
+    const std::string shapeType = GeoModelHelpers::variantHelper::getFromVariant_String(values[3], "LogVol_shapeType");
+    const int matId = GeoModelHelpers::variantHelper::getFromVariant_Int(values[4], "LogVol_MaterialID");
+    return m_lazy->store(LogVol, id, new GeoLogVol(logVolName, buildShapeLazy(shapeType, shapeId),
+                                                   buildMaterialLazy(matId)));
+}
+
+BuildGeoShapes* ReadGeoModel::getShapeBuilderLazy(const std::string_view shapeType, const DBTable*& shapes) {
+    // the builders are created at the first shape of their type
+    if ("Box" == shapeType) {
+        shapes = &m_shapes_Box;
+        if (!m_builderShape_Box) m_builderShape_Box = new BuildGeoShapes_Box(0);
+        return m_builderShape_Box;
+    } else if ("EllipticalTube" == shapeType) {
+        shapes = &m_shapes_EllipticalTube;
+        if (!m_builderShape_EllipticalTube) m_builderShape_EllipticalTube = new BuildGeoShapes_EllipticalTube(0);
+        return m_builderShape_EllipticalTube;
+    } else if ("Tube" == shapeType) {
+        shapes = &m_shapes_Tube;
+        if (!m_builderShape_Tube) m_builderShape_Tube = new BuildGeoShapes_Tube(0);
+        return m_builderShape_Tube;
+    } else if ("Cons" == shapeType) {
+        shapes = &m_shapes_Cons;
+        if (!m_builderShape_Cons) m_builderShape_Cons = new BuildGeoShapes_Cons(0);
+        return m_builderShape_Cons;
+    } else if ("Para" == shapeType) {
+        shapes = &m_shapes_Para;
+        if (!m_builderShape_Para) m_builderShape_Para = new BuildGeoShapes_Para(0);
+        return m_builderShape_Para;
+    } else if ("Trap" == shapeType) {
+        shapes = &m_shapes_Trap;
+        if (!m_builderShape_Trap) m_builderShape_Trap = new BuildGeoShapes_Trap(0);
+        return m_builderShape_Trap;
+    } else if ("Trd" == shapeType) {
+        shapes = &m_shapes_Trd;
+        if (!m_builderShape_Trd) m_builderShape_Trd = new BuildGeoShapes_Trd(0);
+        return m_builderShape_Trd;
+    } else if ("Tubs" == shapeType) {
+        shapes = &m_shapes_Tubs;
+        if (!m_builderShape_Tubs) m_builderShape_Tubs = new BuildGeoShapes_Tubs(0);
+        return m_builderShape_Tubs;
+    } else if ("Torus" == shapeType) {
+        shapes = &m_shapes_Torus;
+        if (!m_builderShape_Torus) m_builderShape_Torus = new BuildGeoShapes_Torus(0);
+        return m_builderShape_Torus;
+    } else if ("TwistedTrap" == shapeType) {
+        shapes = &m_shapes_TwistedTrap;
+        if (!m_builderShape_TwistedTrap) m_builderShape_TwistedTrap = new BuildGeoShapes_TwistedTrap(0);
+        return m_builderShape_TwistedTrap;
+    } else if ("UnidentifiedShape" == shapeType) {
+        shapes = &m_shapes_UnidentifiedShape;
+        if (!m_builderShape_UnidentifiedShape) m_builderShape_UnidentifiedShape = new BuildGeoShapes_UnidentifiedShape(0);
+        return m_builderShape_UnidentifiedShape;
+    } else if ("Pcon" == shapeType) {
+        shapes = &m_shapes_Pcon;
+        if (!m_builderShape_Pcon) m_builderShape_Pcon = new BuildGeoShapes_Pcon(0, m_shapes_Pcon_data);
+        return m_builderShape_Pcon;
+    } else if ("Pgon" == shapeType) {
+        shapes = &m_shapes_Pgon;
+        if (!m_builderShape_Pgon) m_builderShape_Pgon = new BuildGeoShapes_Pgon(0, m_shapes_Pgon_data);
+        return m_builderShape_Pgon;
+    } else if ("SimplePolygonBrep" == shapeType) {
+        shapes = &m_shapes_SimplePolygonBrep;
+        if (!m_builderShape_SimplePolygonBrep)
+            m_builderShape_SimplePolygonBrep = new BuildGeoShapes_SimplePolygonBrep(0, m_shapes_SimplePolygonBrep_data);
+        return m_builderShape_SimplePolygonBrep;
+    } else if ("GenericTrap" == shapeType) {
+        shapes = &m_shapes_GenericTrap;
+        if (!m_builderShape_GenericTrap)
+            m_builderShape_GenericTrap = new BuildGeoShapes_GenericTrap(0, m_shapes_GenericTrap_data);
+        return m_builderShape_GenericTrap;
+    }
+    return nullptr;  // shape operators and boolean shapes
+}
+
+GeoShape* ReadGeoModel::buildShapeLazy(const std::string_view shapeType, const unsigned id) {
+    const auto typeItr = std::find(lazyShapeTypes.begin(), lazyShapeTypes.end(), shapeType);
+    if (typeItr == lazyShapeTypes.end()) {
+        THROW_EXCEPTION("ERROR!!! Shape '" + std::string(shapeType) + "' is not handled correctly!");
+    }
+    const std::uint32_t kind = Shape + (typeItr - lazyShapeTypes.begin());
+    if (GeoShape* shape = m_lazy->find<GeoShape>(kind, id)) {
+        return shape;
+    }
+
+    GeoShape* shape = nullptr;
+    const DBTable* shapes = nullptr;
+    if (BuildGeoShapes* builder = getShapeBuilderLazy(shapeType, shapes)) {
+        const size_t row = id - 1;  // shapes' IDs start from 1
+        if (id == 0 || row >= shapes->size() ||
+            static_cast<unsigned>(shapes->getInt(row, 0, "Shape:shapeID")) != id) {
+            THROW_EXCEPTION("ERROR!! The " + std::string(shapeType) + " shape of ID " + std::to_string(id) +
+                            " is not in the DB!");
+        }
+        builder->buildShape(*shapes, row);
+        shape = builder->getBuiltShape(id);
+    } else if ("Shift" == shapeType) {
+        const DBRowEntry& row = rowOfNode(m_shapes_Shift, id, "GeoShapeShift");
+        const std::string shapeOpType = GeoModelHelpers::variantHelper::getFromVariant_String(row[2], "Shift:shapeType");
+        const unsigned shapeOpId = GeoModelHelpers::variantHelper::getFromVariant_Int(row[3], "Shift:shapeId");
+        const unsigned transfId = GeoModelHelpers::variantHelper::getFromVariant_Int(row[4], "Shift:transformId");
+        // the shift is stored as a GeoTransform node, but only its matrix is needed
+        shape = new GeoShapeShift(buildShapeLazy(shapeOpType, shapeOpId),
+                                  toTransform3D(rowOfNode(m_transforms, transfId, "GeoTransform")));
+    } else {
+        const DBRowsList& booleans = ("Subtraction" == shapeType) ? m_shapes_Subtraction
+                                   : ("Union" == shapeType)       ? m_shapes_Union
+                                                                  : m_shapes_Intersection;
+        const DBRowEntry& row = rowOfNode(booleans, id, "GeoShape" + std::string(shapeType));
+        const std::string shapeOpAType = GeoModelHelpers::variantHelper::getFromVariant_String(row[2], "Boolean:shapeType");
+        const unsigned shapeOpAId = GeoModelHelpers::variantHelper::getFromVariant_Int(row[3], "Boolean:shapeId");
+        const std::string shapeOpBType = GeoModelHelpers::variantHelper::getFromVariant_String(row[4], "Boolean:shapeType");
+        const unsigned shapeOpBId = GeoModelHelpers::variantHelper::getFromVariant_Int(row[5], "Boolean:shapeId");
+        const GeoShape* shapeA = buildShapeLazy(shapeOpAType, shapeOpAId);
+        const GeoShape* shapeB = buildShapeLazy(shapeOpBType, shapeOpBId);
+        if ("Subtraction" == shapeType) {
+            shape = new GeoShapeSubtraction(shapeA, shapeB);
+        } else if ("Union" == shapeType) {
+            shape = new GeoShapeUnion(shapeA, shapeB);
+        } else {
+            shape = new GeoShapeIntersection(shapeA, shapeB);
+        }
+    }
+    if (!shape) {
+        THROW_EXCEPTION("ERROR!! The " + std::string(shapeType) + " shape of ID " + std::to_string(id) +
+                        " could not be built!");
+    }
+    return m_lazy->store(kind, id, shape);
+}
+
+GeoMaterial* ReadGeoModel::buildMaterialLazy(const unsigned id) {
+    if (GeoMaterial* mat = m_lazy->find<GeoMaterial>(Material, id)) {
+        return mat;
+    }
+    const DBRowEntry& values = rowOfNode(m_materials, id, "GeoMaterial");
+    const std::string matName = GeoModelHelpers::variantHelper::getFromVariant_String(values[1], "Material:matName");
+    const double matDensity = GeoModelHelpers::variantHelper::getFromVariant_Double(values[2], "Material:matDensity");
+    const unsigned dataStart = GeoModelHelpers::variantHelper::getFromVariant_Int(values[3], "Material:dataStart");
+    const unsigned dataEnd = GeoModelHelpers::variantHelper::getFromVariant_Int(values[4], "Material:dataEnd");
+
+    GeoMaterial* mat = new GeoMaterial(matName, matDensity);
+    // the elements are stored in the rows [dataStart-1, dataEnd) of the data table
+    if (dataStart > 0 && dataEnd >= dataStart) {
+        for (unsigned row = dataStart - 1; row < dataEnd && row < m_materials_Data.size(); ++row) {
+            const unsigned elId = GeoModelHelpers::variantHelper::getFromVariant_Int(m_materials_Data[row][1], "MatElement:id");
+            const double elFraction = GeoModelHelpers::variantHelper::getFromVariant_Double(m_materials_Data[row][2], "MatElement:fraction");
+            mat->add(buildElementLazy(elId), elFraction);
+        }
+        mat->lock();
+    }
+    return m_lazy->store(Material, id, mat);
+}
+
+GeoElement* ReadGeoModel::buildElementLazy(const unsigned id) {
+    if (GeoElement* elem = m_lazy->find<GeoElement>(Element, id)) {
+        return elem;
+    }
+    const DBRowEntry& values = rowOfNode(m_elements, id, "GeoElement");
+    const std::string elName = GeoModelHelpers::variantHelper::getFromVariant_String(values[1], "Element:name");
+    const std::string elSymbol = GeoModelHelpers::variantHelper::getFromVariant_String(values[2], "Element:symbol");
+    const double elZ = GeoModelHelpers::variantHelper::getFromVariant_Double(values[3], "Element:Z");
+    const double elA = GeoModelHelpers::variantHelper::getFromVariant_Double(values[4], "Element:A");
+    return m_lazy->store(Element, id, new GeoElement(elName, elSymbol, elZ, elA));
+}
+
+GeoVSurface* ReadGeoModel::buildVSurfaceLazy(const unsigned id) {
+    if (GeoVSurface* surf = m_lazy->find<GeoVSurface>(VSurface, id)) {
+        return surf;
+    }
+    const DBRowEntry& values = rowOfNode(m_VSurface, id, "GeoVSurface");
+    const std::string shapeType = GeoModelHelpers::variantHelper::getFromVariant_String(values[1], "VSurf_shapeType");
+    const unsigned shapeId = GeoModelHelpers::variantHelper::getFromVariant_Int(values[2], "VSurf_shapeID");
+    GeoVSurfaceShape* surfShape = nullptr;
+    if ("RectangleSurface" == shapeType) {
+        surfShape = m_lazy->surfaceBuilder.buildRectSurface(rowOfNode(m_rectangle_surface, shapeId, shapeType));
+    } else if ("TrapezoidSurface" == shapeType) {
+        surfShape = m_lazy->surfaceBuilder.buildTrapezoidSurface(rowOfNode(m_trapezoid_surface, shapeId, shapeType));
+    } else if ("AnnulusSurface" == shapeType) {
+        surfShape = m_lazy->surfaceBuilder.buildAnnulusSurface(rowOfNode(m_annulus_surface, shapeId, shapeType));
+    } else if ("DiamondSurface" == shapeType) {
+        surfShape = m_lazy->surfaceBuilder.buildDiamondSurface(rowOfNode(m_diamond_surface, shapeId, shapeType));
+    } else {
+        THROW_EXCEPTION("ERROR!!! VSurface '" + shapeType + "' is not built correctly!");
+    }
+    return m_lazy->store(VSurface, id, new GeoVSurface(surfShape));
+}
+
+} /* namespace GeoModelIO */
@@ -0,0 +1,154 @@
+/*
+  Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+*/
+
+#include "TaskGraph.h"
+
+#include "GeoModelKernel/throwExcept.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace GeoModelIO {
+
+TaskGraph::TaskId TaskGraph::addNode(std::size_t group, Work work,
+                                     const std::vector<TaskId>& deps) {
+    const TaskId id = m_nodes.size();
+    Node node{};
+    node.work = std::move(work);
+    node.group = group;
+    // dependencies can only refer to tasks added before, so the graph
+    // is acyclic by construction
+    for (const TaskId dep : deps) {
+        if (dep >= id) {
+            THROW_EXCEPTION("Task '" << m_groups[group] << "' depends on the unknown task " << dep);
+        }
+        m_nodes[dep].dependents.push_back(id);
+        ++node.nDeps;
+    }
+    m_nodes.push_back(std::move(node));
+    return id;
+}
+
+TaskGraph::TaskId TaskGraph::addTask(const std::string& name, Work work,
+                                     const std::vector<TaskId>& deps) {
+    m_groups.push_back(name);
+    return addNode(m_groups.size() - 1, std::move(work), deps);
+}
+
+TaskGraph::TaskId TaskGraph::addRangeTask(const std::string& name, std::size_t nItems,
+                                          std::size_t minChunk, Work prepare,
+                                          RangeWork work, Work finish,
+                                          const std::vector<TaskId>& deps) {
+    m_groups.push_back(name);
+    const std::size_t group = m_groups.size() - 1;
+    const TaskId prepareId = addNode(group, std::move(prepare), deps);
+
+    // a few chunks per worker thread, to even out the load,
+    // but never less than 'minChunk' items per chunk
+    const std::size_t maxChunks = std::max(1u, 4 * m_nThreads);
+    const std::size_t nChunks = std::min(maxChunks, (nItems + std::max<std::size_t>(minChunk, 1) - 1) /
+                                                        std::max<std::size_t>(minChunk, 1));
+    std::vector<TaskId> chunks{};
+    chunks.reserve(nChunks);
+    for (std::size_t chunk = 0; chunk < nChunks; ++chunk) {
+        const std::size_t first = nItems * chunk / nChunks;
+        const std::size_t last = nItems * (chunk + 1) / nChunks;
+        chunks.push_back(addNode(group, [work, first, last]() { work(first, last); }, {prepareId}));
+    }
+    if (chunks.empty()) chunks.push_back(prepareId);
+    return addNode(group, std::move(finish), chunks);
+}
+
+void TaskGraph::execute(TaskId id) {
+    Node& node = m_nodes[id];
+    node.start = Clock::now();
+    if (node.work) node.work();
+    node.end = Clock::now();
+}
+
+void TaskGraph::run() {
+    std::vector<unsigned int> pending(m_nodes.size());
+    std::deque<TaskId> ready{};
+    for (TaskId id = 0; id < m_nodes.size(); ++id) {
+        pending[id] = m_nodes[id].nDeps;
+        if (!pending[id]) ready.push_back(id);
+    }
+
+    // serial mode: the tasks are run in the order they have been added
+    if (!m_nThreads) {
+        while (!ready.empty()) {
+            const TaskId id = ready.front();
+            ready.pop_front();
+            execute(id);
+            for (const TaskId dep : m_nodes[id].dependents) {
+                if (!--pending[dep]) ready.push_back(dep);
+            }
+        }
+        return;
+    }
+
+    std::mutex mux{};
+    std::condition_variable cv{};
+    std::size_t nDone{0};
+    std::exception_ptr error{};
+
+    auto worker = [&]() {
+        std::unique_lock<std::mutex> lock{mux};
+        while (true) {
+            cv.wait(lock, [&]() { return !ready.empty() || error || nDone == m_nodes.size(); });
+            if (error || ready.empty()) return;
+            const TaskId id = ready.front();
+            ready.pop_front();
+            lock.unlock();
+            std::exception_ptr caught{};
+            try {
+                execute(id);
+            } catch (...) {
+                caught = std::current_exception();
+            }
+            lock.lock();
+            ++nDone;
+            if (caught) {
+                if (!error) error = caught;
+            } else {
+                for (const TaskId dep : m_nodes[id].dependents) {
+                    if (!--pending[dep]) ready.push_back(dep);
+                }
+            }
+            cv.notify_all();
+        }
+    };
+
+    const unsigned int nWorkers = std::min<std::size_t>(m_nThreads, std::max<std::size_t>(m_nodes.size(), 1));
+    std::vector<std::thread> workers{};
+    workers.reserve(nWorkers);
+    for (unsigned int w = 0; w < nWorkers; ++w) {
+        workers.emplace_back(worker);
+    }
+    for (std::thread& thread : workers) {
+        thread.join();
+    }
+    if (error) std::rethrow_exception(error);
+}
+
+void TaskGraph::printTimings(std::ostream& out) const {
+    for (std::size_t group = 0; group < m_groups.size(); ++group) {
+        Clock::time_point start{Clock::time_point::max()}, end{Clock::time_point::min()};
+        for (const Node& node : m_nodes) {
+            if (node.group != group) continue;
+            start = std::min(start, node.start);
+            end = std::max(end, node.end);
+        }
+        out << "*** Time taken by the task '" << m_groups[group] << "': "
+            << std::chrono::duration<double, std::milli>(end - start).count()
+            << " [ms]" << std::endl;
+    }
+}
+
+} /* namespace GeoModelIO */
@@ -0,0 +1,83 @@
+/*
+  Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+*/
+
+/*
+ * TaskGraph.h
+ *
+ * A small dependency-graph scheduler, used by ReadGeoModel to build the
+ * caches of the different GeoModel node types concurrently.
+ *
+ * Each task declares the tasks it depends on and is started as soon as all of
+ * them have completed, so that no task waits for unrelated slow tables.
+ * Large tables can be registered as range tasks, which are split into chunks
+ * of rows processed concurrently by the worker pool.
+ *
+ */
+
+#ifndef GEOMODELREAD_TASKGRAPH_H
+#define GEOMODELREAD_TASKGRAPH_H
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace GeoModelIO {
+
+class TaskGraph {
+   public:
+    using TaskId = std::size_t;
+    using Work = std::function<void()>;
+    using RangeWork = std::function<void(std::size_t first, std::size_t last)>;
+
+    /// Create a graph whose tasks will be run by 'nThreads' worker threads;
+    /// with 0 threads, the tasks are run in the calling thread, in the order
+    /// in which they have been added.
+    explicit TaskGraph(unsigned int nThreads) : m_nThreads(nThreads) {}
+
+    /// Add a task which is started once all the tasks in 'deps' have completed
+    TaskId addTask(const std::string& name, Work work,
+                   const std::vector<TaskId>& deps = {});
+
+    /// Add a task which processes the items [0, nItems) in chunks of at least
+    /// 'minChunk' items. 'prepare' is run before the first chunk and 'finish'
+    /// after the last one; both can be empty. The returned id refers to the
+    /// completion of the whole range.
+    TaskId addRangeTask(const std::string& name, std::size_t nItems,
+                        std::size_t minChunk, Work prepare, RangeWork work,
+                        Work finish, const std::vector<TaskId>& deps = {});
+
+    /// Run all the tasks and wait for their completion. The first exception
+    /// thrown by a task stops the scheduling and is rethrown here.
+    void run();
+
+    /// Print the wall time spent in each task
+    void printTimings(std::ostream& out) const;
+
+   private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Node {
+        Work work;
+        std::size_t group{0};
+        unsigned int nDeps{0};
+        std::vector<TaskId> dependents{};
+        Clock::time_point start{};
+        Clock::time_point end{};
+    };
+
+    TaskId addNode(std::size_t group, Work work, const std::vector<TaskId>& deps);
+    void execute(TaskId id);
+
+    unsigned int m_nThreads{0};
+    std::vector<Node> m_nodes{};
+    /// names of the tasks, as seen by the client; a range task owns several nodes
+    std::vector<std::string> m_groups{};
+};
+
+} /* namespace GeoModelIO */
+
+#endif
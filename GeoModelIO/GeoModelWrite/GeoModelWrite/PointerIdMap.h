@@ -0,0 +1,111 @@
+/*
+  Copyright (C) 2002-2025 CERN for the benefit of the ATLAS collaboration
+*/
+
+/*
+ * PointerIdMap.h
+ *
+ * A flat, open-addressing hash map from the addresses of the visited GeoModel
+ * nodes to the IDs they have been given in the DB.
+ *
+ * The writer queries this map for each visited node; keeping keys and values
+ * in two plain arrays, with linear probing, avoids a heap allocation per entry
+ * and keeps the lookups within a couple of cache lines.
+ * Entries are never removed.
+ *
+ */
+
+#ifndef GeoModelWrite_PointerIdMap_H
+#define GeoModelWrite_PointerIdMap_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GeoModelIO {
+
+class PointerIdMap {
+   public:
+    /// Return a pointer to the ID stored for 'key', or nullptr if not found
+    const unsigned int* find(const void* key) const {
+        if (!key) return m_hasNullKey ? &m_nullKeyValue : nullptr;
+        if (m_keys.empty()) return nullptr;
+        for (std::size_t slot = bucket(key);; slot = (slot + 1) & m_mask) {
+            if (m_keys[slot] == key) return &m_values[slot];
+            if (!m_keys[slot]) return nullptr;
+        }
+    }
+    bool contains(const void* key) const { return find(key) != nullptr; }
+
+    /// Store the ID of 'key'; as for std::unordered_map::insert(),
+    /// an existing entry is not overwritten
+    void insert(const void* key, unsigned int value) {
+        // empty slots are marked by a null key, which is then stored apart
+        if (!key) {
+            if (!m_hasNullKey) {
+                m_hasNullKey = true;
+                m_nullKeyValue = value;
+                ++m_size;
+            }
+            return;
+        }
+        if (2 * (m_size + 1) > m_keys.size()) grow();
+        std::size_t slot = bucket(key);
+        while (m_keys[slot]) {
+            if (m_keys[slot] == key) return;
+            slot = (slot + 1) & m_mask;
+        }
+        m_keys[slot] = key;
+        m_values[slot] = value;
+        ++m_size;
+    }
+
+    std::size_t size() const { return m_size; }
+
+    /// Call 'func(key, value)' for all the stored entries, in no particular order
+    template <class Func>
+    void forEach(Func func) const {
+        if (m_hasNullKey) func(nullptr, m_nullKeyValue);
+        for (std::size_t slot = 0; slot < m_keys.size(); ++slot) {
+            if (m_keys[slot]) func(m_keys[slot], m_values[slot]);
+        }
+    }
+
+   private:
+    std::size_t bucket(const void* key) const {
+        // Fibonacci hashing of the address; the lowest bits are dropped,
+        // since they are the same for all aligned heap objects
+        const std::uint64_t bits = reinterpret_cast<std::uintptr_t>(key) >> 3;
+        return (bits * 0x9E3779B97F4A7C15ull) >> m_shift;
+    }
+
+    void grow() {
+        std::vector<const void*> oldKeys{};
+        std::vector<unsigned int> oldValues{};
+        oldKeys.swap(m_keys);
+        oldValues.swap(m_values);
+
+        const std::size_t capacity = oldKeys.empty() ? 1024 : 2 * oldKeys.size();
+        m_keys.assign(capacity, nullptr);
+        m_values.assign(capacity, 0);
+        m_mask = capacity - 1;
+        m_shift = 64;
+        for (std::size_t c = capacity; c > 1; c >>= 1) --m_shift;
+        m_size = m_hasNullKey ? 1 : 0;
+        for (std::size_t slot = 0; slot < oldKeys.size(); ++slot) {
+            if (oldKeys[slot]) insert(oldKeys[slot], oldValues[slot]);
+        }
+    }
+
+    std::vector<const void*> m_keys{};
+    std::vector<unsigned int> m_values{};
+    std::size_t m_size{0};
+    std::size_t m_mask{0};
+    unsigned int m_shift{64};
+    bool m_hasNullKey{false};
+    unsigned int m_nullKeyValue{0};
+};
+
+}  // namespace GeoModelIO
+
+#endif
@@ -35,6 +35,7 @@
 // local includes
 #include "GeoModelDBManager/GMDBManager.h"
 #include "GeoModelDBManager/definitions.h"
+#include "GeoModelWrite/PointerIdMap.h"
 
 
 // GeoModel includes
@@ -50,10 +51,12 @@
 #include "GeoModelKernel/GeoVSurfaceShape.h"
 
 // C++ includes
+#include <array>
 #include <set>
 #include <deque>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -70,6 +73,18 @@ typedef std::unordered_map<
     AuxTableData;
 namespace GeoModelIO {
 
+/// Hash of a fixed-size tuple of numerical IDs, used to key the work caches
+template <std::size_t N>
+struct IdTupleHash {
+    std::size_t operator()(const std::array<unsigned int, N> &ids) const noexcept {
+        std::size_t seed = 0;
+        for (const unsigned int id : ids) {
+            seed ^= std::hash<unsigned int>{}(id) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        }
+        return seed;
+    }
+};
+
 /**
  * \class WriteGeoModel
  *
@@ -324,30 +339,10 @@ class WriteGeoModel : public GeoNodeAction {
                             const std::string &childType,
                             const unsigned int &childCopyN);
 
-    bool isAddressStored(const std::string &address);
-    void storeAddress(const std::string &address, const unsigned int &id);
-
-    unsigned int getStoredIdFromAddress(const std::string &address);
-
-    std::string getAddressStringFromPointer(const GeoMaterial *pointer);
-    std::string getAddressStringFromPointer(const GeoElement *pointer);
-    std::string getAddressStringFromPointer(const GeoShape *pointer);
-    std::string getAddressStringFromPointer(const GeoLogVol *pointer);
-    std::string getAddressStringFromPointer(const GeoPhysVol *pointer);
-    std::string getAddressStringFromPointer(const GeoVPhysVol *pointer);
-    std::string getAddressStringFromPointer(const GeoVSurface *pointer);
-    std::string getAddressStringFromPointer(const GeoVSurfaceShape *pointer);
-    std::string getAddressStringFromPointer(
-        const GeoSerialDenominator *pointer);
-    std::string getAddressStringFromPointer(const GeoSerialIdentifier *pointer);
-    std::string getAddressStringFromPointer(const GeoIdentifierTag *pointer);
-    std::string getAddressStringFromPointer(
-        const GeoSerialTransformer *pointer);
-    std::string getAddressStringFromPointer(const GeoXF::Function *pointer);
-    std::string getAddressStringFromPointer(const GeoTransform *pointer);
-    std::string getAddressStringFromPointer(const GeoNameTag *pointer);
-
-    std::string getQStringFromOss(std::ostringstream &oss);
+    bool isAddressStored(const void *address);
+    void storeAddress(const void *address, const unsigned int &id);
+
+    unsigned int getStoredIdFromAddress(const void *address);
 
     std::vector<double> getTransformParameters(
         GeoTrf::Transform3D);  // TODO: to be moved to Eigen (GeoTrf) and to be
@@ -374,11 +369,15 @@ class WriteGeoModel : public GeoNodeAction {
     GMDBManager *m_dbManager;
 
     // work caches
-    std::set<std::string> m_linkSet;
-    std::unordered_map<std::string, unsigned int> m_parentChildrenMap;
-    std::unordered_map<std::string, unsigned int> m_volumeCopiesMap;
-    std::unordered_map<std::string, unsigned int> m_surfaceCopiesMap;
-    std::unordered_map<std::string, unsigned int> m_memMap;
+    // keys: {parentId, parentTableId, childId, childTableId, childPos}
+    std::unordered_set<std::array<unsigned int, 5>, IdTupleHash<5>> m_linkSet;
+    // keys: {tableId, parentId, copyN}
+    std::unordered_map<std::array<unsigned int, 3>, unsigned int, IdTupleHash<3>> m_parentChildrenMap;
+    // keys: {tableId, volId}
+    std::unordered_map<std::array<unsigned int, 2>, unsigned int, IdTupleHash<2>> m_volumeCopiesMap;
+    std::unordered_map<std::array<unsigned int, 2>, unsigned int, IdTupleHash<2>> m_surfaceCopiesMap;
+    // the IDs of the stored nodes, keyed on their addresses
+    PointerIdMap m_memMap;
     std::unordered_map<std::string, unsigned int> m_memMap_Tables;
 
     // keep track of the number of visited tree node
@@ -105,64 +105,32 @@ std::string joinVectorStrings(const std::vector<std::string>& vec,
 unsigned int WriteGeoModel::getChildPosition(const unsigned int& parentId,
                                              const std::string& parentType,
                                              const unsigned int& copyN) {
-    unsigned int tableId = getIdFromNodeType(parentType);
-    // INT
-    std::string key = std::to_string(tableId) + ":" + std::to_string(parentId) +
-                      ":" + std::to_string(copyN);  // INT
-
-    std::unordered_map<std::string, unsigned int>::iterator it =
-        m_parentChildrenMap.find(key);
-    if (it == m_parentChildrenMap.end()) {
-        m_parentChildrenMap[key] =
-            1;  // if item is not present, create an entry
-    } else {
-        ++m_parentChildrenMap[key];  // if present already, then increment its
-                                     // entry
-    }
-    return m_parentChildrenMap[key];
+    const unsigned int tableId = getIdFromNodeType(parentType);
+    // if item is not present, create an entry;
+    // if present already, then increment its entry
+    return ++m_parentChildrenMap[{tableId, parentId, copyN}];
 }
 
 unsigned int WriteGeoModel::setVolumeCopyNumber(const unsigned int& volId,
                                                 const std::string& volType) {
     // JFB Commented out: qDebug() << "WriteGeoModel::setVolumeCopyNumber()";
     const unsigned int tableId = getIdFromNodeType(volType);
-    std::string key =
-        std::to_string(tableId) + ":" + std::to_string(volId);  // INT
-
-    std::unordered_map<std::string, unsigned int>::iterator it =
-        m_volumeCopiesMap.find(key);
-    if (it == m_volumeCopiesMap.end()) {
-        m_volumeCopiesMap[key] = 1;
-    } else {
-        ++m_volumeCopiesMap[key];
-    }
-    return m_volumeCopiesMap[key];
+    return ++m_volumeCopiesMap[{tableId, volId}];
 }
 
 unsigned int WriteGeoModel::setSurfaceCopyNumber(const unsigned int& VSurfaceId,
                                                  const std::string& surfType) {
     const unsigned int tableId = getIdFromNodeType(surfType); // deal with DBManager
-    std::string key =
-        std::to_string(tableId) + ":" + std::to_string(VSurfaceId);  // INT
-
-    std::unordered_map<std::string, unsigned int>::iterator it =
-        m_surfaceCopiesMap.find(key);
-    if (it == m_surfaceCopiesMap.end()) {
-        m_surfaceCopiesMap[key] = 1;    // if not found, copy number is 1
-    } else {
-        ++m_surfaceCopiesMap[key];      // if found, copy number increase by 1
-    }
-    return m_surfaceCopiesMap[key];
+    // if not found, copy number is 1; if found, copy number increase by 1
+    return ++m_surfaceCopiesMap[{tableId, VSurfaceId}];
 }
 
 unsigned int WriteGeoModel::getLatestParentCopyNumber(
     const unsigned int& parentId, const std::string& parentType) {
     const unsigned int tableId = getIdFromNodeType(parentType);
-    std::string key =
-        std::to_string(tableId) + ":" + std::to_string(parentId);  // INT
+    const std::array<unsigned int, 2> key{tableId, parentId};
 
-    std::unordered_map<std::string, unsigned int>::iterator it =
-        m_volumeCopiesMap.find(key);
+    auto it = m_volumeCopiesMap.find(key);
     if (it == m_volumeCopiesMap.end()) {
         std::cout
             << "ERROR!!! Something's wrong in storing the number of copies!"
@@ -191,7 +159,7 @@ void WriteGeoModel::handleVSurfaceObjects(const GeoVSurface* surf) {
                   << surf << std::endl;
     }
 
-    std::string address = getAddressStringFromPointer(surf);
+    const void* address = surf;
     unsigned int surfShapeId;
     std::string surfShapeType;    
     unsigned int VSurfaceId;
@@ -209,7 +177,7 @@ void WriteGeoModel::handleVSurfaceObjects(const GeoVSurface* surf) {
      
     unsigned int parentId = 0;
     const GeoVPhysVol* parentNode = upperVol;
-    std::string parentAddress = getAddressStringFromPointer(parentNode);
+    const void* parentAddress = parentNode;
     parentId = getStoredIdFromAddress(parentAddress);
     
     if (!isAddressStored(address)) {   // The VSurface is new, needs to store
@@ -242,7 +210,7 @@ void WriteGeoModel::handleVPhysVolObjects(const GeoVPhysVol* vol) {
                   << vol << std::endl;
     }
     // get the address string for the current volume
-    std::string address = getAddressStringFromPointer(vol);
+    const void* address = vol;
     // variables used to persistify the object
     unsigned int physId;
 
@@ -321,7 +289,7 @@ void WriteGeoModel::handleVPhysVolObjects(const GeoVPhysVol* vol) {
         // qDebug() << "parentNode address" << parentNode;
 
         if (parentNode) {
-            std::string parentAddress = getAddressStringFromPointer(parentNode);
+            const void* parentAddress = parentNode;
             // JFB Commented out: qDebug() << "==> parent's address:" <<
             // parentNode;
 
@@ -463,7 +431,7 @@ std::string WriteGeoModel::getGeoTypeFromVPhysVol(const GeoVPhysVol* vol) {
 }
 
 void WriteGeoModel::handleIdentifierTag(const GeoIdentifierTag* node) {
-    std::string address = getAddressStringFromPointer(node);
+    const void* address = node;
     int identifier = node->getIdentifier();
 
     // debug msgs
@@ -499,7 +467,7 @@ void WriteGeoModel::handleIdentifierTag(const GeoIdentifierTag* node) {
 }
 
 void WriteGeoModel::handleSerialIdentifier(const GeoSerialIdentifier* node) {
-    std::string address = getAddressStringFromPointer(node);
+    const void* address = node;
     int baseId = node->getBaseId();
 
     // debug msgs
@@ -535,7 +503,7 @@ void WriteGeoModel::handleSerialIdentifier(const GeoSerialIdentifier* node) {
 }
 
 void WriteGeoModel::handleSerialDenominator(const GeoSerialDenominator* node) {
-    std::string address = getAddressStringFromPointer(node);
+    const void* address = node;
     std::string baseName = node->getBaseName();
 
     // variables used to persistify the object
@@ -566,7 +534,7 @@ void WriteGeoModel::handleSerialDenominator(const GeoSerialDenominator* node) {
 }
 
 void WriteGeoModel::handleSerialTransformer(const GeoSerialTransformer* node) {
-    std::string address = getAddressStringFromPointer(node);
+    const void* address = node;
 
     //============================
     //==== variables used to persistify the object
@@ -637,7 +605,7 @@ void WriteGeoModel::handleSerialTransformer(const GeoSerialTransformer* node) {
          */
         handleReferencedVPhysVol(vol);
 
-        std::string physvolAddress = getAddressStringFromPointer(vol);
+        const void* physvolAddress = vol;
         physvolId = getStoredIdFromAddress(physvolAddress);
 
         /*
@@ -658,8 +626,6 @@ void WriteGeoModel::handleSerialTransformer(const GeoSerialTransformer* node) {
 }
 
 void WriteGeoModel::handleTransform(const GeoTransform* node) {
-    std::string address = getAddressStringFromPointer(node);
-
     // get the parent volume
     const std::vector<std::string> parentList = getParentNode();
     const unsigned int parentId = std::stoi(parentList[0]);
@@ -698,7 +664,6 @@ void WriteGeoModel::handleTransform(const GeoTransform* node) {
 
 void WriteGeoModel::handleNameTag(const GeoNameTag* node) {
     std::string name = node->getName();
-    const std::string address = getAddressStringFromPointer(node);
     // get the parent volume
     const std::vector<std::string> parentList = getParentNode();
     const unsigned int parentId = std::stoi(parentList[0]);
@@ -751,7 +716,7 @@ std::vector<std::string> WriteGeoModel::getParentNode() {
             parentType = getGeoTypeFromVPhysVol(parentNode);
 
             // get the parent memory address
-            std::string parentAddress = getAddressStringFromPointer(parentNode);
+            const void* parentAddress = parentNode;
 
             // get the id of the parent node, which should be stored already in
             // the DB
@@ -898,7 +863,7 @@ unsigned int WriteGeoModel::storeTranform(const GeoTransform* node) {
      * STORE THE OBJECT IN THE DB
      */
 
-    std::string address = getAddressStringFromPointer(node);
+    const void* address = node;
 
     unsigned int trId = 0;
 
@@ -998,7 +963,7 @@ void WriteGeoModel::handleReferencedVPhysVol(const GeoVPhysVol* vol) {
     // QString::fromStdString(vol->getLogVol()->getName());
 
     // get the address string for the current volume
-    std::string address = getAddressStringFromPointer(vol);
+    const void* address = vol;
 
     unsigned int parentId = 0;
 
@@ -1014,7 +979,7 @@ void WriteGeoModel::handleReferencedVPhysVol(const GeoVPhysVol* vol) {
         p ? dynamic_cast<const GeoVPhysVol*>(&(*(vol->getParent()))) : nullptr;
 
     if (parentNode) {
-        std::string parentAddress = getAddressStringFromPointer(parentNode);
+        const void* parentAddress = parentNode;
 
         if (isAddressStored(parentAddress))
             parentId = getStoredIdFromAddress(parentAddress);
@@ -1525,19 +1490,16 @@ WriteGeoModel::~WriteGeoModel() {
 }
 
 void WriteGeoModel::showMemoryMap() {
-    std::unordered_map<std::string, unsigned int>::const_iterator it =
-        m_memMap.begin();
-    while (it != m_memMap.end()) {
-        std::cout << it->first << ": " << it->second << std::endl;
-        ++it;
-    }
+    m_memMap.forEach([](const void* address, unsigned int id) {
+        std::cout << address << ": " << id << std::endl;
+    });
 }
 
 unsigned int WriteGeoModel::storeObj(const GeoMaterial* pointer,
                                      const std::string& name,
                                      const double &density,
                                      const DBRowsList &materialData) {
-    std::string address = getAddressStringFromPointer(pointer);
+    const void* address = pointer;
     unsigned int materialId;
 
     if (!isAddressStored(address)) {
@@ -1559,7 +1521,7 @@ unsigned int WriteGeoModel::storeObj(const GeoElement* pointer,
                                      const std::string& symbol,
                                      const double& elZ, const double& elA) {
     if(m_loglevel>=3) std::cout << "storing " << name << std::endl;
-    std::string address = getAddressStringFromPointer(pointer);
+    const void* address = pointer;
     unsigned int elementId;
 
     if (!isAddressStored(address)) {
@@ -1576,7 +1538,7 @@ unsigned int WriteGeoModel::storeObj(const GeoElement* pointer,
 unsigned int WriteGeoModel::storeObj(const GeoShape* pointer,
                                      const std::string& shapeName,
                                      const std::string& parameters) {
-    std::string address = getAddressStringFromPointer(pointer);
+    const void* address = pointer;
 
     unsigned int shapeId;
     if (!isAddressStored(address)) {
@@ -1591,7 +1553,7 @@ std::pair<std::string, unsigned> WriteGeoModel::storeObj(const GeoShape* pointer
                                      const std::string& shapeName,
                                      DBRowEntry& parameters,
                                      const DBRowsList &shapeData) {
-    std::string address = getAddressStringFromPointer(pointer);
+    const void* address = pointer;
 
     unsigned int shapeId;
     if (!isAddressStored(address)) {
@@ -1624,7 +1586,7 @@ unsigned int WriteGeoModel::storeObj(const GeoLogVol* pointer,
                                      const unsigned int& shapeId,
                                      std::string_view shapeType,
                                      const unsigned int& materialId) {
-    std::string address = getAddressStringFromPointer(pointer);
+    const void* address = pointer;
 
     unsigned int logvolId;
     if (!isAddressStored(address)) {
@@ -1640,7 +1602,7 @@ unsigned int WriteGeoModel::storeObj(const GeoPhysVol* pointer,
                                      const unsigned int& logvolId,
                                      const unsigned int parentId,
                                      const bool isRootVolume) {
-    std::string address = getAddressStringFromPointer(pointer);
+    const void* address = pointer;
 
     unsigned int physvolId;
     if (!isAddressStored(address)) {
@@ -1658,7 +1620,7 @@ unsigned int WriteGeoModel::storeObj(const GeoFullPhysVol* pointer,
                                      const unsigned int& logvolId,
                                      const unsigned int parentId,
                                      const bool isRootVolume) {
-    std::string address = getAddressStringFromPointer(pointer);
+    const void* address = pointer;
 
     unsigned int physvolId;
     if (!isAddressStored(address)) {
@@ -1678,7 +1640,7 @@ unsigned int WriteGeoModel::storeVSurface(const GeoVSurface* pointer, const unsi
     // SurfaceShape address is different from VSurface address
     // VSurface has position info, similar to GeoFullPhysVol
     unsigned int VSurfaceId;
-    std::string address = getAddressStringFromPointer(pointer);
+    const void* address = pointer;
     VSurfaceId = addVSurface(surfShapeType, surfShapeId);
     storeAddress(address, VSurfaceId);
     return VSurfaceId;
@@ -1696,7 +1658,7 @@ unsigned int WriteGeoModel::storeSurfaceShape(const GeoVSurfaceShape* surf_shape
 
 unsigned int WriteGeoModel::storeObj(const GeoVSurfaceShape* pointer, const std::string& shapeName, DBRowEntry& parameters, const DBRowsList &shapeData) {
     
-    std::string address = getAddressStringFromPointer(pointer);
+    const void* address = pointer;
     unsigned int surfShapeId;
     if (!isAddressStored(address)) {
          //if (shapeData.size() > 0)
@@ -1722,7 +1684,7 @@ unsigned int WriteGeoModel::storeObj(const GeoVSurfaceShape* pointer, const std:
 
 unsigned int WriteGeoModel::storeObj(const GeoSerialIdentifier* pointer,
                                      const int& baseId) {
-    const std::string address = getAddressStringFromPointer(pointer);
+    const void* address = pointer;
     unsigned int id;
 
     if (!isAddressStored(address)) {
@@ -1736,7 +1698,7 @@ unsigned int WriteGeoModel::storeObj(const GeoSerialIdentifier* pointer,
 
 unsigned int WriteGeoModel::storeObj(const GeoIdentifierTag* pointer,
                                      const int& identifier) {
-    const std::string address = getAddressStringFromPointer(pointer);
+    const void* address = pointer;
     unsigned int id;
 
     if (!isAddressStored(address)) {
@@ -1750,7 +1712,7 @@ unsigned int WriteGeoModel::storeObj(const GeoIdentifierTag* pointer,
 
 unsigned int WriteGeoModel::storeObj(const GeoSerialDenominator* pointer,
                                      const std::string& baseName) {
-    const std::string address = getAddressStringFromPointer(pointer);
+    const void* address = pointer;
     unsigned int id;
 
     if (!isAddressStored(address)) {
@@ -1767,7 +1729,7 @@ unsigned int WriteGeoModel::storeObj(const GeoSerialTransformer* pointer,
                                      const unsigned int& volId,
                                      const std::string& volType,
                                      const unsigned int& copies) {
-    const std::string address = getAddressStringFromPointer(pointer);
+    const void* address = pointer;
     unsigned int id = 0;
 
     if (!isAddressStored(address)) {
@@ -1789,7 +1751,7 @@ unsigned int WriteGeoModel::storeObj(const GeoSerialTransformer* pointer,
 unsigned int WriteGeoModel::storeObj(const GeoXF::Function* pointer) {
                                     //  const std::string& expression,
                                     //  const std::deque<double>& exprData) {
-    const std::string address = getAddressStringFromPointer(pointer);
+    const void* address = pointer;
     unsigned int id = 0;
 
     if (!isAddressStored(address)) {
@@ -1852,7 +1814,7 @@ unsigned int WriteGeoModel::storeObj(const GeoXF::Function* pointer) {
 
 unsigned int WriteGeoModel::storeObj(const GeoTransform* pointer,
                                      const std::vector<double>& parameters) {
-    const std::string address = getAddressStringFromPointer(pointer);
+    const void* address = pointer;
     unsigned int id = 0;
 
     if (!isAddressStored(address)) {
@@ -1871,7 +1833,7 @@ unsigned int WriteGeoModel::storeObj(const GeoTransform* pointer,
 
 unsigned int WriteGeoModel::storeObj(const GeoAlignableTransform* pointer,
                                      const std::vector<double>& parameters) {
-    const std::string address = getAddressStringFromPointer(pointer);
+    const void* address = pointer;
     unsigned int id = 0;
 
     if (!isAddressStored(address)) {
@@ -1890,7 +1852,7 @@ unsigned int WriteGeoModel::storeObj(const GeoAlignableTransform* pointer,
 
 unsigned int WriteGeoModel::storeObj(const GeoNameTag* pointer,
                                      const std::string& name) {
-    const std::string address = getAddressStringFromPointer(pointer);
+    const void* address = pointer;
     unsigned int id = 0;
 
     if (!isAddressStored(address)) {
@@ -1914,9 +1876,9 @@ void WriteGeoModel::storeChildPosition(const unsigned int& parentId,
                                        const unsigned int& childPos,
                                        const std::string& childType,
                                        const unsigned int& childCopyN) {
-    std::string key = std::to_string(parentId) + ":" + parentType + ":" +
-                      std::to_string(childId) + ":" + childType + ":" +
-                      std::to_string(childPos);
+    const std::array<unsigned int, 5> key{parentId, getIdFromNodeType(parentType),
+                                          childId, getIdFromNodeType(childType),
+                                          childPos};
     if (m_linkSet.find(key) == m_linkSet.end()) {
         addChildPosition(
             parentId, parentType, childId, parentCopyN, childPos, childType,
@@ -2369,6 +2331,10 @@ void WriteGeoModel::saveToDB(std::vector<GeoPublisher*>& publishers) {
     std::cout << "Saving the GeoModel tree to file: '" << m_dbpath << "'"
               << std::endl;
 
+    // write all tables within a single transaction; the records of each
+    // table are inserted through prepared statements (see GMDBManager)
+    m_dbManager->beginTransaction();
+
     m_dbManager->addListOfRecords("GeoElement", m_elements);
     m_dbManager->addListOfRecords("GeoMaterial", m_materials);
     m_dbManager->addListOfRecordsToTable("Materials_Data", m_materials_Data); // new version, with list of (element,fraction) stored separately
@@ -2472,6 +2438,8 @@ void WriteGeoModel::saveToDB(std::vector<GeoPublisher*>& publishers) {
         }
     }
 
+    m_dbManager->commitTransaction();
+
     if (!m_objectsNotPersistified.empty()) {
         std::cout << "\n\tGeoModelWrite -- WARNING!! There are shapes/nodes "
                      "which need to be persistified! --> ";
@@ -2582,9 +2550,9 @@ void WriteGeoModel::storeRecordPublishedNodes(
         // stage.
         //       If not, there's a serious bug!
         unsigned int volID = 0;
-        std::string volStr = getAddressStringFromPointer(vol);
-        if (isAddressStored(volStr)) {
-            volID = getStoredIdFromAddress(volStr);
+        const void* volAddress = vol;
+        if (isAddressStored(volAddress)) {
+            volID = getStoredIdFromAddress(volAddress);
         } else {
             std::cout
                 << "ERROR!!! Address of node is not stored, but it should! Ask "
@@ -2621,129 +2589,22 @@ void WriteGeoModel::storeDataTable(
     m_auxiliaryTablesVarData[tableName] = std::move(tableData);
 }
 
-void WriteGeoModel::storeAddress(const std::string& address,
+void WriteGeoModel::storeAddress(const void* address,
                                  const unsigned int& id) {
-    m_memMap.insert(std::pair<std::string, unsigned int>(address, id));
+    m_memMap.insert(address, id);
 }
 
-bool WriteGeoModel::isAddressStored(const std::string& address) {
+bool WriteGeoModel::isAddressStored(const void* address) {
     // showMemoryMap(); // only for Debug
-    // std::cout << "DEBUG: calling isAddressStored()..." << std::endl;
-    std::unordered_map<std::string, unsigned int>::iterator it =
-        m_memMap.find(address);
-    return (it != m_memMap.end());
-}
-
-unsigned int WriteGeoModel::getStoredIdFromAddress(const std::string& address) {
-    // std::cout << "DEBUG: calling getStoredIdFromAddress()..." << std::endl;
-    return m_memMap.at(address);
-}
-
-// get pointer string
-std::string WriteGeoModel::getAddressStringFromPointer(
-    const GeoMaterial* pointer) {
-    std::ostringstream oss;
-    oss << pointer;
-    return getQStringFromOss(oss);
-}
-// get pointer string
-std::string WriteGeoModel::getAddressStringFromPointer(
-    const GeoElement* pointer) {
-    std::ostringstream oss;
-    oss << pointer;
-    return getQStringFromOss(oss);
-}
-// get pointer string
-std::string WriteGeoModel::getAddressStringFromPointer(
-    const GeoShape* pointer) {
-    std::ostringstream oss;
-    oss << pointer;
-    return getQStringFromOss(oss);
-}
-// get pointer string
-std::string WriteGeoModel::getAddressStringFromPointer(
-    const GeoLogVol* pointer) {
-    std::ostringstream oss;
-    oss << pointer;
-    return getQStringFromOss(oss);
-}
-// get pointer string
-std::string WriteGeoModel::getAddressStringFromPointer(
-    const GeoPhysVol* pointer) {
-    std::ostringstream oss;
-    oss << pointer;
-    return getQStringFromOss(oss);
-}
-std::string WriteGeoModel::getAddressStringFromPointer(
-    const GeoVPhysVol* pointer) {
-    std::ostringstream oss;
-    oss << pointer;
-    return getQStringFromOss(oss);
-}
-std::string WriteGeoModel::getAddressStringFromPointer(
-    const GeoVSurface* pointer) {
-    std::ostringstream oss;
-    oss << pointer;
-    return getQStringFromOss(oss);
-}
-std::string WriteGeoModel::getAddressStringFromPointer(
-    const GeoVSurfaceShape* pointer) {
-    std::ostringstream oss;
-    oss << pointer;
-    return getQStringFromOss(oss);
-}
-// get pointer string
-std::string WriteGeoModel::getAddressStringFromPointer(
-    const GeoSerialDenominator* pointer) {
-    std::ostringstream oss;
-    oss << pointer;
-    return getQStringFromOss(oss);
-}
-
-std::string WriteGeoModel::getAddressStringFromPointer(
-    const GeoSerialIdentifier* pointer) {
-    std::ostringstream oss;
-    oss << pointer;
-    return getQStringFromOss(oss);
-}
-
-std::string WriteGeoModel::getAddressStringFromPointer(
-    const GeoIdentifierTag* pointer) {
-    std::ostringstream oss;
-    oss << pointer;
-    return getQStringFromOss(oss);
-}
-
-std::string WriteGeoModel::getAddressStringFromPointer(
-    const GeoSerialTransformer* pointer) {
-    std::ostringstream oss;
-    oss << pointer;
-    return getQStringFromOss(oss);
-}
-std::string WriteGeoModel::getAddressStringFromPointer(
-    const GeoXF::Function* pointer) {
-    std::ostringstream oss;
-    oss << pointer;
-    return getQStringFromOss(oss);
-}
-
-std::string WriteGeoModel::getAddressStringFromPointer(
-    const GeoTransform* pointer) {
-    std::ostringstream oss;
-    oss << pointer;
-    return getQStringFromOss(oss);
-}
-
-std::string WriteGeoModel::getAddressStringFromPointer(
-    const GeoNameTag* pointer) {
-    std::ostringstream oss;
-    oss << pointer;
-    return getQStringFromOss(oss);
-}
-
-std::string WriteGeoModel::getQStringFromOss(std::ostringstream& oss) {
-    std::string addr = oss.str();
-    return addr;
+    return m_memMap.contains(address);
+}
+
+unsigned int WriteGeoModel::getStoredIdFromAddress(const void* address) {
+    const unsigned int* id = m_memMap.find(address);
+    if (!id) {
+        THROW_EXCEPTION("The address " << address << " has not been stored!");
+    }
+    return *id;
 }
 
 } /* namespace GeoModelIO */
@@ -55,6 +55,11 @@ class Evaluator: public IEvaluator {
    * separated by arithmetic (+, - , /, *, ^, **) and logical
    * operators (==, !=, >, >=, <, <=, &&, ||).
    *
+   * The expression is parsed on its first successful evaluation only:
+   * the evaluator keeps the sequence of operations of each expression
+   * text and replays it when the same text is evaluated again, with the
+   * current values of the variables.
+   *
    * @param  expression input expression.
    * @return result of the evaluation.
    * @see status
@@ -15,6 +15,7 @@
 #include <ctype.h>
 #include <errno.h>
 #include <stdlib.h>	// for strtod()
+#include <vector>
 
 using namespace GeoModelTools;
 
@@ -40,12 +41,50 @@ struct Item {
 typedef char * pchar;
 typedef hash_map<string,Item> dic_type;
 
+//---------------------------------------------------------------------------
+// Compiled expression: the operations executed by engine() on the first
+// successful evaluation of an expression, in the order of execution. As
+// the operands are pushed on a value stack and the operators take their
+// arguments from it, replaying the operations gives the same result
+// without parsing the text again. The variables are looked up by name on
+// replay: the program of an expression is valid whatever their values.
+struct Instruction {
+  enum { NUMBER, VARIABLE, FUNCTION, OPERATOR } what;
+  double value;                     // NUMBER: the number
+  int    code;                      // OPERATOR: the operator, FUNCTION: npar
+  string name;                      // VARIABLE, FUNCTION: the name
+  mutable const Item * item;        // VARIABLE: the dictionary entry ...
+  mutable unsigned int generation;  // ... found in this dictionary generation
+
+  Instruction() : what(NUMBER), value(0), code(0), name(), item(0), generation(0) {}
+};
+
+struct Program {
+  std::vector<Instruction> code;
+  int end;                          // offset of the end position of engine()
+
+  Program() : code(), end(0) {}
+  void number(double x)            { code.emplace_back(); code.back().value = x; }
+  void variable(const string & n)  { code.emplace_back(); code.back().what = Instruction::VARIABLE;
+                                     code.back().name = n; }
+  void function(const string & n, int npar) { code.emplace_back(); code.back().what = Instruction::FUNCTION;
+                                     code.back().name = n; code.back().code = npar; }
+  void op(int o)                   { code.emplace_back(); code.back().what = Instruction::OPERATOR;
+                                     code.back().code = o; }
+};
+
+typedef hash_map<string,Program> prog_type;
+
 struct Struct {
   dic_type theDictionary;
   pchar    theExpression;
   pchar    thePosition;
   int      theStatus;
   double   theResult;
+  // compiled expressions, by text, and the number of times the entries of
+  // the dictionary were deleted (the entries of the programs are then stale)
+  prog_type    thePrograms;
+  unsigned int theGeneration;
 };
 
 //---------------------------------------------------------------------------
@@ -64,13 +103,15 @@ for(;;pointer++) {                       \
 
 #define EVAL_EXIT(STATUS,POSITION) endp = POSITION; return STATUS
 #define MAX_N_PAR 5
+#define MAX_N_PROGRAMS 65536
 
 static const char sss[MAX_N_PAR+2] = "012345";
 
 enum { ENDL, LBRA, OR, AND, EQ, NE, GE, GT, LE, LT,
        PLUS, MINUS, UNARY_PLUS, UNARY_MINUS, MULT, DIV, POW, MOD, RBRA, VALUE };
 
-static int engine(pchar, pchar, double &, pchar &, const dic_type &);
+static int engine(pchar, pchar, double &, pchar &, const dic_type &,
+                  Program * = 0);
 
 static int variable(const string & name, double & result,
 		    const dic_type & dictionary)
@@ -185,7 +226,7 @@ static int function(const string & name, stack<double> & par,
 #endif
 
 static int operand(pchar begin, pchar end, double & result,
-		   pchar & endp, const dic_type & dictionary) 
+		   pchar & endp, const dic_type & dictionary, Program * program)
 /***********************************************************************
  *                                                                     *
  * Name: operand                                     Date:    03.10.00 *
@@ -201,6 +242,7 @@ static int operand(pchar begin, pchar end, double & result,
  *   result - value of the operand.                                    *
  *   endp   - pointer to the character where the evaluation stoped.    *
  *   dictionary - dictionary of available variables and functions.     *
+ *   program - if not null, the operations are recorded in it.         *
  *                                                                     *
  ***********************************************************************/
 {
@@ -214,6 +256,7 @@ static int operand(pchar begin, pchar end, double & result,
     errno = 0;
     result = strtod(pointer, (char **)(&pointer));
     if (errno == 0) {
+      if (program) program->number(result);
       EVAL_EXIT( EVAL::OK, --pointer );
     }else{
       EVAL_EXIT( EVAL::ERROR_CALCULATION_ERROR, begin );
@@ -238,6 +281,7 @@ static int operand(pchar begin, pchar end, double & result,
   SKIP_BLANKS;
   if (c != '(') {
     EVAL_STATUS = variable(name, result, dictionary);
+    if (program && EVAL_STATUS == EVAL::OK) program->variable(name);
     EVAL_EXIT( EVAL_STATUS, (EVAL_STATUS == EVAL::OK) ? --pointer : begin);
   }
 
@@ -258,7 +302,7 @@ static int operand(pchar begin, pchar end, double & result,
     case ',':
       if (pos.size() == 1) {
 	par_end = pointer-1;
-	EVAL_STATUS = engine(par_begin, par_end, value, par_end, dictionary);
+	EVAL_STATUS = engine(par_begin, par_end, value, par_end, dictionary, program);
 	if (EVAL_STATUS == EVAL::WARNING_BLANK_STRING)
 	  { EVAL_EXIT( EVAL::ERROR_EMPTY_PARAMETER, --par_end ); }
 	if (EVAL_STATUS != EVAL::OK)
@@ -273,7 +317,7 @@ static int operand(pchar begin, pchar end, double & result,
 	break;
       }else{
 	par_end = pointer-1;
-	EVAL_STATUS = engine(par_begin, par_end, value, par_end, dictionary);
+	EVAL_STATUS = engine(par_begin, par_end, value, par_end, dictionary, program);
 	switch (EVAL_STATUS) {
 	case EVAL::OK:
 	  par.push(value);
@@ -285,7 +329,9 @@ static int operand(pchar begin, pchar end, double & result,
 	default:
 	  EVAL_EXIT( EVAL_STATUS, par_end );
 	}
+	int npar = par.size();
 	EVAL_STATUS = function(name, par, result, dictionary);
+	if (program && EVAL_STATUS == EVAL::OK) program->function(name, npar);
 	EVAL_EXIT( EVAL_STATUS, (EVAL_STATUS == EVAL::OK) ? pointer : begin);
       }
     }
@@ -382,10 +428,11 @@ static int maker(int op, stack<double> & val)
  *   result - result of the evaluation.                                *
  *   endp   - pointer to the character where the evaluation stoped.    *
  *   dictionary - dictionary of available variables and functions.     *
+ *   program - if not null, the operations are recorded in it.         *
  *                                                                     *
  ***********************************************************************/
 static int engine(pchar begin, pchar end, double & result,
-		  pchar & endp, const dic_type & dictionary)
+		  pchar & endp, const dic_type & dictionary, Program * program)
 {
   enum SyntaxTableEntry {
     SyntaxError = 0,
@@ -521,12 +568,13 @@ static int engine(pchar begin, pchar end, double & result,
     case 0:                             // syntax error
       EVAL_EXIT( EVAL::ERROR_SYNTAX_ERROR, pointer );
     case 1:                             // operand: number, variable, function
-      EVAL_STATUS = operand(pointer, end, value, pointer, dictionary);
+      EVAL_STATUS = operand(pointer, end, value, pointer, dictionary, program);
       if (EVAL_STATUS != EVAL::OK) { EVAL_EXIT( EVAL_STATUS, pointer ); }
       val.push(value);
       continue;
     case 2:                             // unary + or unary -
       val.push(0.0);
+      if (program) program->number(0.0);
       if (iCur == PLUS)  iCur = UNARY_PLUS;
       if (iCur == MINUS) iCur = UNARY_MINUS;
       // Note that for syntax purposes, ordinary + or - are fine.
@@ -559,6 +607,7 @@ static int engine(pchar begin, pchar end, double & result,
         if (EVAL_STATUS != EVAL::OK) {
 	  EVAL_EXIT( EVAL_STATUS, pos.top() );
 	}
+	if (program) program->op(iTop);
 	op.top() = iCur; pos.top() = pointer;
 	break;
       case 3:                           // delete '(' from stack
@@ -569,6 +618,7 @@ static int engine(pchar begin, pchar end, double & result,
         if (EVAL_STATUS != EVAL::OK) {  // repete with the same iCur 
 	  EVAL_EXIT( EVAL_STATUS, pos.top() );
 	}
+	if (program) program->op(iTop);
 	op.pop(); pos.pop();
         continue;
       }
@@ -577,6 +627,110 @@ static int engine(pchar begin, pchar end, double & result,
   }
 }
 
+static int compute(const string &, double &, pchar &, Struct *);
+
+/***********************************************************************
+ *                                                                     *
+ * Function: Replays the operations of a compiled expression.          *
+ *           Any error is reported as ERROR_CALCULATION_ERROR: the     *
+ *           caller then runs engine() to find the actual error and    *
+ *           its position.                                             *
+ *                                                                     *
+ * Parameters:                                                         *
+ *   program - compiled expression.                                    *
+ *   result  - result of the evaluation.                               *
+ *   s       - dictionary and compiled expressions.                    *
+ *                                                                     *
+ ***********************************************************************/
+static int execute(const Program & program, double & result, Struct * s)
+{
+  stack<double> val;
+  for (const Instruction & ins : program.code) {
+    switch (ins.what) {
+    case Instruction::NUMBER:
+      val.push(ins.value);
+      break;
+    case Instruction::VARIABLE: {
+      if (ins.item == 0 || ins.generation != s->theGeneration) {
+        dic_type::const_iterator iter = s->theDictionary.find(ins.name);
+        if (iter == s->theDictionary.end()) return EVAL::ERROR_CALCULATION_ERROR;
+        ins.item       = &(iter->second);
+        ins.generation = s->theGeneration;
+      }
+      double value;
+      pchar  endp;
+      switch (ins.item->what) {
+      case Item::VARIABLE:
+        value = ins.item->variable;
+        break;
+      case Item::EXPRESSION:
+        if (compute(ins.item->expression, value, endp, s) != EVAL::OK)
+          return EVAL::ERROR_CALCULATION_ERROR;
+        break;
+      default:
+        return EVAL::ERROR_CALCULATION_ERROR;
+      }
+      val.push(value);
+      break;
+    }
+    case Instruction::FUNCTION: {
+      if (val.size() < ins.code) return EVAL::ERROR_CALCULATION_ERROR;
+      double pp[MAX_N_PAR];
+      for (int i=0; i<ins.code; i++) { pp[i] = val.top(); val.pop(); }
+      stack<double> par;
+      for (int i=ins.code-1; i>=0; i--) par.push(pp[i]);
+      double value;
+      if (function(ins.name, par, value, s->theDictionary) != EVAL::OK)
+        return EVAL::ERROR_CALCULATION_ERROR;
+      val.push(value);
+      break;
+    }
+    case Instruction::OPERATOR:
+      if (maker(ins.code, val) != EVAL::OK) return EVAL::ERROR_CALCULATION_ERROR;
+      break;
+    }
+  }
+  if (val.size() != 1) return EVAL::ERROR_CALCULATION_ERROR;
+  result = val.top();
+  return EVAL::OK;
+}
+
+/***********************************************************************
+ *                                                                     *
+ * Function: Evaluates an expression with its compiled program, which  *
+ *           is made by engine() on the first successful evaluation.   *
+ *                                                                     *
+ * Parameters:                                                         *
+ *   expression - expression; its text is the key of the program.     *
+ *   result     - result of the evaluation.                            *
+ *   endp       - pointer to the character where the evaluation stoped.*
+ *   s          - dictionary and compiled expressions.                 *
+ *                                                                     *
+ ***********************************************************************/
+static int compute(const string & expression, double & result,
+		   pchar & endp, Struct * s)
+{
+  pchar begin = (char *)(expression.c_str());
+  pchar end   = begin + strlen(begin) - 1;
+  prog_type::iterator iter = s->thePrograms.find(expression);
+  if (iter != s->thePrograms.end()) {
+    // the entries of thePrograms are not moved by the insertions of the
+    // expressions of the variables, made by execute()
+    if (execute(iter->second, result, s) == EVAL::OK) {
+      endp = begin + iter->second.end;
+      return EVAL::OK;
+    }
+    return engine(begin, end, result, endp, s->theDictionary);
+  }
+  Program program;
+  int status = engine(begin, end, result, endp, s->theDictionary, &program);
+  if (status == EVAL::OK) {
+    program.end = endp - begin;
+    s->thePrograms[expression] = program;
+  }
+  return status;
+}
+
 //---------------------------------------------------------------------------
 static void setItem(const char * prefix, const char * name,
 		    const Item & item, Struct * s) {
@@ -632,6 +786,7 @@ Evaluator::Evaluator() {
   s->thePosition   = 0;
   s->theStatus     = OK;
   s->theResult     = 0.0;
+  s->theGeneration = 0;
 }
 
 //---------------------------------------------------------------------------
@@ -650,11 +805,12 @@ double Evaluator::evaluate(const char * expression) {
   if (expression != 0) {
     s->theExpression = new char[strlen(expression)+1];
     strcpy(s->theExpression, expression);
-    s->theStatus = engine(s->theExpression,
-			  s->theExpression+strlen(expression)-1,
-			  s->theResult,
-			  s->thePosition,
-			  s->theDictionary);
+    if (s->thePrograms.size() >= MAX_N_PROGRAMS) s->thePrograms.clear();
+    string text(s->theExpression);
+    pchar  endp;
+    s->theStatus = compute(text, s->theResult, endp, s);
+    // the position in the copy of the expression, for error_position()
+    s->thePosition = s->theExpression + (endp - (char *)(text.c_str()));
   }
   return s->theResult;
 }
@@ -777,7 +933,7 @@ void Evaluator::removeVariable(const char * name) {
   const char * pointer; int n; REMOVE_BLANKS;
   if (n == 0) return;
   Struct * s = (Struct *)(p);
-  (s->theDictionary).erase(string(pointer,n));
+  if ((s->theDictionary).erase(string(pointer,n))) s->theGeneration++;
 }
 
 //---------------------------------------------------------------------------
@@ -787,13 +943,14 @@ void Evaluator::removeFunction(const char * name, int npar) {
   const char * pointer; int n; REMOVE_BLANKS;
   if (n == 0) return;
   Struct * s = (Struct *)(p);
-  (s->theDictionary).erase(sss[npar]+string(pointer,n));
+  if ((s->theDictionary).erase(sss[npar]+string(pointer,n))) s->theGeneration++;
 }
 
 //---------------------------------------------------------------------------
 void Evaluator::clear() {
   Struct * s = (Struct *) p;
   s->theDictionary.clear();
+  s->theGeneration++;
   s->theExpression = 0;
   s->thePosition   = 0;
   s->theStatus     = OK;
@@ -55,7 +55,8 @@ int main(int argc, char ** argv) {
     + "] ...[file1.db] [file2.db].. -o outputFile]\n"
     + "Options:\n"
     + "\t-v Print verbose output to the screen (default: direct verbose output to /tmp)\n"
-    + "\t-g Path to the local GeoModelATLAS repository (default: .)";
+    + "\t-g Path to the local GeoModelATLAS repository (default: .)\n"
+    + "\t-s Also write a binary snapshot of the output file, which can be memory-mapped by the readers";
   //
   // Print usage message if no args given:
   //
@@ -69,6 +70,7 @@ int main(int argc, char ** argv) {
   std::vector<std::string> inputFiles{}, inputPlugins{};
   std::string outputFile;
   std::string gmAtlasDir{"."};
+  std::string snapshotFile;
   bool outputFileSet = false;
   for (int argi=1;argi<argc;argi++) {
       std::string argument=argv[argi];
@@ -88,10 +90,18 @@ int main(int argc, char ** argv) {
       else if (argument.find("-g")!=std::string::npos) {
           gmAtlasDir = std::string(argv[++argi]);
       }
+      else if (argument=="-s") {
+          argi++;
+          if (argi>=argc) {
+              std::cerr << usage << std::endl;
+              return 1;
+          }
+          snapshotFile=argv[argi];
+      }
       else if (argument.find(shared_obj_extension)!=std::string::npos) {
           inputPlugins.push_back(argument);
       }
-      else if (argument.find(".db")!=std::string::npos) {
+      else if (argument.find(".db")!=std::string::npos || argument.find(".gmsnap")!=std::string::npos) {
           inputFiles.push_back(argument);
       }
       else {
@@ -275,6 +285,25 @@ int main(int argc, char ** argv) {
     std::cout.rdbuf(fileBuff);
   }
 
+  if (!snapshotFile.empty()) {
+    if(!verbose) {
+      std::cout.rdbuf(coutBuff);
+      std::cout << "Writing the binary snapshot " << snapshotFile << " ..." << std::endl;
+      std::cout.rdbuf(fileBuff);
+    }
+    try {
+      db.writeSnapshot(snapshotFile);
+    } catch(const std::runtime_error& e) {
+      std::cerr << "ERROR: " << e.what() << std::endl;
+      return 1;
+    }
+    if(!verbose) {
+      std::cout.rdbuf(coutBuff);
+      std::cout << "\t ... DONE!" << std::endl;
+      std::cout.rdbuf(fileBuff);
+    }
+  }
+
   std::cout.rdbuf(coutBuff);
   std::cout << "SUCCESS!" << std::endl;
   std::cout << "(verbose output at " << verboseOutput << ")" << std::endl;
@@ -39,6 +39,8 @@
 //
 //            Gmx2Geo gmx2Geo(xmlfilename, sct, gmxInterface);   
 //
+//    flags: 0x1 the first parameter is the xml itself; 0x2 it is compressed xml;
+//
 #include <string>
 #include "GeoModelXml/GmxUtil.h"
 #include "GeoModelXml/GmxInterface.h"
@@ -0,0 +1,144 @@
+//
+// Build time of a GeoModelXml description with the layout of a silicon
+// tracker barrel: layers of staves placed by a multicopy over a vector of
+// phi angles, each stave holding its modules placed by a multicopy over a
+// vector of z positions. Attributes are expressions of the defines, with
+// [] array indexing, as in the ITk descriptions.
+//
+// Usage: benchGmxBuild [layers] [repetitions] [file]
+//
+// The description is written to 'file' (default benchGmxBuild.gmx) and
+// built 'repetitions' times into a new world volume. The peak resident
+// memory of the process is reported with the build time.
+//
+#include "GeoModelXml/Gmx2Geo.h"
+#include "GeoModelXml/GmxInterface.h"
+
+#include "GeoModelKernel/GeoBox.h"
+#include "GeoModelKernel/GeoLogVol.h"
+#include "GeoModelKernel/GeoMaterial.h"
+#include "GeoModelKernel/GeoPhysVol.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <sys/resource.h>
+
+namespace {
+  void writeDescription(const std::string& fileName, int nLayers) {
+    std::ofstream out(fileName);
+    out << "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n"
+        << "<!DOCTYPE geomodel SYSTEM \"" << GMX_DTD_PATH << "\">\n"
+        << "<geomodel name=\"BenchBarrel\" version=\"1.0\" xmlns=\"http://www.nikhef.nl/%7Er29/gmx\">\n"
+        << "  <materials>\n"
+        << "    <element name=\"Nitrogen\" shortname=\"N\" Z=\"7\" A=\"14.00674\"/>\n"
+        << "    <element name=\"Silicon\" shortname=\"Si\" Z=\"14\" A=\"28.0855\"/>\n"
+        << "    <material name=\"N2\" density=\"1.2504e-3 * 273.15/293.15 * 96265/100000\">\n"
+        << "      <elementref fraction=\"1.0\" ref=\"Nitrogen\"/>\n"
+        << "    </material>\n"
+        << "    <material name=\"Si\" density=\"2.329\">\n"
+        << "      <elementref fraction=\"1.0\" ref=\"Silicon\"/>\n"
+        << "    </material>\n"
+        << "  </materials>\n";
+    // the layer geometry as vectors, indexed with []
+    out << "  <defines>\n"
+        << "    <var name=\"ModuleHalfWidth\" value=\"20.\"/>\n"
+        << "    <var name=\"ModuleHalfLength\" value=\"20.\"/>\n"
+        << "    <var name=\"ModuleHalfThickness\" value=\"0.15\"/>\n"
+        << "    <var name=\"ModuleGap\" value=\"0.5\"/>\n";
+    std::string radii, staves, modules, tilts;
+    for (int l = 0; l < nLayers; ++l) {
+      radii += std::to_string(40 + 35 * l) + " ";
+      staves += std::to_string(12 + 6 * l) + " ";
+      modules += std::to_string(20 + 2 * l) + " ";
+      tilts += std::to_string(10 + l % 5) + " ";
+    }
+    out << "    <vector name=\"LayerRadius\" value=\"" << radii << "\"/>\n"
+        << "    <vector name=\"LayerStaves\" value=\"" << staves << "\"/>\n"
+        << "    <vector name=\"LayerModules\" value=\"" << modules << "\"/>\n"
+        << "    <vector name=\"LayerTilt\" value=\"" << tilts << "\"/>\n";
+    for (int l = 0; l < nLayers; ++l) {
+      const int nStaves = 12 + 6 * l, nModules = 20 + 2 * l;
+      out << "    <vector name=\"StavePhi" << l << "\" value=\"";
+      for (int s = 0; s < nStaves; ++s) out << 2. * M_PI * s / nStaves << " ";
+      out << "\"/>\n    <vector name=\"ModuleZ" << l << "\" value=\"";
+      for (int m = 0; m < nModules; ++m) out << (m - 0.5 * (nModules - 1)) * 40.5 << " ";
+      out << "\"/>\n";
+    }
+    out << "  </defines>\n  <shapes>\n"
+        << "    <box name=\"ModuleBox\" xhalflength=\"ModuleHalfThickness\" yhalflength=\"ModuleHalfWidth\""
+        << " zhalflength=\"ModuleHalfLength\"/>\n";
+    for (int l = 0; l < nLayers; ++l) {
+      out << "    <box name=\"StaveBox" << l << "\" xhalflength=\"2. * ModuleHalfThickness\""
+          << " yhalflength=\"ModuleHalfWidth + ModuleGap\""
+          << " zhalflength=\"LayerModules_[" << l << "] * (ModuleHalfLength + 0.25) + ModuleGap\"/>\n";
+    }
+    out << "  </shapes>\n"
+        << "  <logvol name=\"Module\" shape=\"ModuleBox\" material=\"Si\"/>\n";
+    for (int l = 0; l < nLayers; ++l) {
+      out << "  <logvol name=\"Stave" << l << "\" shape=\"StaveBox" << l << "\" material=\"N2\">\n"
+          << "    <multicopy name=\"Modules" << l << "\" n=\"LayerModules_[" << l << "]\" loopvar=\"ModuleZ" << l << "\">\n"
+          << "      <transformation name=\"ModulePosition" << l << "\">\n"
+          << "        <translation x=\"0.\" y=\"0.\" z=\"ModuleZ" << l << "\"/>\n"
+          << "      </transformation>\n"
+          << "      <logvolref ref=\"Module\"/>\n"
+          << "    </multicopy>\n"
+          << "  </logvol>\n"
+          << "  <assembly name=\"Layer" << l << "\">\n"
+          << "    <multicopy name=\"Staves" << l << "\" n=\"LayerStaves_[" << l << "]\" loopvar=\"StavePhi" << l << "\">\n"
+          << "      <transformation name=\"StavePosition" << l << "\">\n"
+          << "        <translation x=\"LayerRadius_[" << l << "] * cos(StavePhi" << l << ")\""
+          << " y=\"LayerRadius_[" << l << "] * sin(StavePhi" << l << ")\" z=\"0.\"/>\n"
+          << "        <rotation xcos=\"0.\" ycos=\"0.\" zcos=\"1.\""
+          << " angle=\"StavePhi" << l << " + LayerTilt_[" << l << "] * deg\"/>\n"
+          << "      </transformation>\n"
+          << "      <logvolref ref=\"Stave" << l << "\"/>\n"
+          << "    </multicopy>\n"
+          << "  </assembly>\n";
+    }
+    out << "  <addbranch>\n";
+    for (int l = 0; l < nLayers; ++l) out << "    <assemblyref ref=\"Layer" << l << "\"/>\n";
+    out << "  </addbranch>\n</geomodel>\n";
+  }
+
+  // peak resident memory of the process, in MB
+  double peakMemory() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / 1024.;
+  }
+
+  void run(const std::string& fileName, int nLayers, int nRepetitions) {
+    const double startMemory = peakMemory();
+    GeoIntrusivePtr<GeoMaterial> air{new GeoMaterial("Air", 1.2e-3)};
+    double total{0.};
+    unsigned int nVolumes{0};
+    for (int r = 0; r < nRepetitions; ++r) {
+      GeoIntrusivePtr<GeoPhysVol> world{new GeoPhysVol(new GeoLogVol("World", new GeoBox(5000., 5000., 5000.), air.get()))};
+      GmxInterface gmxInterface;
+      const auto start = std::chrono::steady_clock::now();
+      Gmx2Geo gmx2Geo(fileName, world.get(), gmxInterface);
+      total += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      nVolumes = world->getNChildVols();
+    }
+    std::cout << "benchGmxBuild: " << nLayers << " layers ("
+              << nVolumes << " volumes in the world), " << 1.e3 * total / nRepetitions
+              << " ms per build, peak memory " << peakMemory() << " MB ("
+              << peakMemory() - startMemory << " MB for the builds)" << std::endl;
+  }
+}
+
+int main(int argc, char* argv[]) {
+  const int nLayers = argc > 1 ? std::atoi(argv[1]) : 20;
+  const int nRepetitions = argc > 2 ? std::atoi(argv[2]) : 5;
+  const std::string fileName = argc > 3 ? argv[3] : "benchGmxBuild.gmx";
+
+  writeDescription(fileName, nLayers);
+
+  run(fileName, nLayers, nRepetitions);
+  return EXIT_SUCCESS;
+}
@@ -16,6 +16,8 @@
 #include <xercesc/dom/DOMImplementation.hpp>
 #include <xercesc/dom/DOMImplementationLS.hpp>
 #include <xercesc/dom/DOMImplementationRegistry.hpp>
+#include <xercesc/framework/MemBufInputSource.hpp>
+#include <xercesc/framework/Wrapper4InputSource.hpp>
 #include "GeoModelXml/StrictErrorHandler.h"
 #include "xercesc/util/XMLString.hpp"
 #include <iostream>
@@ -57,6 +59,10 @@ DOMDocument *createDOMDocument(string xmlFile, DOMLSParser *parser, unsigned int
 // from a file included via an !ENTITY are not writable. False should be the default, but for some reason the
 // following is still needed
     config->setParameter(xercesc::XMLUni::fgDOMEntities, false);
+// Only the elements and their attributes are used: keep the ignorable whitespace between
+// elements and the comments out of the tree, where they would be most of its nodes
+    config->setParameter(XMLUni::fgDOMElementContentWhitespace, false);
+    config->setParameter(XMLUni::fgDOMComments, false);
 
     // And create our error handler and install it
     StrictErrorHandler errorHandler;
@@ -64,14 +70,13 @@ DOMDocument *createDOMDocument(string xmlFile, DOMLSParser *parser, unsigned int
 //
 //    Parse the file
 //
-    XMLCh *xmlCh(0); 
+    string decompressed;
     xercesc::DOMDocument *doc;
     try {
         if (!(flags & 0x1)) { // String is a file name
             doc = parser->parseURI(xmlFile.c_str());
         }
         else {
-            string decompressed;
             if (flags & 0x2) { // Decompress it
                 decompressed = decompress(xmlFile);
 cout << "Decompressed it\n";
@@ -79,16 +84,16 @@ cout << "Decompressed it\n";
             else {
                 decompressed = xmlFile;
             }
-            xmlCh = XMLString::transcode(decompressed.c_str());
-cout << "Transcoded it\n";
-            DOMLSInput *input = impl->createLSInput();
-            input->setStringData(xmlCh);            
-            doc = parser->parse(input);
+// Parse the bytes in place rather than from a transcoded XMLCh copy of the whole string
+            MemBufInputSource memInput(reinterpret_cast<const XMLByte *>(decompressed.data()),
+                                       decompressed.size(), "gmxString", false);
+            Wrapper4InputSource input(&memInput, false);
+            doc = parser->parse(&input);
 cout << "Parsed it\n";
         }
         if (errorHandler.getSawErrors()) {
             cout << "Oh oh, saw errors. \n";
-if (flags & 0x1) cout << "\n\n\n" << XMLString::transcode(xmlCh) << "\n\n\n";
+if (flags & 0x1) cout << "\n\n\n" << decompressed << "\n\n\n";
             return 0;
         }
         else {
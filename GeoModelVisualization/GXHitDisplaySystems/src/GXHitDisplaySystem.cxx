@@ -32,6 +32,8 @@
 
 #include <QFileDialog>
 #include <QMessageBox>
+#include <algorithm>
+#include <cstdint>
 #include <map>
 #include <iostream>
 #include <fstream>
@@ -49,6 +51,15 @@ struct Hit{
   int   ID;
 };
 
+// An entry of the index table "hitsIndex": the range of the hits
+// of an event in the "hits" dataset
+struct IndexEntry{
+  int64_t  event;
+  int64_t  key;
+  uint64_t offset;
+  uint64_t count;
+};
+
 
 
 
@@ -66,9 +77,40 @@ public:
 
   
   CompType datatype{sizeof(Hit)};
+  CompType indexType{sizeof(IndexEntry)};
   H5File   *file{nullptr};
   std::vector<Hit> hit;
 
+  // The files written by the asynchronous writer of the hits plugin store the
+  // hits of all the events in the "hits" dataset, with the index "hitsIndex"
+  // sorted here by event; the older files have a dataset per event
+  std::vector<IndexEntry> index;
+  size_t nextIndex{0};
+
+  void readIndex() {
+    index.clear();
+    nextIndex=0;
+    if (!file->nameExists("hitsIndex")) return;
+    DataSet dataset=file->openDataSet("hitsIndex");
+    hsize_t size=0;
+    dataset.getSpace().getSimpleExtentDims(&size);
+    index.resize(size);
+    if (size) dataset.read(index.data(),indexType);
+    std::stable_sort(index.begin(),index.end(),
+                     [](const IndexEntry& a, const IndexEntry& b) { return a.event<b.event; });
+  }
+
+  void readIndexedEvent(const IndexEntry& entry) {
+    hit.resize(entry.count);
+    if (!entry.count) return;
+    DataSet dataset=file->openDataSet("hits");
+    hsize_t start=entry.offset, length=entry.count;
+    DataSpace fileSpace=dataset.getSpace();
+    fileSpace.selectHyperslab(H5S_SELECT_SET,&length,&start);
+    DataSpace memSpace(1,&length);
+    dataset.read(hit.data(),datatype,memSpace,fileSpace);
+  }
+
 
 
   
@@ -116,6 +158,11 @@ GXHitDisplaySystem::GXHitDisplaySystem()
   m_d->datatype.insertMember("Z", HOFFSET(Hit,Z),PredType::NATIVE_FLOAT);
   m_d->datatype.insertMember("ID", HOFFSET(Hit,ID),PredType::NATIVE_INT);
 
+  m_d->indexType.insertMember("event", HOFFSET(IndexEntry,event),PredType::NATIVE_INT64);
+  m_d->indexType.insertMember("key", HOFFSET(IndexEntry,key),PredType::NATIVE_INT64);
+  m_d->indexType.insertMember("offset", HOFFSET(IndexEntry,offset),PredType::NATIVE_UINT64);
+  m_d->indexType.insertMember("count", HOFFSET(IndexEntry,count),PredType::NATIVE_UINT64);
+
 }
 
 
@@ -242,6 +289,7 @@ void GXHitDisplaySystem::selectInputFile() {
 
     delete m_d->file;
     m_d->file=new H5File(path.toStdString(), H5F_ACC_RDONLY);
+    m_d->readIndex();
 
     nextEvent();
   }
@@ -265,14 +313,25 @@ void GXHitDisplaySystem::nextEvent() {
   if (m_d->coords)   m_d->switch0->removeChild(m_d->coords);
 
  
-  static hsize_t count=0;
-  if (count==m_d->file->getNumObjs()) {
-    QMessageBox msgBox;
-    msgBox.setText("Last event reached.  Reset stream to beginning.");
-    msgBox.exec();
-    count=0;
+  if (!m_d->index.empty()) {
+    if (m_d->nextIndex==m_d->index.size()) {
+      QMessageBox msgBox;
+      msgBox.setText("Last event reached.  Reset stream to beginning.");
+      msgBox.exec();
+      m_d->nextIndex=0;
+    }
+    m_d->readIndexedEvent(m_d->index[m_d->nextIndex++]);
+  }
+  else {
+    static hsize_t count=0;
+    if (count==m_d->file->getNumObjs()) {
+      QMessageBox msgBox;
+      msgBox.setText("Last event reached.  Reset stream to beginning.");
+      msgBox.exec();
+      count=0;
+    }
+    H5Literate(m_d->file->getId(), H5_INDEX_NAME, H5_ITER_INC, &count, file_info, m_d);
   }
-  H5Literate(m_d->file->getId(), H5_INDEX_NAME, H5_ITER_INC, &count, file_info, m_d);
 
 
 
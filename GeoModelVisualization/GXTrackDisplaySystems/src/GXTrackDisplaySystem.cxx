@@ -30,6 +30,7 @@
 
 #include <QFileDialog>
 #include <QMessageBox>
+#include <cstdint>
 #include <map>
 #include <iostream>
 #include <fstream>
@@ -45,6 +46,28 @@ struct stepData
   float z;
 };
 
+// An entry of the index tables "PDGsIndex", "stepsIndex" and "stepOffsetsIndex":
+// the range of the records of an event (and track) in the "PDGs", "steps" and
+// "stepOffsets" datasets
+struct indexEntry
+{
+  int64_t  event;
+  int64_t  key;
+  uint64_t offset;
+  uint64_t count;
+};
+
+// Read 'count' records from 'offset' of a one-dimensional dataset
+static void readRange(DataSet &dataset, const DataType &type, uint64_t offset, uint64_t count, void *buffer)
+{
+  if (count == 0) return;
+  hsize_t start = offset, length = count;
+  DataSpace fileSpace = dataset.getSpace();
+  fileSpace.selectHyperslab(H5S_SELECT_SET, &length, &start);
+  DataSpace memSpace(1, &length);
+  dataset.read(buffer, type, memSpace, fileSpace);
+}
+
 class GXTrackDisplaySystem::Imp
 {
 public:
@@ -61,8 +84,22 @@ public:
   vector<int> trackNums;
 
   CompType datatype{sizeof(stepData)};
+  CompType indexType{sizeof(indexEntry)};
   H5File *file{nullptr};
 
+  // The files written by the asynchronous writer of the tracks plugin store
+  // the records of all the events in the "PDGs" and "steps" datasets, with
+  // an index table per dataset; the older files have datasets per event.
+  // The steps of an event are one block with the offsets of the tracks in
+  // "stepOffsets", or one block per track in the files without it.
+  bool indexed{false};
+  bool trackOffsets{false};
+  map<int64_t, indexEntry> pdgBlocks;
+  map<int64_t, indexEntry> offsetBlocks;
+  map<int64_t, vector<indexEntry>> stepBlocks;
+
+  void readIndex();
+
   vector<int> pdgs;
   vector<vector<stepData>> trksStepsVec;
 
@@ -71,11 +108,76 @@ public:
   void readEventTracks(int);
 };
 
+void GXTrackDisplaySystem::Imp::readIndex()
+{
+  pdgBlocks.clear();
+  offsetBlocks.clear();
+  stepBlocks.clear();
+  indexed = file->nameExists("stepsIndex");
+  if (!indexed) return;
+  trackOffsets = file->nameExists("stepOffsetsIndex");
+
+  vector<std::string> names{"PDGsIndex", "stepsIndex"};
+  if (trackOffsets) names.push_back("stepOffsetsIndex");
+  for (const std::string &name : names)
+  {
+    DataSet indexDataSet = file->openDataSet(name);
+    hsize_t size = 0;
+    indexDataSet.getSpace().getSimpleExtentDims(&size);
+    vector<indexEntry> entries(size);
+    readRange(indexDataSet, indexType, 0, size, entries.data());
+    for (const indexEntry &entry : entries)
+    {
+      if (name == "PDGsIndex") pdgBlocks[entry.event] = entry;
+      else if (name == "stepOffsetsIndex") offsetBlocks[entry.event] = entry;
+      else stepBlocks[entry.event].push_back(entry);
+    }
+  }
+}
+
 void GXTrackDisplaySystem::Imp::readEventTracks(int eventNum)
 {
   pdgs.clear();
   trksStepsVec.clear();
 
+  if (indexed)
+  {
+    const indexEntry &pdgBlock = pdgBlocks.at(eventNum);
+    pdgs.resize(pdgBlock.count);
+    DataSet pdgDataSet = file->openDataSet("PDGs");
+    readRange(pdgDataSet, PredType::NATIVE_INT, pdgBlock.offset, pdgBlock.count, pdgs.data());
+
+    trksStepsVec.resize(pdgs.size());
+    DataSet stepsDataSet = file->openDataSet("steps");
+    if (trackOffsets)
+    {
+      // the points of the track with ID i are [offsets[i-1], offsets[i])
+      // of the block of the event
+      const indexEntry &offsetBlock = offsetBlocks.at(eventNum);
+      vector<uint64_t> offsets(offsetBlock.count);
+      DataSet offsetsDataSet = file->openDataSet("stepOffsets");
+      readRange(offsetsDataSet, PredType::NATIVE_UINT64, offsetBlock.offset, offsetBlock.count, offsets.data());
+      const indexEntry &stepBlock = stepBlocks.at(eventNum).front();
+      vector<stepData> eventSteps(stepBlock.count);
+      readRange(stepsDataSet, datatype, stepBlock.offset, stepBlock.count, eventSteps.data());
+      for (size_t trk = 0; trk + 1 < offsets.size() && trk < trksStepsVec.size(); ++trk)
+      {
+        if (offsets[trk+1] > eventSteps.size()) break;
+        trksStepsVec[trk].assign(eventSteps.begin() + offsets[trk], eventSteps.begin() + offsets[trk+1]);
+      }
+      return;
+    }
+    for (const indexEntry &stepBlock : stepBlocks[eventNum])
+    {
+      // the tracks are numbered from 1
+      if (stepBlock.key < 1 || stepBlock.key > int64_t(trksStepsVec.size())) continue;
+      vector<stepData> &steps = trksStepsVec[stepBlock.key - 1];
+      steps.resize(stepBlock.count);
+      readRange(stepsDataSet, datatype, stepBlock.offset, stepBlock.count, steps.data());
+    }
+    return;
+  }
+
   std::string pdgDataSetName = "event" + std::to_string(eventNum) + "PDGs";
 
   DataSet *pdgDataSet = new DataSet(file->openDataSet(pdgDataSetName));
@@ -114,6 +216,11 @@ GXTrackDisplaySystem::GXTrackDisplaySystem()
   m_d->datatype.insertMember("x", HOFFSET(stepData, x), PredType::NATIVE_FLOAT);
   m_d->datatype.insertMember("y", HOFFSET(stepData, y), PredType::NATIVE_FLOAT);
   m_d->datatype.insertMember("z", HOFFSET(stepData, z), PredType::NATIVE_FLOAT);
+
+  m_d->indexType.insertMember("event",  HOFFSET(indexEntry, event),  PredType::NATIVE_INT64);
+  m_d->indexType.insertMember("key",    HOFFSET(indexEntry, key),    PredType::NATIVE_INT64);
+  m_d->indexType.insertMember("offset", HOFFSET(indexEntry, offset), PredType::NATIVE_UINT64);
+  m_d->indexType.insertMember("count",  HOFFSET(indexEntry, count),  PredType::NATIVE_UINT64);
 }
 
 //_____________________________________________________________________________________
@@ -220,6 +327,7 @@ void GXTrackDisplaySystem::selectInputFile()
     size_t buffSize = eventNumsDataset->getStorageSize() / sizeof(int);
     m_d->trackNums.resize(buffSize);
     eventNumsDataset->read(m_d->trackNums.data(), PredType::NATIVE_INT);
+    m_d->readIndex();
 
     nextEvent();
 